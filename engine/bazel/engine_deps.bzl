@@ -41,6 +41,13 @@ def engine_deps():
     _com_github_duckdb()
 
     _com_github_brpc_brpc()
+    _com_github_grpc_grpc()
+
+    _com_github_curl_curl()
+    _com_github_aws_c_common()
+    _com_github_aws_checksums()
+    _com_github_aws_c_event_stream()
+    _com_github_aws_sdk_cpp()
 
     maybe(
         git_repository,
@@ -49,6 +56,22 @@ def engine_deps():
         remote = SPU_GIT,
     )
 
+    _com_alipay_sf_heu()
+
+# paillier used by GroupHeSum. heu_deps() runs after spu_deps() and
+# yacl_deps() in WORKSPACE, so HEU is built against the yacl pinned by spulib.
+# TODO: set sha256 of the archive, bazel prints it on the first fetch.
+def _com_alipay_sf_heu():
+    maybe(
+        http_archive,
+        name = "com_alipay_sf_heu",
+        strip_prefix = "heu-0.4.3",
+        type = "tar.gz",
+        urls = [
+            "https://github.com/secretflow/heu/archive/refs/tags/v0.4.3.tar.gz",
+        ],
+    )
+
 def _org_apache_arrow():
     maybe(
         http_archive,
@@ -272,3 +295,83 @@ def _com_github_brpc_brpc():
             "https://github.com/apache/incubator-brpc/archive/refs/tags/1.4.0.tar.gz",
         ],
     )
+
+def _com_github_grpc_grpc():
+    # required by arrow flight
+    maybe(
+        http_archive,
+        name = "com_github_grpc_grpc",
+        sha256 = "b55696fb249669744de3e71acc54a9382bea0dce7cd5ba379b356b12b82d4229",
+        strip_prefix = "grpc-1.51.1",
+        type = "tar.gz",
+        urls = [
+            "https://github.com/grpc/grpc/archive/refs/tags/v1.51.1.tar.gz",
+        ],
+    )
+
+# aws sdk and its dependencies are required by arrow s3 filesystem, versions
+# and checksums are the same as arrow's cmake build.
+def _com_github_curl_curl():
+    maybe(
+        http_archive,
+        name = "com_github_curl_curl",
+        sha256 = "3dfdd39ba95e18847965cd3051ea6d22586609d9011d91df7bc5521288987a82",
+        strip_prefix = "curl-7.86.0",
+        type = "tar.gz",
+        build_file = "@scql//engine/bazel:curl.BUILD",
+        urls = [
+            "https://github.com/curl/curl/releases/download/curl-7_86_0/curl-7.86.0.tar.gz",
+        ],
+    )
+
+def _com_github_aws_c_common():
+    maybe(
+        http_archive,
+        name = "com_github_aws_c_common",
+        sha256 = "928a3e36f24d1ee46f9eec360ec5cebfe8b9b8994fe39d4fa74ff51aebb12717",
+        strip_prefix = "aws-c-common-0.6.9",
+        type = "tar.gz",
+        build_file = "@scql//engine/bazel:aws-c-common.BUILD",
+        urls = [
+            "https://github.com/awslabs/aws-c-common/archive/refs/tags/v0.6.9.tar.gz",
+        ],
+    )
+
+def _com_github_aws_checksums():
+    maybe(
+        http_archive,
+        name = "com_github_aws_checksums",
+        sha256 = "394723034b81cc7cd528401775bc7aca2b12c7471c92350c80a0e2fb9d2909fe",
+        strip_prefix = "aws-checksums-0.1.12",
+        type = "tar.gz",
+        build_file = "@scql//engine/bazel:aws-checksums.BUILD",
+        urls = [
+            "https://github.com/awslabs/aws-checksums/archive/refs/tags/v0.1.12.tar.gz",
+        ],
+    )
+
+def _com_github_aws_c_event_stream():
+    maybe(
+        http_archive,
+        name = "com_github_aws_c_event_stream",
+        sha256 = "f1b423a487b5d6dca118bfc0d0c6cc596dd476b282258a3228e73a8f730422d4",
+        strip_prefix = "aws-c-event-stream-0.1.5",
+        type = "tar.gz",
+        build_file = "@scql//engine/bazel:aws-c-event-stream.BUILD",
+        urls = [
+            "https://github.com/awslabs/aws-c-event-stream/archive/refs/tags/v0.1.5.tar.gz",
+        ],
+    )
+
+def _com_github_aws_sdk_cpp():
+    maybe(
+        http_archive,
+        name = "com_github_aws_sdk_cpp",
+        sha256 = "d6c495bc06be5e21dac716571305d77437e7cfd62a2226b8fe48d9ab5785a8d6",
+        strip_prefix = "aws-sdk-cpp-1.8.133",
+        type = "tar.gz",
+        build_file = "@scql//engine/bazel:aws-sdk-cpp.BUILD",
+        urls = [
+            "https://github.com/aws/aws-sdk-cpp/archive/refs/tags/1.8.133.tar.gz",
+        ],
+    )
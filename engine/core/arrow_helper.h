@@ -27,12 +27,12 @@
 #endif  // not defined(THROW_IF_ARROW_NOT_OK)
 
 #ifndef ASSIGN_OR_THROW_ARROW_STATUS
-#define ASSIGN_OR_THROW_ARROW_STATUS(lhs, rexpr)    \
-  do {                                              \
-    auto&& result = (rexpr);                        \
-    if (!result.ok()) {                             \
-      YACL_THROW("{}", result.status().ToString()); \
-    }                                               \
-    lhs = std::move(result).ValueUnsafe();          \
+#define ASSIGN_OR_THROW_ARROW_STATUS(lhs, rexpr)           \
+  do {                                                     \
+    auto&& arrow_result_ = (rexpr);                        \
+    if (!arrow_result_.ok()) {                             \
+      YACL_THROW("{}", arrow_result_.status().ToString()); \
+    }                                                      \
+    lhs = std::move(arrow_result_).ValueUnsafe();          \
   } while (0)
 #endif  // ASSIGN_OR_THROW_ARROW_STATUS
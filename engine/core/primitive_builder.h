@@ -53,6 +53,13 @@ class NumericTensorBuilder : public TensorBuilder {
     THROW_IF_ARROW_NOT_OK(builder_.Append(val));
   }
 
+  // Append @param[in] length values at once, values[i] is null if
+  // valid_bytes[i] is 0, all values are valid if valid_bytes is nullptr.
+  void AppendValues(const value_type* values, int64_t length,
+                    const uint8_t* valid_bytes = nullptr) {
+    THROW_IF_ARROW_NOT_OK(builder_.AppendValues(values, length, valid_bytes));
+  }
+
  private:
   arrow::ArrayBuilder* GetBaseBuilder() override { return &builder_; }
 
@@ -30,4 +30,12 @@ void StringTensorBuilder::Append(const char* str, std::size_t len) {
   THROW_IF_ARROW_NOT_OK(builder_.Append(str, len));
 }
 
+void StringDictionaryTensorBuilder::AppendNull() {
+  THROW_IF_ARROW_NOT_OK(builder_.AppendNull());
+}
+
+void StringDictionaryTensorBuilder::Append(std::string_view value) {
+  THROW_IF_ARROW_NOT_OK(builder_.Append(value));
+}
+
 }  // namespace scql::engine
\ No newline at end of file
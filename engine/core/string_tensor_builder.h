@@ -37,4 +37,22 @@ class StringTensorBuilder : public TensorBuilder {
   arrow::StringBuilder builder_;
 };
 
+/// @brief Builder for dictionary-encoded UTF8 strings tensor, each distinct
+/// string is stored once and rows only keep int32 indices.
+class StringDictionaryTensorBuilder : public TensorBuilder {
+ public:
+  StringDictionaryTensorBuilder()
+      : TensorBuilder(arrow::dictionary(arrow::int32(), arrow::utf8())) {}
+  ~StringDictionaryTensorBuilder() = default;
+
+  void AppendNull() override;
+
+  void Append(std::string_view value);
+
+ private:
+  arrow::ArrayBuilder* GetBaseBuilder() override { return &builder_; }
+
+  arrow::StringDictionary32Builder builder_;
+};
+
 }  // namespace scql::engine
\ No newline at end of file
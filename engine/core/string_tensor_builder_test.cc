@@ -36,4 +36,28 @@ TEST(StringTensorBuilderTest, works) {
   EXPECT_EQ(tensor->GetNullCount(), 1);
 }
 
+TEST(StringDictionaryTensorBuilderTest, works) {
+  // Given
+  StringDictionaryTensorBuilder builder;
+
+  builder.Append("CN");
+  builder.Append("US");
+  builder.AppendNull();
+  builder.Append("CN");
+
+  // When
+  std::shared_ptr<Tensor> tensor;
+  builder.Finish(&tensor);
+
+  // Then
+  EXPECT_EQ(tensor->Length(), 4);
+  EXPECT_EQ(tensor->GetNullCount(), 1);
+  EXPECT_EQ(tensor->Type(), pb::PrimitiveDataType::STRING);
+  EXPECT_TRUE(tensor->IsDictionaryEncoded());
+
+  auto chunk = std::static_pointer_cast<arrow::DictionaryArray>(
+      tensor->ToArrowChunkedArray()->chunk(0));
+  EXPECT_EQ(chunk->dictionary()->length(), 2);
+}
+
 }  // namespace scql::engine
\ No newline at end of file
@@ -38,6 +38,12 @@ class Tensor {
   /// @returns the data type of tensor element
   pb::PrimitiveDataType Type() const { return dtype_; }
 
+  /// @returns true if tensor is stored as arrow dictionary array, the element
+  /// type is still reported as its value type by Type().
+  bool IsDictionaryEncoded() const {
+    return chunked_arr_->type()->id() == arrow::Type::DICTIONARY;
+  }
+
   /// @returns as arrow chunked array
   std::shared_ptr<arrow::ChunkedArray> ToArrowChunkedArray() const {
     return chunked_arr_;
@@ -29,6 +29,10 @@ void TensorBuilder::Finish(std::shared_ptr<Tensor>* out) {
   *out = std::make_shared<Tensor>(std::move(chunked_arr));
 }
 
+void TensorBuilder::Reserve(int64_t additional) {
+  THROW_IF_ARROW_NOT_OK(GetBaseBuilder()->Reserve(additional));
+}
+
 void TensorBuilder::FinishInternal() {
   std::shared_ptr<arrow::Array> arr;
 
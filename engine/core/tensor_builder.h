@@ -33,6 +33,9 @@ class TensorBuilder {
   // Append a null value to builder
   virtual void AppendNull() = 0;
 
+  // Reserve space for @param[in] additional more values
+  void Reserve(int64_t additional);
+
  protected:
   void FinishInternal();
 
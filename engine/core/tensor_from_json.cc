@@ -22,11 +22,16 @@ namespace scql::engine {
 
 TensorPtr TensorFromJSON(const std::shared_ptr<arrow::DataType>& dtype,
                          const std::string& json) {
+  return TensorFromJSON(dtype, std::vector<std::string>{json});
+}
+
+TensorPtr TensorFromJSON(const std::shared_ptr<arrow::DataType>& dtype,
+                         const std::vector<std::string>& json_chunks) {
   using arrow::ipc::internal::json::ChunkedArrayFromJSON;
 
   std::shared_ptr<arrow::ChunkedArray> chunked_arr;
-  THROW_IF_ARROW_NOT_OK(ChunkedArrayFromJSON(
-      dtype, std::vector<std::string>{json}, &chunked_arr));
+  THROW_IF_ARROW_NOT_OK(
+      ChunkedArrayFromJSON(dtype, json_chunks, &chunked_arr));
 
   return std::make_shared<Tensor>(std::move(chunked_arr));
 }
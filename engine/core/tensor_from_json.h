@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "engine/core/tensor.h"
 
 namespace scql::engine {
@@ -24,4 +27,8 @@ namespace scql::engine {
 TensorPtr TensorFromJSON(const std::shared_ptr<arrow::DataType>& dtype,
                          const std::string& json);
 
+/// @brief construct tensor with one chunk per json string
+TensorPtr TensorFromJSON(const std::shared_ptr<arrow::DataType>& dtype,
+                         const std::vector<std::string>& json_chunks);
+
 }  // namespace scql::engine
\ No newline at end of file
@@ -59,6 +59,15 @@ pb::PrimitiveDataType FromArrowDataType(
     case arrow::Type::STRING:
       ty = pb::PrimitiveDataType::STRING;
       break;
+    case arrow::Type::DICTIONARY: {
+      // only dictionary-encoded strings are supported
+      const auto& dict_type =
+          static_cast<const arrow::DictionaryType&>(*dtype);
+      ty = dict_type.value_type()->id() == arrow::Type::STRING
+               ? pb::PrimitiveDataType::STRING
+               : pb::PrimitiveDataType::PrimitiveDataType_UNDEFINED;
+      break;
+    }
     default:
       ty = pb::PrimitiveDataType::PrimitiveDataType_UNDEFINED;
   }
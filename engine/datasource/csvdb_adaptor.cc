@@ -14,85 +14,145 @@
 
 #include "engine/datasource/csvdb_adaptor.h"
 
-#include "arrow/c/abi.h"
+#include <algorithm>
+#include <filesystem>
+
+#include "absl/strings/ascii.h"
 #include "arrow/c/bridge.h"
-#include "arrow/compute/cast.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
-#include "duckdb/common/arrow/arrow_converter.hpp"
+#include "duckdb/common/arrow/result_arrow_wrapper.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "google/protobuf/util/json_util.h"
 #include "spdlog/spdlog.h"
 #include "yacl/base/exception.h"
 
 #include "engine/core/arrow_helper.h"
-#include "engine/core/type.h"
 #include "engine/datasource/duckdb_wrapper.h"
-#include "engine/util/spu_io.h"
 
 #include "engine/datasource/csvdb_conf.pb.h"
 
 namespace scql::engine {
 
+DEFINE_int32(csvdb_threads, 0,
+             "max threads of DuckDB used by csvdb, DuckDB's default if <= 0");
+DEFINE_string(csvdb_memory_limit, "",
+              "max memory of DuckDB used by csvdb, e.g. '4GB', DuckDB's "
+              "default if empty");
+DEFINE_bool(csvdb_cache_tables, false,
+            "whether to keep parsed csv files as DuckDB tables, which are "
+            "re-parsed only if size or mtime of the file changes");
+DEFINE_int64(csvdb_cache_max_bytes, 1024LL * 1024 * 1024,
+             "max total size of csv files kept as DuckDB tables per csvdb, "
+             "least recently used tables are dropped");
+DEFINE_int64(csvdb_arrow_batch_rows, 1024 * 1024,
+             "max rows of one arrow batch fetched from DuckDB, which becomes "
+             "one chunk of result tensors");
+DEFINE_bool(csvdb_stream_result, true,
+            "whether to stream query results of DuckDB, if false results are "
+            "produced by DuckDB threads in parallel and kept in memory "
+            "before fetched");
+
 namespace {
 
 // idea from:
 // https://github.com/duckdb/duckdb/blob/0d2d7930d2789405a0d07a15e37485fe70faee3e/test/arrow/parquet_test.cpp#L86-L104
-void ConvertDuckResultToTensors(std::unique_ptr<duckdb::QueryResult> result,
-                                const std::vector<ColumnDesc>& expected_outputs,
-                                std::vector<TensorPtr>* tensors) {
-  ArrowSchema abi_arrow_schema;
-  std::vector<std::shared_ptr<arrow::RecordBatch>> batches_result;
-  auto timezone_config = duckdb::QueryResult::GetConfigTimezone(*result);
-  duckdb::ArrowConverter::ToArrowSchema(&abi_arrow_schema, result->types,
-                                        result->names, timezone_config);
-  std::shared_ptr<arrow::Schema> schema;
-  ASSIGN_OR_THROW_ARROW_STATUS(schema, arrow::ImportSchema(&abi_arrow_schema));
-
-  while (true) {
-    auto data_chunk = result->Fetch();
-    if (!data_chunk || data_chunk->size() == 0) {
-      break;
+class DuckChunkedResult : public ChunkedResult {
+ public:
+  DuckChunkedResult(std::shared_ptr<duckdb::DuckDB> db,
+                    const std::string& query,
+                    std::vector<ColumnDesc> expected_outputs)
+      : db_(std::move(db)),
+        conn_(*db_),
+        expected_outputs_(std::move(expected_outputs)) {
+    // a streaming result produces rows while they are fetched, a
+    // materialized result is produced by all threads of DuckDB in parallel.
+    auto result = FLAGS_csvdb_stream_result
+                      ? std::unique_ptr<duckdb::QueryResult>(
+                            conn_.SendQuery(query))
+                      : std::unique_ptr<duckdb::QueryResult>(
+                            conn_.Query(query));
+    YACL_ENFORCE(!result->HasError(), "run query in DuckDB failed, msg={}",
+                 result->GetError());
+
+    // the wrapper is owned by the stream and released with reader_, DuckDB
+    // appends data chunks into arrow arrays of up to batch_size rows, so no
+    // more copies are needed after the stream.
+    auto wrapper = new duckdb::ResultArrowArrayStreamWrapper(
+        std::move(result), FLAGS_csvdb_arrow_batch_rows);
+    ASSIGN_OR_THROW_ARROW_STATUS(
+        reader_, arrow::ImportRecordBatchReader(&wrapper->stream));
+    schema_ = reader_->schema();
+    YACL_ENFORCE_EQ(
+        schema_->num_fields(), expected_outputs_.size(),
+        "query result column size={} not equal to expected size={}",
+        schema_->num_fields(), expected_outputs_.size());
+  }
+
+  std::optional<std::vector<TensorPtr>> Fetch() override {
+    if (done_) {
+      return std::nullopt;
     }
-    data_chunk->Verify();
-    ArrowArray arrow_array;
-    duckdb::ArrowConverter::ToArrowArray(*data_chunk, &arrow_array);
     std::shared_ptr<arrow::RecordBatch> batch;
-    ASSIGN_OR_THROW_ARROW_STATUS(
-        batch, arrow::ImportRecordBatch(&arrow_array, schema));
+    THROW_IF_ARROW_NOT_OK(reader_->ReadNext(&batch));
+    std::vector<arrow::ArrayVector> columns(schema_->num_fields());
+    if (batch == nullptr) {
+      done_ = true;
+      if (fetched_any_) {
+        return std::nullopt;
+      }
+    } else {
+      THROW_IF_ARROW_NOT_OK(batch->Validate());
+      for (int i = 0; i < batch->num_columns(); ++i) {
+        columns[i].push_back(batch->column(i));
+      }
+    }
+    fetched_any_ = true;
 
-    batches_result.push_back(std::move(batch));
+    std::vector<TensorPtr> tensors;
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      tensors.push_back(ArraysToTensor(std::move(columns[i]),
+                                       schema_->field(i)->type(),
+                                       expected_outputs_[i].dtype));
+    }
+    return tensors;
   }
 
-  std::shared_ptr<arrow::Table> table;
-  ASSIGN_OR_THROW_ARROW_STATUS(
-      table, arrow::Table::FromRecordBatches(schema, batches_result));
-  THROW_IF_ARROW_NOT_OK(table->Validate());
-  YACL_ENFORCE_EQ(table->num_columns(), expected_outputs.size(),
-                  "query result column size={} not equal to expected size={}",
-                  table->num_columns(), expected_outputs.size());
-
-  tensors->clear();
-  for (int i = 0; i < table->num_columns(); ++i) {
-    auto chunked_arr = table->column(i);
-    YACL_ENFORCE(chunked_arr, "get column(idx={}) from table failed", i);
-    if (FromArrowDataType(chunked_arr->type()) != expected_outputs[i].dtype) {
-      auto to_type = ToArrowDataType(expected_outputs[i].dtype);
-      SPDLOG_WARN("arrow type mismatch, convert from {} to {}",
-                  chunked_arr->type()->ToString(), to_type->ToString());
-
-      auto origin_arr = util::ConcatenateChunkedArray(chunked_arr);
-
-      std::shared_ptr<arrow::Array> array;
-      ASSIGN_OR_THROW_ARROW_STATUS(array,
-                                   arrow::compute::Cast(*origin_arr, to_type));
-
-      chunked_arr = std::make_shared<arrow::ChunkedArray>(array);
+ private:
+  // keeps db alive while the result is being fetched
+  std::shared_ptr<duckdb::DuckDB> db_;
+  duckdb::Connection conn_;
+  const std::vector<ColumnDesc> expected_outputs_;
+  std::shared_ptr<arrow::RecordBatchReader> reader_;
+  std::shared_ptr<arrow::Schema> schema_;
+  bool done_ = false;
+  bool fetched_any_ = false;
+};
+
+void QueryOrThrow(duckdb::Connection& conn, const std::string& sql) {
+  auto result = conn.Query(sql);
+  YACL_ENFORCE(!result->HasError(), "run {} in DuckDB failed, msg={}", sql,
+               result->GetError());
+}
+
+bool IsIdentifierChar(char c) {
+  return absl::ascii_isalnum(c) || c == '_' || c == '$';
+}
+
+// @returns whether @param[in] table_name appears in @param[in] query as a
+// whole name, e.g. db.t is not used by "select * from db.t2".
+bool IsTableUsed(const std::string& query, const std::string& table_name) {
+  for (auto pos = query.find(table_name); pos != std::string::npos;
+       pos = query.find(table_name, pos + 1)) {
+    auto end = pos + table_name.size();
+    if ((pos == 0 ||
+         (!IsIdentifierChar(query[pos - 1]) && query[pos - 1] != '.')) &&
+        (end == query.size() || !IsIdentifierChar(query[end]))) {
+      return true;
     }
-    auto tensor = std::make_shared<Tensor>(std::move(chunked_arr));
-    tensors->push_back(std::move(tensor));
   }
+  return false;
 }
 
 }  // namespace
@@ -105,25 +165,114 @@ CsvdbAdaptor::CsvdbAdaptor(const std::string& json_str) {
   YACL_ENFORCE(status.ok(),
                "failed to parse json to csvdb conf: json={}, error={}",
                json_str, status.ToString());
-}
 
-std::vector<TensorPtr> CsvdbAdaptor::ExecQuery(
-    const std::string& query, const std::vector<ColumnDesc>& expected_outputs) {
-  duckdb::DuckDB db = DuckDBWrapper::CreateDB(&csvdb_conf_);
-
-  duckdb::Connection conn(db);
+  db_ = std::make_shared<duckdb::DuckDB>(DuckDBWrapper::CreateDB(&csvdb_conf_));
+  duckdb::Connection conn(*db_);
+  if (FLAGS_csvdb_threads > 0) {
+    QueryOrThrow(conn, fmt::format("SET threads TO {}", FLAGS_csvdb_threads));
+  }
+  if (!FLAGS_csvdb_memory_limit.empty()) {
+    QueryOrThrow(conn, fmt::format("SET memory_limit = '{}'",
+                                   FLAGS_csvdb_memory_limit));
+  }
   conn.BeginTransaction();
   DuckDBWrapper::CreateCSVScanFunction(conn);
   conn.Commit();
+}
+
+std::unique_ptr<ChunkedResult> CsvdbAdaptor::ExecQueryChunked(
+    const std::string& query, const std::vector<ColumnDesc>& expected_outputs) {
+  if (FLAGS_csvdb_cache_tables) {
+    RefreshCachedTables(query);
+  }
+  return std::make_unique<DuckChunkedResult>(db_, query, expected_outputs);
+}
 
-  auto duck_result = conn.SendQuery(query);
-  YACL_ENFORCE(!duck_result->HasError(), "send query to DuckDB failed, msg={}",
-               duck_result->GetError());
+void CsvdbAdaptor::RefreshCachedTables(const std::string& query) {
+  const auto lower_query = absl::AsciiStrToLower(query);
+  std::lock_guard<std::mutex> lock(cache_mu_);
+  ++query_count_;
+  std::vector<const csv::CsvTableConf*> used_tables;
+  for (const auto& csv_tbl : csvdb_conf_.tables()) {
+    // parquet and arrow files are columnar already.
+    if (csv_tbl.format() != csv::FileFormat::CSV) {
+      continue;
+    }
+    const auto full_table_name = absl::AsciiStrToLower(
+        fmt::format("{}.{}", csvdb_conf_.db_name(), csv_tbl.table_name()));
+    // only tables used by the query are parsed
+    if (IsTableUsed(lower_query, full_table_name)) {
+      used_tables.push_back(&csv_tbl);
+      auto iter = cached_tables_.find(full_table_name);
+      if (iter != cached_tables_.end()) {
+        iter->second.last_used = query_count_;
+      }
+    }
+  }
 
-  std::vector<TensorPtr> result;
-  ConvertDuckResultToTensors(std::move(duck_result), expected_outputs, &result);
+  for (const auto* csv_tbl : used_tables) {
+    const auto full_table_name = absl::AsciiStrToLower(
+        fmt::format("{}.{}", csvdb_conf_.db_name(), csv_tbl->table_name()));
+    std::error_code ec;
+    CachedTable file_stat;
+    file_stat.file_size = std::filesystem::file_size(csv_tbl->data_path(), ec);
+    YACL_ENFORCE(!ec, "stat csv file={} failed: {}", csv_tbl->data_path(),
+                 ec.message());
+    file_stat.mtime =
+        std::filesystem::last_write_time(csv_tbl->data_path(), ec);
+    YACL_ENFORCE(!ec, "stat csv file={} failed: {}", csv_tbl->data_path(),
+                 ec.message());
+    file_stat.last_used = query_count_;
+
+    auto iter = cached_tables_.find(full_table_name);
+    if (iter != cached_tables_.end() && iter->second == file_stat) {
+      continue;
+    }
+    duckdb::Connection conn(*db_);
+    if (iter != cached_tables_.end()) {
+      // the stale table must not shadow the changed file
+      DropCachedTable(conn, iter);
+    }
+    if (!EvictCachedTables(conn, file_stat.file_size)) {
+      // too large to cache, the csv file is scanned by every query.
+      continue;
+    }
+    SPDLOG_INFO("parse csv file={} into cached table {}", csv_tbl->data_path(),
+                full_table_name);
+    DuckDBWrapper::CacheCSVTable(conn, csvdb_conf_.db_name(), *csv_tbl);
+    cached_tables_[full_table_name] = file_stat;
+    cached_bytes_ += file_stat.file_size;
+  }
+}
+
+bool CsvdbAdaptor::EvictCachedTables(duckdb::Connection& conn,
+                                     uintmax_t file_size) {
+  if (file_size > static_cast<uintmax_t>(FLAGS_csvdb_cache_max_bytes)) {
+    return false;
+  }
+  while (cached_bytes_ + file_size >
+         static_cast<uintmax_t>(FLAGS_csvdb_cache_max_bytes)) {
+    auto lru = std::min_element(cached_tables_.begin(), cached_tables_.end(),
+                                [](const auto& a, const auto& b) {
+                                  return a.second.last_used <
+                                         b.second.last_used;
+                                });
+    // tables used by the running query are not evicted.
+    if (lru == cached_tables_.end() || lru->second.last_used == query_count_) {
+      return false;
+    }
+    DropCachedTable(conn, lru);
+  }
+  return true;
+}
 
-  return result;
+void CsvdbAdaptor::DropCachedTable(
+    duckdb::Connection& conn,
+    std::unordered_map<std::string, CachedTable>::iterator iter) {
+  SPDLOG_INFO("drop cached table {}", iter->first);
+  DuckDBWrapper::DropCachedTable(conn, iter->first);
+  cached_bytes_ -= iter->second.file_size;
+  cached_tables_.erase(iter);
 }
 
 }  // namespace scql::engine
@@ -14,6 +14,13 @@
 
 #pragma once
 
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "duckdb.hpp"
+
 #include "engine/datasource/datasource_adaptor.h"
 
 #include "engine/datasource/csvdb_conf.pb.h"
@@ -21,18 +28,58 @@
 
 namespace scql::engine {
 
+DECLARE_int64(csvdb_arrow_batch_rows);
+DECLARE_bool(csvdb_cache_tables);
+DECLARE_int64(csvdb_cache_max_bytes);
+DECLARE_bool(csvdb_stream_result);
+
+/// @brief CsvdbAdaptor queries csv files by DuckDB. One DuckDB instance lives
+/// as long as the adaptor, and csv files used by queries are parsed into
+/// DuckDB tables once until the files change.
 class CsvdbAdaptor : public DatasourceAdaptor {
  public:
   CsvdbAdaptor(const std::string& json_str);
 
   ~CsvdbAdaptor() = default;
 
-  std::vector<TensorPtr> ExecQuery(
+  std::unique_ptr<ChunkedResult> ExecQueryChunked(
       const std::string& query,
       const std::vector<ColumnDesc>& expected_outputs) override;
 
  private:
+  struct CachedTable {
+    uintmax_t file_size = 0;
+    std::filesystem::file_time_type mtime;
+    // sequence number of the last query using the table
+    int64_t last_used = 0;
+
+    bool operator==(const CachedTable& other) const {
+      return file_size == other.file_size && mtime == other.mtime;
+    }
+  };
+
+  // parse csv files of tables used by @param[in] query into DuckDB tables if
+  // they are not cached yet or changed since cached.
+  void RefreshCachedTables(const std::string& query);
+
+  // drop least recently used tables until a csv file of @param[in] file_size
+  // could be cached within csvdb_cache_max_bytes.
+  // @returns false if the file could not fit even after dropping
+  bool EvictCachedTables(duckdb::Connection& conn, uintmax_t file_size);
+
+  void DropCachedTable(
+      duckdb::Connection& conn,
+      std::unordered_map<std::string, CachedTable>::iterator iter);
+
   csv::CsvdbConf csvdb_conf_;
+  std::shared_ptr<duckdb::DuckDB> db_;
+
+  std::mutex cache_mu_;
+  // full table name in lower case --> stat of csv file when it is cached
+  std::unordered_map<std::string, CachedTable> cached_tables_;
+  // total size of csv files in cached_tables_
+  uintmax_t cached_bytes_ = 0;
+  int64_t query_count_ = 0;
 };
 
 }  // namespace scql::engine
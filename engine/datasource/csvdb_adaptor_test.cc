@@ -14,10 +14,14 @@
 
 #include "engine/datasource/csvdb_adaptor.h"
 
+#include "arrow/io/file.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "butil/files/temp_file.h"
 #include "google/protobuf/util/json_util.h"
 #include "gtest/gtest.h"
+#include "parquet/arrow/writer.h"
 
 #include "engine/core/tensor_from_json.h"
 
@@ -126,4 +130,177 @@ TEST_F(CsvdbAdaptorTest, QueryWithPredicate) {
                    TensorFromJSON(arrow::float64(), "[4500.8,8900]"));
 }
 
+TEST_F(CsvdbAdaptorTest, ReparseChangedFile) {
+  // Given
+  gflags::FlagSaver saver;
+  FLAGS_csvdb_cache_tables = true;
+  CsvdbAdaptor csvdb_adaptor(csvdb_conf_str_);
+  const std::string query = "select id, name from csvdb.staff";
+  std::vector<ColumnDesc> outputs{{"id", pb::PrimitiveDataType::INT64},
+                                  {"name", pb::PrimitiveDataType::STRING}};
+  auto results = csvdb_adaptor.ExecQuery(query, outputs);
+  CheckTensorEqual(results[0], TensorFromJSON(arrow::int64(), "[1,2,3,4]"));
+
+  // When
+  temp_file_->save(R"csv(id, age, name, salary
+5,25,eve,2500.0)csv");
+  results = csvdb_adaptor.ExecQuery(query, outputs);
+
+  // Then
+  EXPECT_EQ(results.size(), 2);
+  CheckTensorEqual(results[0], TensorFromJSON(arrow::int64(), "[5]"));
+  CheckTensorEqual(results[1],
+                   TensorFromJSON(arrow::utf8(), R"json(["eve"])json"));
+}
+
+TEST_F(CsvdbAdaptorTest, FetchInBatches) {
+  gflags::FlagSaver saver;
+  FLAGS_csvdb_arrow_batch_rows = 2048;
+  for (bool stream : {true, false}) {
+    // Given
+    FLAGS_csvdb_stream_result = stream;
+    CsvdbAdaptor csvdb_adaptor(csvdb_conf_str_);
+    // DuckDB returns BIGINT, which is cast to DOUBLE chunk by chunk.
+    std::vector<ColumnDesc> outputs{{"x", pb::PrimitiveDataType::DOUBLE}};
+
+    // When
+    auto result = csvdb_adaptor.ExecQueryChunked(
+        "select range as x from range(5000)", outputs);
+    std::vector<int64_t> chunk_rows;
+    while (auto chunk = result->Fetch()) {
+      chunk_rows.push_back((*chunk)[0]->Length());
+      EXPECT_EQ((*chunk)[0]->Type(), pb::PrimitiveDataType::DOUBLE);
+    }
+
+    // Then
+    std::vector<int64_t> expected_rows{2048, 2048, 904};
+    EXPECT_EQ(chunk_rows, expected_rows) << "stream=" << stream;
+  }
+}
+
+class CsvdbAdaptorColumnarFileTest : public CsvdbAdaptorTest {
+ protected:
+  void SetUp() override {
+    auto schema = arrow::schema({arrow::field("id", arrow::int64()),
+                                 arrow::field("age", arrow::int64()),
+                                 arrow::field("name", arrow::utf8())});
+    auto table = arrow::Table::Make(
+        schema,
+        {TensorFromJSON(arrow::int64(), "[1,2,3,4]")->ToArrowChunkedArray(),
+         TensorFromJSON(arrow::int64(), "[21,42,19,32]")
+             ->ToArrowChunkedArray(),
+         TensorFromJSON(arrow::utf8(),
+                        R"json(["alice","bob","carol","dave"])json")
+             ->ToArrowChunkedArray()});
+
+    parquet_file_ = std::make_unique<butil::TempFile>("parquet");
+    auto out = arrow::io::FileOutputStream::Open(parquet_file_->fname());
+    ASSERT_TRUE(out.ok());
+    ASSERT_TRUE(parquet::arrow::WriteTable(*table, arrow::default_memory_pool(),
+                                           *out, 2)
+                    .ok());
+    ASSERT_TRUE((*out)->Close().ok());
+
+    arrow_file_ = std::make_unique<butil::TempFile>("arrow");
+    out = arrow::io::FileOutputStream::Open(arrow_file_->fname());
+    ASSERT_TRUE(out.ok());
+    auto writer = arrow::ipc::MakeFileWriter(*out, schema);
+    ASSERT_TRUE(writer.ok());
+    ASSERT_TRUE((*writer)->WriteTable(*table, 2).ok());
+    ASSERT_TRUE((*writer)->Close().ok());
+    ASSERT_TRUE((*out)->Close().ok());
+
+    csv::CsvdbConf csvdb_conf;
+    csvdb_conf.set_db_name("csvdb");
+    auto tbl = csvdb_conf.add_tables();
+    tbl->set_table_name("staff_parquet");
+    tbl->set_data_path(parquet_file_->fname());
+    tbl->set_format(csv::FileFormat::PARQUET);
+    tbl = csvdb_conf.add_tables();
+    tbl->set_table_name("staff_arrow");
+    tbl->set_data_path(arrow_file_->fname());
+    tbl->set_format(csv::FileFormat::ARROW);
+    auto status = google::protobuf::util::MessageToJsonString(csvdb_conf,
+                                                              &csvdb_conf_str_);
+    EXPECT_TRUE(status.ok());
+  }
+
+  std::unique_ptr<butil::TempFile> parquet_file_;
+  std::unique_ptr<butil::TempFile> arrow_file_;
+};
+
+TEST_F(CsvdbAdaptorColumnarFileTest, QueryWithPredicate) {
+  // Given
+  CsvdbAdaptor csvdb_adaptor(csvdb_conf_str_);
+  std::vector<ColumnDesc> outputs{{"name", pb::PrimitiveDataType::STRING},
+                                  {"age", pb::PrimitiveDataType::INT64}};
+
+  for (const auto& table : {"csvdb.staff_parquet", "csvdb.staff_arrow"}) {
+    // When
+    auto results = csvdb_adaptor.ExecQuery(
+        fmt::format("select name, age from {} where age > 30", table),
+        outputs);
+
+    // Then
+    ASSERT_EQ(results.size(), 2) << table;
+    CheckTensorEqual(
+        results[0],
+        TensorFromJSON(arrow::utf8(), R"json(["bob", "dave"])json"));
+    CheckTensorEqual(results[1], TensorFromJSON(arrow::int64(), "[42,32]"));
+  }
+}
+
+TEST_F(CsvdbAdaptorColumnarFileTest, ProjectionOutOfSchemaOrder) {
+  // Given
+  CsvdbAdaptor csvdb_adaptor(csvdb_conf_str_);
+  std::vector<ColumnDesc> outputs{{"name", pb::PrimitiveDataType::STRING},
+                                  {"id", pb::PrimitiveDataType::INT64}};
+
+  for (const auto& table : {"csvdb.staff_parquet", "csvdb.staff_arrow"}) {
+    // When columns are projected in reverse order of schema
+    auto results = csvdb_adaptor.ExecQuery(
+        fmt::format("select name, id from {}", table), outputs);
+
+    // Then
+    ASSERT_EQ(results.size(), 2) << table;
+    CheckTensorEqual(
+        results[0],
+        TensorFromJSON(arrow::utf8(),
+                       R"json(["alice","bob","carol","dave"])json"));
+    CheckTensorEqual(results[1], TensorFromJSON(arrow::int64(), "[1,2,3,4]"));
+  }
+}
+
+TEST_F(CsvdbAdaptorTest, CacheOnlyTablesUsedWithinLimit) {
+  // Given table staff whose file is missing, and staff2 sharing its prefix
+  gflags::FlagSaver saver;
+  FLAGS_csvdb_cache_tables = true;
+  csv::CsvdbConf csvdb_conf;
+  ASSERT_TRUE(
+      google::protobuf::util::JsonStringToMessage(csvdb_conf_str_, &csvdb_conf)
+          .ok());
+  auto staff2 = csvdb_conf.add_tables();
+  staff2->CopyFrom(csvdb_conf.tables(0));
+  staff2->set_table_name("staff2");
+  csvdb_conf.mutable_tables(0)->set_data_path(temp_file_->fname() +
+                                              ".missing");
+  std::string conf_str;
+  ASSERT_TRUE(
+      google::protobuf::util::MessageToJsonString(csvdb_conf, &conf_str).ok());
+  CsvdbAdaptor csvdb_adaptor(conf_str);
+  const std::string query = "select id from csvdb.staff2 where age > 30";
+  std::vector<ColumnDesc> outputs{{"id", pb::PrimitiveDataType::INT64}};
+
+  // When the cache is too small to hold the file
+  FLAGS_csvdb_cache_max_bytes = 1;
+  auto results = csvdb_adaptor.ExecQuery(query, outputs);
+  temp_file_->save(R"csv(id, age, name, salary
+5,35,eve,2500.0)csv");
+  auto changed_results = csvdb_adaptor.ExecQuery(query, outputs);
+
+  // Then staff is not parsed, and staff2 is scanned from the file each time
+  CheckTensorEqual(results[0], TensorFromJSON(arrow::int64(), "[2,4]"));
+  CheckTensorEqual(changed_results[0], TensorFromJSON(arrow::int64(), "[5]"));
+}
+
 }  // namespace scql::engine
\ No newline at end of file
@@ -0,0 +1,290 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "engine/datasource/datasource_adaptor.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "arrow/compute/cast.h"
+#include "arrow/util/byte_size.h"
+#include "spdlog/spdlog.h"
+#include "yacl/base/exception.h"
+
+#include "engine/core/arrow_helper.h"
+#include "engine/core/type.h"
+#include "engine/util/dictionary_util.h"
+
+DEFINE_bool(datasource_dictionary_encode_string, false,
+            "whether to dictionary-encode string columns fetched from "
+            "datasource");
+DEFINE_int64(run_sql_max_buffered_chunks, 16,
+             "max chunks of partitioned RunSQL received from datasource but "
+             "not fetched yet, the partition being fetched is not limited");
+
+namespace scql::engine {
+
+namespace {
+
+// PartitionedResult runs partition queries by at most `concurrency` threads,
+// chunks of later partitions are buffered until former partitions are read.
+// Workers share the state with the result and are detached, so destroying the
+// result doesn't wait for workers blocked in the datasource, they exit once
+// their current Fetch returns.
+class PartitionedResult : public ChunkedResult {
+ public:
+  PartitionedResult(std::shared_ptr<DatasourceAdaptor> adaptor,
+                    std::vector<std::string> queries,
+                    std::vector<ColumnDesc> expected_outputs,
+                    size_t concurrency)
+      : state_(std::make_shared<State>(std::move(adaptor), std::move(queries),
+                                       std::move(expected_outputs))) {
+    for (size_t i = 0; i < std::min(concurrency, state_->queries.size());
+         ++i) {
+      std::thread([state = state_] { Run(state.get()); }).detach();
+    }
+  }
+
+  ~PartitionedResult() override {
+    {
+      std::lock_guard<std::mutex> lock(state_->mu);
+      state_->cancelled = true;
+      // buffered chunks are not needed anymore
+      for (auto& partition : state_->partitions) {
+        partition.chunks.clear();
+      }
+    }
+    state_->cv.notify_all();
+  }
+
+  std::optional<std::vector<TensorPtr>> Fetch() override {
+    auto& state = *state_;
+    std::unique_lock<std::mutex> lock(state.mu);
+    while (state.current < state.partitions.size()) {
+      auto& partition = state.partitions[state.current];
+      state.cv.wait(lock,
+                    [&] { return !partition.chunks.empty() || partition.done; });
+      if (!partition.chunks.empty()) {
+        auto chunk = std::move(partition.chunks.front());
+        partition.chunks.pop_front();
+        --state.buffered;
+        lock.unlock();
+        state.cv.notify_all();
+        return chunk;
+      }
+      if (partition.error) {
+        std::rethrow_exception(partition.error);
+      }
+      ++state.current;
+      // workers of the new current partition may push regardless of limit
+      state.cv.notify_all();
+    }
+    return std::nullopt;
+  }
+
+ private:
+  struct Partition {
+    std::deque<std::vector<TensorPtr>> chunks;
+    bool done = false;
+    std::exception_ptr error;
+  };
+
+  struct State {
+    State(std::shared_ptr<DatasourceAdaptor> adaptor,
+          std::vector<std::string> queries,
+          std::vector<ColumnDesc> expected_outputs)
+        : adaptor(std::move(adaptor)),
+          queries(std::move(queries)),
+          expected_outputs(std::move(expected_outputs)),
+          partitions(this->queries.size()) {}
+
+    // keeps adaptor alive for detached workers
+    const std::shared_ptr<DatasourceAdaptor> adaptor;
+    const std::vector<std::string> queries;
+    const std::vector<ColumnDesc> expected_outputs;
+
+    std::mutex mu;
+    std::condition_variable cv;
+    std::vector<Partition> partitions;
+    // chunks buffered in all partitions
+    int64_t buffered = 0;
+    // next partition to run
+    size_t next = 0;
+    // partition being fetched
+    size_t current = 0;
+    bool cancelled = false;
+  };
+
+  static void Run(State* state) {
+    while (true) {
+      size_t index;
+      {
+        std::lock_guard<std::mutex> lock(state->mu);
+        if (state->cancelled || state->next >= state->queries.size()) {
+          return;
+        }
+        index = state->next++;
+      }
+      auto& partition = state->partitions[index];
+      try {
+        auto result = state->adaptor->ExecQueryChunked(
+            state->queries[index], state->expected_outputs);
+        while (auto chunk = result->Fetch()) {
+          std::unique_lock<std::mutex> lock(state->mu);
+          // the partition being fetched is never blocked, or Fetch would
+          // wait for it forever while later partitions fill the buffer.
+          state->cv.wait(lock, [&] {
+            return state->cancelled || index == state->current ||
+                   state->buffered < FLAGS_run_sql_max_buffered_chunks;
+          });
+          if (state->cancelled) {
+            return;
+          }
+          partition.chunks.push_back(std::move(*chunk));
+          ++state->buffered;
+          lock.unlock();
+          state->cv.notify_all();
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(state->mu);
+        partition.error = std::current_exception();
+      }
+      {
+        std::lock_guard<std::mutex> lock(state->mu);
+        partition.done = true;
+      }
+      state->cv.notify_all();
+    }
+  }
+
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace
+
+std::vector<TensorPtr> DatasourceAdaptor::ExecQuery(
+    const std::string& query, const std::vector<ColumnDesc>& expected_outputs) {
+  auto result = ExecQueryChunked(query, expected_outputs);
+  return ReadAllChunks(result.get());
+}
+
+std::unique_ptr<ChunkedResult> DatasourceAdaptor::ExecQueryPartitioned(
+    const std::string& query, const std::vector<ColumnDesc>& expected_outputs,
+    const std::string& partition_column, int64_t partitions) {
+  if (partitions <= 1) {
+    return ExecQueryChunked(query, expected_outputs);
+  }
+  auto queries = PartitionQuery(query, partition_column, partitions);
+  size_t concurrency = queries.size();
+  if (MaxConcurrentQueries() > 0) {
+    concurrency = std::min<size_t>(concurrency, MaxConcurrentQueries());
+  }
+  return std::make_unique<PartitionedResult>(
+      shared_from_this(), std::move(queries), expected_outputs, concurrency);
+}
+
+std::vector<std::string> PartitionQuery(const std::string& query,
+                                        const std::string& column,
+                                        int64_t partitions) {
+  YACL_ENFORCE(partitions > 0, "invalid partitions={}", partitions);
+  YACL_ENFORCE(!column.empty(), "partition column is empty");
+  std::vector<std::string> queries;
+  for (int64_t i = 0; i < partitions; ++i) {
+    // '%' and ABS work the same in MySQL, SQLite and PostgreSQL.
+    auto predicate = fmt::format("ABS({} % {}) = {}", column, partitions, i);
+    if (i == 0) {
+      predicate = fmt::format("({} OR {} IS NULL)", predicate, column);
+    }
+    queries.push_back(fmt::format(
+        "SELECT * FROM ({}) AS scql_partition WHERE {}", query, predicate));
+  }
+  return queries;
+}
+
+TensorPtr ArraysToTensor(arrow::ArrayVector arrays,
+                         std::shared_ptr<arrow::DataType> type,
+                         pb::PrimitiveDataType expected_type) {
+  if (FromArrowDataType(type) != expected_type) {
+    // cast chunk by chunk, no need to concatenate the whole column.
+    auto to_type = ToArrowDataType(expected_type);
+    SPDLOG_WARN("arrow type mismatch, convert from {} to {}", type->ToString(),
+                to_type->ToString());
+    for (auto& array : arrays) {
+      ASSIGN_OR_THROW_ARROW_STATUS(array,
+                                   arrow::compute::Cast(*array, to_type));
+    }
+    type = to_type;
+  }
+  std::shared_ptr<arrow::ChunkedArray> chunked_arr;
+  ASSIGN_OR_THROW_ARROW_STATUS(
+      chunked_arr, arrow::ChunkedArray::Make(std::move(arrays), type));
+  auto tensor = std::make_shared<Tensor>(std::move(chunked_arr));
+  if (FLAGS_datasource_dictionary_encode_string &&
+      tensor->Type() == pb::PrimitiveDataType::STRING) {
+    tensor = util::DictionaryEncode(tensor);
+  }
+  return tensor;
+}
+
+std::vector<TensorPtr> ReadAllChunks(
+    ChunkedResult* result, int64_t max_bytes,
+    const std::function<void(int64_t)>& on_chunk) {
+  std::vector<arrow::ArrayVector> columns;
+  std::vector<std::shared_ptr<arrow::DataType>> types;
+  int64_t total_bytes = 0;
+  while (auto chunk = result->Fetch()) {
+    if (columns.empty()) {
+      columns.resize(chunk->size());
+      for (const auto& tensor : *chunk) {
+        types.push_back(tensor->ToArrowChunkedArray()->type());
+      }
+    }
+    YACL_ENFORCE_EQ(chunk->size(), columns.size(),
+                    "column size of chunks not equal");
+    int64_t chunk_bytes = 0;
+    for (size_t i = 0; i < chunk->size(); ++i) {
+      for (const auto& arr : (*chunk)[i]->ToArrowChunkedArray()->chunks()) {
+        chunk_bytes += arrow::util::TotalBufferSize(*arr);
+        columns[i].push_back(arr);
+      }
+    }
+    total_bytes += chunk_bytes;
+    YACL_ENFORCE(max_bytes <= 0 || total_bytes <= max_bytes,
+                 "query result takes more than {} bytes memory", max_bytes);
+    if (on_chunk) {
+      on_chunk(chunk_bytes);
+    }
+  }
+
+  std::vector<TensorPtr> tensors;
+  for (size_t i = 0; i < columns.size(); ++i) {
+    std::shared_ptr<arrow::ChunkedArray> chunked_arr;
+    ASSIGN_OR_THROW_ARROW_STATUS(
+        chunked_arr, arrow::ChunkedArray::Make(std::move(columns[i]), types[i]));
+    auto tensor = std::make_shared<Tensor>(std::move(chunked_arr));
+    if (tensor->IsDictionaryEncoded()) {
+      // chunks are encoded separately, make them share one dictionary.
+      tensor = util::DictionaryEncode(tensor);
+    }
+    tensors.push_back(std::move(tensor));
+  }
+  return tensors;
+}
+
+}  // namespace scql::engine
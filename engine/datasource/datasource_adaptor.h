@@ -14,12 +14,24 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <optional>
 #include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "gflags/gflags.h"
 
 #include "engine/core/tensor.h"
 
 #include "api/core.pb.h"
 
+// whether adaptors emit string columns as dictionary-encoded tensors, it
+// saves memory and hashing cost for low-cardinality columns.
+DECLARE_bool(datasource_dictionary_encode_string);
+DECLARE_int64(run_sql_max_buffered_chunks);
+
 namespace scql::engine {
 
 enum ConnectionType {
@@ -37,15 +49,71 @@ struct ColumnDesc {
       : name(std::move(name)), dtype(dtype) {}
 };
 
-class DatasourceAdaptor {
+/// @brief ChunkedResult is the result of a query read chunk by chunk, each
+/// chunk is converted while the datasource still produces the following rows.
+class ChunkedResult {
+ public:
+  virtual ~ChunkedResult() = default;
+
+  /// @returns tensors of the next chunk in order of columns, std::nullopt if
+  /// all chunks are fetched. The first call always returns a chunk, which may
+  /// be empty, so that column types are known.
+  virtual std::optional<std::vector<TensorPtr>> Fetch() = 0;
+};
+
+class DatasourceAdaptor
+    : public std::enable_shared_from_this<DatasourceAdaptor> {
  public:
   virtual ~DatasourceAdaptor() = default;
 
-  // ExecQuery execute query,
+  // ExecQuery execute query and read the whole result,
   // It will complain if the actual outputs not matched with expected_outputs.
   virtual std::vector<TensorPtr> ExecQuery(
+      const std::string& query,
+      const std::vector<ColumnDesc>& expected_outputs);
+
+  // ExecQueryChunked execute query and return its result in chunks, the
+  // datasource may be still running the query when the first chunk returns.
+  virtual std::unique_ptr<ChunkedResult> ExecQueryChunked(
       const std::string& query,
       const std::vector<ColumnDesc>& expected_outputs) = 0;
+
+  // ExecQueryPartitioned splits query into @param[in] partitions queries by
+  // hash of integer output column @param[in] partition_column, and runs them
+  // concurrently. Chunks are returned in order of partitions.
+  // NOTE: partitions run in separate sessions, they don't read a consistent
+  // snapshot if the data changes while they run. The adaptor must be owned
+  // by a std::shared_ptr.
+  std::unique_ptr<ChunkedResult> ExecQueryPartitioned(
+      const std::string& query, const std::vector<ColumnDesc>& expected_outputs,
+      const std::string& partition_column, int64_t partitions);
+
+ protected:
+  // max queries the adaptor could run at the same time, unlimited if <= 0.
+  virtual int64_t MaxConcurrentQueries() const { return 0; }
 };
 
+/// @brief split @param[in] query into @param[in] partitions queries, the i-th
+/// query selects rows whose @param[in] column % partitions is +/-i, rows whose
+/// column is null go to the first query.
+std::vector<std::string> PartitionQuery(const std::string& query,
+                                        const std::string& column,
+                                        int64_t partitions);
+
+/// @brief put @param[in] arrays of @param[in] type fetched from datasource
+/// into one tensor without concatenating them, arrays are cast one by one if
+/// @param[in] type mismatches @param[in] expected_type.
+TensorPtr ArraysToTensor(arrow::ArrayVector arrays,
+                         std::shared_ptr<arrow::DataType> type,
+                         pb::PrimitiveDataType expected_type);
+
+/// @brief fetch all chunks of @param[in] result and put chunks of the same
+/// column into one tensor without copying.
+/// @param[in] max_bytes max memory of the whole result, no limit if <= 0.
+/// @param[in] on_chunk called with memory of each chunk before the next one
+/// is fetched, reading stops if it throws.
+std::vector<TensorPtr> ReadAllChunks(
+    ChunkedResult* result, int64_t max_bytes = 0,
+    const std::function<void(int64_t)>& on_chunk = nullptr);
+
 }  // namespace scql::engine
\ No newline at end of file
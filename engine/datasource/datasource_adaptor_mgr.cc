@@ -17,29 +17,47 @@
 #include "yacl/base/exception.h"
 
 #include "engine/datasource/csvdb_adaptor_factory.h"
+#include "engine/datasource/flightsql_adaptor_factory.h"
 #include "engine/datasource/odbc_adaptor_factory.h"
 
+DEFINE_string(query_result_cache_dir, "",
+              "directory to cache RunSQL results as arrow ipc files, the "
+              "cache is disabled if empty");
+DEFINE_int64(query_result_cache_ttl_s, 300,
+             "seconds a cached RunSQL result is valid");
+DEFINE_int64(query_result_cache_max_bytes, 1024LL * 1024 * 1024,
+             "max bytes of all cached RunSQL results");
+DEFINE_int64(datasource_adaptor_idle_timeout_s, 3600,
+             "seconds an unused datasource adaptor is kept, e.g. a CSVDB "
+             "adaptor with its DuckDB tables, never released if <= 0");
+
 namespace scql::engine {
 
 DatasourceAdaptorMgr::DatasourceAdaptorMgr() {
   RegisterBuiltinAdaptorFactories();
+  if (!FLAGS_query_result_cache_dir.empty()) {
+    QueryResultCacheOptions options;
+    options.dir = FLAGS_query_result_cache_dir;
+    options.ttl = std::chrono::seconds(FLAGS_query_result_cache_ttl_s);
+    options.max_bytes = FLAGS_query_result_cache_max_bytes;
+    result_cache_ = std::make_unique<QueryResultCache>(std::move(options));
+  }
 }
 
 std::shared_ptr<DatasourceAdaptor> DatasourceAdaptorMgr::GetAdaptor(
     const DataSource& datasource_spec) {
-  // CSVDB may change frequently, so avoid to store in map.
-  if (datasource_spec.kind() == DataSourceKind::CSVDB) {
-    return CreateAdaptor(datasource_spec);
-  }
-
+  // NOTE: CSVDB adaptor is cached too, it re-parses csv files which change.
   auto spec_pair =
       std::pair(datasource_spec.connection_str(), datasource_spec.kind());
+  auto now = std::chrono::steady_clock::now();
   {
-    absl::ReaderMutexLock lock(&mu_);
+    absl::MutexLock lock(&mu_);
+    EvictIdleAdaptors(now);
 
     auto iter = adaptors_.find(spec_pair);
     if (iter != adaptors_.end()) {
-      return iter->second;
+      iter->second.last_used = now;
+      return iter->second.adaptor;
     }
   }
   // not existed, or datasource specification updated
@@ -49,11 +67,23 @@ std::shared_ptr<DatasourceAdaptor> DatasourceAdaptorMgr::GetAdaptor(
 
   {
     absl::MutexLock lock(&mu_);
-    adaptors_[spec_pair] = adaptor;
+    adaptors_[spec_pair] = CachedAdaptor{adaptor, now};
   }
   return adaptor;
 }
 
+void DatasourceAdaptorMgr::EvictIdleAdaptors(
+    std::chrono::steady_clock::time_point now) {
+  if (FLAGS_datasource_adaptor_idle_timeout_s <= 0) {
+    return;
+  }
+  auto timeout = std::chrono::seconds(FLAGS_datasource_adaptor_idle_timeout_s);
+  // adaptors still held by running sessions are released by the last one.
+  absl::erase_if(adaptors_, [&](const auto& item) {
+    return now - item.second.last_used > timeout;
+  });
+}
+
 std::shared_ptr<DatasourceAdaptor> DatasourceAdaptorMgr::CreateAdaptor(
     const DataSource& datasource_spec) {
   auto iter = factory_maps_.find(datasource_spec.kind());
@@ -68,6 +98,10 @@ void DatasourceAdaptorMgr::RegisterBuiltinAdaptorFactories() {
   auto odbc_adaptor_factory = std::make_shared<OdbcAdaptorFactory>();
   factory_maps_.insert({DataSourceKind::MYSQL, odbc_adaptor_factory});
   factory_maps_.insert({DataSourceKind::SQLITE, odbc_adaptor_factory});
+  factory_maps_.insert(
+      {DataSourceKind::CSVDB, std::make_shared<CsvdbAdaptorFactory>()});
+  factory_maps_.insert(
+      {DataSourceKind::FLIGHTSQL, std::make_shared<FlightSqlAdaptorFactory>()});
 }
 
 }  // namespace scql::engine
\ No newline at end of file
@@ -14,11 +14,17 @@
 
 #pragma once
 
+#include <chrono>
+
 #include "absl/container/flat_hash_map.h"
 #include "absl/synchronization/mutex.h"
 
 #include "engine/datasource/datasource_adaptor.h"
 #include "engine/datasource/datasource_adaptor_factory.h"
+#include "engine/datasource/query_result_cache.h"
+
+DECLARE_string(query_result_cache_dir);
+DECLARE_int64(datasource_adaptor_idle_timeout_s);
 
 namespace scql::engine {
 /// @brief Datasource Adaptor Manager
@@ -31,12 +37,26 @@ class DatasourceAdaptorMgr {
   std::shared_ptr<DatasourceAdaptor> GetAdaptor(
       const DataSource& datasource_spec);
 
+  /// @returns cache of query results shared by sessions, nullptr if
+  /// disabled.
+  QueryResultCache* GetQueryResultCache() const { return result_cache_.get(); }
+
  private:
   void RegisterBuiltinAdaptorFactories();
 
   std::shared_ptr<DatasourceAdaptor> CreateAdaptor(
       const DataSource& datasource_spec);
 
+  // removes adaptors not used for datasource_adaptor_idle_timeout_s, e.g.
+  // of datasources which are updated or removed from router.
+  // NOTE: mu_ should be held by caller
+  void EvictIdleAdaptors(std::chrono::steady_clock::time_point now);
+
+  struct CachedAdaptor {
+    std::shared_ptr<DatasourceAdaptor> adaptor;
+    std::chrono::steady_clock::time_point last_used;
+  };
+
   absl::flat_hash_map<DataSourceKind, std::shared_ptr<DatasourceAdaptorFactory>>
       factory_maps_;
 
@@ -44,9 +64,9 @@ class DatasourceAdaptorMgr {
   // following member variables are protected by `mu_`
 
   // datasource.connection_str + datasource.kind --> datasource adaptor
-  absl::flat_hash_map<std::pair<std::string, int>,
-                      std::shared_ptr<DatasourceAdaptor>>
-      adaptors_;
+  absl::flat_hash_map<std::pair<std::string, int>, CachedAdaptor> adaptors_;
+
+  std::unique_ptr<QueryResultCache> result_cache_;
 };
 
 }  // namespace scql::engine
\ No newline at end of file
@@ -14,7 +14,16 @@
 
 #include "engine/datasource/duckdb_wrapper.h"
 
+#include <algorithm>
+#include <unordered_map>
+
+#include "arrow/c/bridge.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/record_batch.h"
+#include "duckdb/common/arrow/arrow_wrapper.hpp"
 #include "duckdb/function/replacement_scan.hpp"
+#include "duckdb/function/table/arrow.hpp"
 #include "duckdb/function/table/read_csv.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/function_expression.hpp"
@@ -41,25 +50,117 @@ static duckdb::LogicalType ToLogicalType(csv::ColumnType type) {
   }
 }
 
+// ArrowIpcStreamFactory produces arrow streams of an arrow ipc file for
+// DuckDB's arrow scan, only the projected columns are read from the
+// memory-mapped file.
+struct ArrowIpcStreamFactory {
+  std::string path;
+
+  static arrow::Result<std::shared_ptr<arrow::ipc::RecordBatchFileReader>>
+  OpenReader(const std::string &path,
+             const std::vector<std::string> &columns) {
+    ARROW_ASSIGN_OR_RAISE(auto file, arrow::io::MemoryMappedFile::Open(
+                                         path, arrow::io::FileMode::READ));
+    auto options = arrow::ipc::IpcReadOptions::Defaults();
+    if (!columns.empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto reader,
+                            arrow::ipc::RecordBatchFileReader::Open(file));
+      for (const auto &column : columns) {
+        int index = reader->schema()->GetFieldIndex(column);
+        if (index < 0) {
+          return arrow::Status::Invalid(
+              fmt::format("column={} not found in {}", column, path));
+        }
+        options.included_fields.push_back(index);
+      }
+      // arrow reads included fields in order of schema.
+      std::sort(options.included_fields.begin(), options.included_fields.end());
+    }
+    return arrow::ipc::RecordBatchFileReader::Open(file, options);
+  }
+
+  static std::unique_ptr<duckdb::ArrowArrayStreamWrapper> Produce(
+      uintptr_t factory_ptr, duckdb::ArrowStreamParameters &parameters) {
+    auto factory = reinterpret_cast<ArrowIpcStreamFactory *>(factory_ptr);
+    auto reader = OpenReader(factory->path, parameters.projected_columns.second);
+    if (!reader.ok()) {
+      throw duckdb::IOException(reader.status().ToString());
+    }
+    // arrow reads columns in order of file schema, while duckdb expects them
+    // in order of projected columns.
+    auto schema = (*reader)->schema();
+    std::vector<int> order;
+    for (const auto &column : parameters.projected_columns.second) {
+      order.push_back(schema->GetFieldIndex(column));
+    }
+    if (!order.empty()) {
+      arrow::FieldVector fields;
+      for (int index : order) {
+        fields.push_back(schema->field(index));
+      }
+      schema = arrow::schema(std::move(fields));
+    }
+    arrow::RecordBatchVector batches;
+    for (int i = 0; i < (*reader)->num_record_batches(); ++i) {
+      // zero-copy since the file is memory-mapped.
+      auto batch = (*reader)->ReadRecordBatch(i);
+      if (batch.ok() && !order.empty()) {
+        batch = (*batch)->SelectColumns(order);
+      }
+      if (!batch.ok()) {
+        throw duckdb::IOException(batch.status().ToString());
+      }
+      batches.push_back(std::move(*batch));
+    }
+    auto batch_reader =
+        arrow::RecordBatchReader::Make(std::move(batches), std::move(schema));
+    auto wrapper = std::make_unique<duckdb::ArrowArrayStreamWrapper>();
+    wrapper->number_of_rows = -1;
+    if (!batch_reader.ok() ||
+        !arrow::ExportRecordBatchReader(*batch_reader,
+                                        &wrapper->arrow_array_stream)
+             .ok()) {
+      throw duckdb::IOException("export arrow stream of {} failed",
+                                factory->path);
+    }
+    return wrapper;
+  }
+
+  static void GetSchema(uintptr_t factory_ptr,
+                        duckdb::ArrowSchemaWrapper &schema) {
+    auto factory = reinterpret_cast<ArrowIpcStreamFactory *>(factory_ptr);
+    auto reader = OpenReader(factory->path, {});
+    if (!reader.ok() ||
+        !arrow::ExportSchema(*(*reader)->schema(), &schema.arrow_schema).ok()) {
+      throw duckdb::IOException("read arrow schema of {} failed",
+                                factory->path);
+    }
+  }
+};
+
 struct CSVTableReplacementScanData : public duckdb::ReplacementScanData {
-  const csv::CsvdbConf *csvdb_conf;
+  // a copy of conf, so the db doesn't depend on lifetime of the caller's conf
+  csv::CsvdbConf csvdb_conf;
+  // table name --> stream factory of arrow ipc table
+  std::unordered_map<std::string, std::unique_ptr<ArrowIpcStreamFactory>>
+      arrow_factories;
 };
 
 static std::unique_ptr<duckdb::TableFunctionRef> CSVTableReplacementScan(
     duckdb::ClientContext &context, const std::string &table_name,
     duckdb::ReplacementScanData *data) {
   auto scan_data = dynamic_cast<CSVTableReplacementScanData *>(data);
-  if (!scan_data || !scan_data->csvdb_conf) {
+  if (!scan_data) {
     return nullptr;
   }
 
   const csv::CsvTableConf *csv_tbl = nullptr;
-  for (int i = 0; i < scan_data->csvdb_conf->tables_size(); ++i) {
+  for (int i = 0; i < scan_data->csvdb_conf.tables_size(); ++i) {
     const std::string full_table_name =
-        fmt::format("{}.{}", scan_data->csvdb_conf->db_name(),
-                    scan_data->csvdb_conf->tables(i).table_name());
+        fmt::format("{}.{}", scan_data->csvdb_conf.db_name(),
+                    scan_data->csvdb_conf.tables(i).table_name());
     if (full_table_name == table_name) {
-      csv_tbl = &scan_data->csvdb_conf->tables(i);
+      csv_tbl = &scan_data->csvdb_conf.tables(i);
       break;
     }
   }
@@ -69,6 +170,29 @@ static std::unique_ptr<duckdb::TableFunctionRef> CSVTableReplacementScan(
 
   auto table_function = std::make_unique<duckdb::TableFunctionRef>();
   std::vector<std::unique_ptr<duckdb::ParsedExpression>> children;
+  if (csv_tbl->format() == csv::FileFormat::PARQUET) {
+    // DuckDB's parquet reader pushes down projection and filters, and skips
+    // row groups by statistics.
+    children.push_back(std::make_unique<duckdb::ConstantExpression>(
+        duckdb::Value(csv_tbl->data_path())));
+    table_function->function = std::make_unique<duckdb::FunctionExpression>(
+        "parquet_scan", std::move(children));
+    return table_function;
+  }
+  if (csv_tbl->format() == csv::FileFormat::ARROW) {
+    auto factory = scan_data->arrow_factories.at(table_name).get();
+    children.push_back(std::make_unique<duckdb::ConstantExpression>(
+        duckdb::Value::POINTER(reinterpret_cast<uintptr_t>(factory))));
+    children.push_back(
+        std::make_unique<duckdb::ConstantExpression>(duckdb::Value::POINTER(
+            reinterpret_cast<uintptr_t>(&ArrowIpcStreamFactory::Produce))));
+    children.push_back(
+        std::make_unique<duckdb::ConstantExpression>(duckdb::Value::POINTER(
+            reinterpret_cast<uintptr_t>(&ArrowIpcStreamFactory::GetSchema))));
+    table_function->function = std::make_unique<duckdb::FunctionExpression>(
+        "arrow_ipc_scan", std::move(children));
+    return table_function;
+  }
   children.push_back(std::make_unique<duckdb::ConstantExpression>(
       duckdb::Value(csv_tbl->data_path())));
   {
@@ -117,11 +241,52 @@ static std::unique_ptr<duckdb::FunctionData> CSVScanBind(
                                                           return_types, names);
 }
 
+// quote @param[in] str as sql string literal
+static std::string QuoteString(const std::string &str) {
+  std::string result = "'";
+  for (char c : str) {
+    if (c == '\'') {
+      result.push_back('\'');
+    }
+    result.push_back(c);
+  }
+  result.push_back('\'');
+  return result;
+}
+
+// quote @param[in] str as sql identifier
+static std::string QuoteIdentifier(const std::string &str) {
+  std::string result = "\"";
+  for (char c : str) {
+    if (c == '"') {
+      result.push_back('"');
+    }
+    result.push_back(c);
+  }
+  result.push_back('"');
+  return result;
+}
+
+static void QueryOrThrow(duckdb::Connection &conn, const std::string &sql) {
+  auto result = conn.Query(sql);
+  YACL_ENFORCE(!result->HasError(), "run {} in DuckDB failed, msg={}", sql,
+               result->GetError());
+}
+
 }  // namespace
 
 duckdb::DuckDB DuckDBWrapper::CreateDB(const csv::CsvdbConf *csvdb_conf) {
   auto scan_data = std::make_unique<CSVTableReplacementScanData>();
-  scan_data->csvdb_conf = csvdb_conf;
+  scan_data->csvdb_conf = *csvdb_conf;
+  for (const auto &tbl : csvdb_conf->tables()) {
+    if (tbl.format() == csv::FileFormat::ARROW) {
+      auto factory = std::make_unique<ArrowIpcStreamFactory>();
+      factory->path = tbl.data_path();
+      scan_data->arrow_factories[fmt::format(
+          "{}.{}", csvdb_conf->db_name(), tbl.table_name())] =
+          std::move(factory);
+    }
+  }
 
   duckdb::DBConfig config;
   config.replacement_scans.push_back(
@@ -148,7 +313,53 @@ void DuckDBWrapper::CreateCSVScanFunction(duckdb::Connection &conn) {
 
   duckdb::CreateTableFunctionInfo info(std::move(csv_scan));
   catalog.CreateTableFunction(context, &info);
+
+  // same as arrow_scan except that filters are not pushed down, since
+  // ArrowIpcStreamFactory only applies projection.
+  duckdb::TableFunction arrow_ipc_scan(
+      "arrow_ipc_scan",
+      {duckdb::LogicalType::POINTER, duckdb::LogicalType::POINTER,
+       duckdb::LogicalType::POINTER},
+      duckdb::ArrowTableFunction::ArrowScanFunction,
+      duckdb::ArrowTableFunction::ArrowScanBind,
+      duckdb::ArrowTableFunction::ArrowScanInitGlobal,
+      duckdb::ArrowTableFunction::ArrowScanInitLocal);
+  arrow_ipc_scan.projection_pushdown = true;
+  arrow_ipc_scan.filter_pushdown = false;
+  duckdb::CreateTableFunctionInfo arrow_info(std::move(arrow_ipc_scan));
+  catalog.CreateTableFunction(context, &arrow_info);
   return;
 }
 
+void DuckDBWrapper::CacheCSVTable(duckdb::Connection &conn,
+                                  const std::string &db_name,
+                                  const csv::CsvTableConf &csv_tbl) {
+  std::vector<std::string> types;
+  std::vector<std::string> names;
+  for (const auto &col : csv_tbl.columns()) {
+    types.push_back(QuoteString(ToLogicalType(col.column_type()).ToString()));
+    names.push_back(QuoteString(col.column_name()));
+  }
+  QueryOrThrow(conn, fmt::format("CREATE SCHEMA IF NOT EXISTS {}",
+                                 QuoteIdentifier(db_name)));
+  QueryOrThrow(
+      conn, fmt::format("CREATE OR REPLACE TABLE {}.{} AS SELECT * FROM "
+                        "csv_scan({}, [{}], [{}])",
+                        QuoteIdentifier(db_name),
+                        QuoteIdentifier(csv_tbl.table_name()),
+                        QuoteString(csv_tbl.data_path()),
+                        fmt::join(types, ","), fmt::join(names, ",")));
+}
+
+void DuckDBWrapper::DropCachedTable(duckdb::Connection &conn,
+                                    const std::string &full_table_name) {
+  auto pos = full_table_name.find('.');
+  YACL_ENFORCE(pos != std::string::npos, "invalid table name={}",
+               full_table_name);
+  QueryOrThrow(conn,
+               fmt::format("DROP TABLE IF EXISTS {}.{}",
+                           QuoteIdentifier(full_table_name.substr(0, pos)),
+                           QuoteIdentifier(full_table_name.substr(pos + 1))));
+}
+
 }  // namespace scql::engine
\ No newline at end of file
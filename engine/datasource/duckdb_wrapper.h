@@ -24,6 +24,8 @@ class DuckDBWrapper {
  public:
   static duckdb::DuckDB CreateDB(const csv::CsvdbConf* csvdb_conf);
 
+  // CreateCSVScanFunction registers table functions csv_scan and
+  // arrow_ipc_scan used by replacement scans of csv and arrow tables.
   // NOTE: This function must be called in an active transaction
   // For example:
   // ```cpp
@@ -32,6 +34,18 @@ class DuckDBWrapper {
   // conn.Commit();
   // ```
   static void CreateCSVScanFunction(duckdb::Connection& conn);
+
+  // CacheCSVTable parses the csv file of @param[in] csv_tbl into DuckDB table
+  // db_name.table_name, which shadows the csv replacement scan so that
+  // following queries read the columnar copy. It replaces the existing table.
+  static void CacheCSVTable(duckdb::Connection& conn,
+                            const std::string& db_name,
+                            const csv::CsvTableConf& csv_tbl);
+
+  // DropCachedTable drops table @param[in] full_table_name created by
+  // CacheCSVTable, so the csv replacement scan is used again.
+  static void DropCachedTable(duckdb::Connection& conn,
+                              const std::string& full_table_name);
 };
 
 }  // namespace scql::engine
\ No newline at end of file
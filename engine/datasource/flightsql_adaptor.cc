@@ -0,0 +1,294 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "engine/datasource/flightsql_adaptor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "absl/strings/str_split.h"
+#include "arrow/flight/client.h"
+#include "arrow/ipc/dictionary.h"
+#include "yacl/base/exception.h"
+
+#include "engine/core/arrow_helper.h"
+
+DEFINE_int32(flightsql_max_parallel_streams, 8,
+             "max endpoints of one Flight SQL result read in parallel");
+DEFINE_int32(flightsql_max_buffered_batches, 16,
+             "max record batches received from Flight SQL but not fetched yet");
+
+namespace scql::engine {
+
+namespace {
+
+namespace flight = arrow::flight;
+
+class FlightChunkedResult : public ChunkedResult {
+ public:
+  FlightChunkedResult(std::shared_ptr<flight::sql::FlightSqlClient> client,
+                      flight::FlightCallOptions call_options,
+                      std::unique_ptr<flight::FlightInfo> info,
+                      std::vector<ColumnDesc> expected_outputs)
+      : client_(std::move(client)),
+        call_options_(std::move(call_options)),
+        info_(std::move(info)),
+        expected_outputs_(std::move(expected_outputs)) {
+    arrow::ipc::DictionaryMemo memo;
+    ASSIGN_OR_THROW_ARROW_STATUS(schema_, info_->GetSchema(&memo));
+    YACL_ENFORCE_EQ(
+        schema_->num_fields(), expected_outputs_.size(),
+        "query result column size={} not equal to expected size={}",
+        schema_->num_fields(), expected_outputs_.size());
+
+    const auto& endpoints = info_->endpoints();
+    buffered_.resize(endpoints.size());
+    finished_.resize(endpoints.size(), false);
+    int workers = std::min<int>(
+        endpoints.size(), std::max(FLAGS_flightsql_max_parallel_streams, 1));
+    for (int i = 0; i < workers; ++i) {
+      workers_.emplace_back([this] { Consume(); });
+    }
+  }
+
+  ~FlightChunkedResult() override {
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      cancelled_ = true;
+      for (auto* reader : readers_) {
+        reader->Cancel();
+      }
+    }
+    cv_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  std::optional<std::vector<TensorPtr>> Fetch() override {
+    std::shared_ptr<arrow::RecordBatch> batch;
+    {
+      std::unique_lock<std::mutex> lock(mu_);
+      // emit batches in endpoint order, since the result may be ordered
+      while (true) {
+        bool advanced = false;
+        while (emitting_ < buffered_.size() && buffered_[emitting_].empty() &&
+               finished_[emitting_]) {
+          ++emitting_;
+          advanced = true;
+        }
+        if (!status_.ok() || emitting_ == buffered_.size() ||
+            !buffered_[emitting_].empty()) {
+          break;
+        }
+        if (advanced) {
+          // reader of the new emitting endpoint may wait for buffer space
+          cv_.notify_all();
+        }
+        cv_.wait(lock);
+      }
+      THROW_IF_ARROW_NOT_OK(status_);
+      if (emitting_ == buffered_.size()) {
+        if (fetched_any_) {
+          return std::nullopt;
+        }
+      } else {
+        batch = std::move(buffered_[emitting_].front());
+        buffered_[emitting_].pop_front();
+        --num_buffered_;
+      }
+      fetched_any_ = true;
+    }
+    cv_.notify_all();
+
+    std::vector<TensorPtr> tensors;
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      arrow::ArrayVector arrays;
+      auto type = schema_->field(i)->type();
+      if (batch) {
+        arrays.push_back(batch->column(i));
+        type = batch->column(i)->type();
+      }
+      tensors.push_back(ArraysToTensor(std::move(arrays), std::move(type),
+                                       expected_outputs_[i].dtype));
+    }
+    return tensors;
+  }
+
+ private:
+  // Consume reads endpoints one by one until all endpoints are taken.
+  void Consume() {
+    const auto& endpoints = info_->endpoints();
+    arrow::Status status;
+    for (size_t i = next_endpoint_++; i < endpoints.size() && status.ok();
+         i = next_endpoint_++) {
+      status = ConsumeEndpoint(i);
+    }
+    if (!status.ok()) {
+      {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (status_.ok() && !cancelled_) {
+          status_ = status;
+        }
+      }
+      cv_.notify_all();
+    }
+  }
+
+  arrow::Status ConsumeEndpoint(size_t index) {
+    const auto& endpoint = info_->endpoints()[index];
+    std::unique_ptr<flight::FlightClient> location_client;
+    std::unique_ptr<flight::FlightStreamReader> reader;
+    if (endpoint.locations.empty()) {
+      // the data is served by the same server as the query
+      ARROW_ASSIGN_OR_RAISE(reader,
+                            client_->DoGet(call_options_, endpoint.ticket));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(location_client,
+                            flight::FlightClient::Connect(endpoint.locations[0]));
+      ARROW_ASSIGN_OR_RAISE(
+          reader, location_client->DoGet(call_options_, endpoint.ticket));
+    }
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      if (cancelled_) {
+        return arrow::Status::Cancelled("result is destroyed");
+      }
+      readers_.push_back(reader.get());
+    }
+    auto status = ReadBatches(index, reader.get());
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      readers_.erase(std::find(readers_.begin(), readers_.end(), reader.get()));
+      // a failed endpoint is never finished, Fetch stops at it with status_
+      finished_[index] = status.ok();
+    }
+    cv_.notify_all();
+    return status;
+  }
+
+  arrow::Status ReadBatches(size_t index, flight::FlightStreamReader* reader) {
+    const size_t max_buffered =
+        std::max(FLAGS_flightsql_max_buffered_batches, 1);
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto chunk, reader->Next());
+      if (!chunk.data) {
+        return arrow::Status::OK();
+      }
+      std::unique_lock<std::mutex> lock(mu_);
+      // NOTE: the emitting endpoint is not blocked by batches of later
+      // endpoints, otherwise they wait for each other forever.
+      cv_.wait(lock, [&] {
+        return cancelled_ || !status_.ok() ||
+               (buffered_[index].size() < max_buffered &&
+                (index == emitting_ || num_buffered_ < max_buffered));
+      });
+      if (cancelled_ || !status_.ok()) {
+        return arrow::Status::Cancelled("stop reading flight stream");
+      }
+      buffered_[index].push_back(std::move(chunk.data));
+      ++num_buffered_;
+      lock.unlock();
+      cv_.notify_all();
+    }
+  }
+
+  std::shared_ptr<flight::sql::FlightSqlClient> client_;
+  const flight::FlightCallOptions call_options_;
+  std::unique_ptr<flight::FlightInfo> info_;
+  const std::vector<ColumnDesc> expected_outputs_;
+  std::shared_ptr<arrow::Schema> schema_;
+
+  std::atomic<size_t> next_endpoint_{0};
+  std::vector<std::thread> workers_;
+
+  std::mutex mu_;
+  std::condition_variable cv_;
+  // batches received but not fetched yet, per endpoint
+  std::vector<std::deque<std::shared_ptr<arrow::RecordBatch>>> buffered_;
+  size_t num_buffered_ = 0;
+  // whether all batches of the endpoint are received
+  std::vector<bool> finished_;
+  // index of the endpoint whose batches are fetched now
+  size_t emitting_ = 0;
+  std::vector<flight::FlightStreamReader*> readers_;
+  arrow::Status status_;
+  bool cancelled_ = false;
+  bool fetched_any_ = false;
+};
+
+// ParseConnectionStr splits connection_str into the server location and
+// options, e.g. "grpc+tcp://127.0.0.1:8815;user=alice;password=xxx".
+std::string ParseConnectionStr(const std::string& connection_str,
+                               std::map<std::string, std::string>* options) {
+  std::vector<std::string> parts = absl::StrSplit(connection_str, ';');
+  for (size_t i = 1; i < parts.size(); ++i) {
+    if (parts[i].empty()) {
+      continue;
+    }
+    std::vector<std::string> kv =
+        absl::StrSplit(parts[i], absl::MaxSplits('=', 1));
+    YACL_ENFORCE(kv.size() == 2 && (kv[0] == "user" || kv[0] == "password" ||
+                                    kv[0] == "token"),
+                 "invalid option '{}' in flight sql connection string, "
+                 "expect user=<user>, password=<password> or token=<token>",
+                 kv[0]);
+    (*options)[kv[0]] = kv[1];
+  }
+  return parts[0];
+}
+
+}  // namespace
+
+FlightSqlAdaptor::FlightSqlAdaptor(const std::string& connection_str) {
+  std::map<std::string, std::string> options;
+  auto uri = ParseConnectionStr(connection_str, &options);
+  flight::Location location;
+  ASSIGN_OR_THROW_ARROW_STATUS(location, flight::Location::Parse(uri));
+  std::unique_ptr<flight::FlightClient> client;
+  ASSIGN_OR_THROW_ARROW_STATUS(client, flight::FlightClient::Connect(location));
+
+  if (options.count("token") > 0) {
+    YACL_ENFORCE(options.count("user") == 0,
+                 "flight sql connection string has both user and token");
+    call_options_.headers.emplace_back("authorization",
+                                       "Bearer " + options["token"]);
+  } else if (options.count("user") > 0) {
+    // exchange user and password for a bearer token by basic auth
+    std::pair<std::string, std::string> bearer;
+    ASSIGN_OR_THROW_ARROW_STATUS(
+        bearer, client->AuthenticateBasicToken(call_options_, options["user"],
+                                               options["password"]));
+    if (!bearer.first.empty()) {
+      call_options_.headers.push_back(std::move(bearer));
+    }
+  }
+  client_ = std::make_shared<flight::sql::FlightSqlClient>(std::move(client));
+}
+
+std::unique_ptr<ChunkedResult> FlightSqlAdaptor::ExecQueryChunked(
+    const std::string& query, const std::vector<ColumnDesc>& expected_outputs) {
+  std::unique_ptr<flight::FlightInfo> info;
+  ASSIGN_OR_THROW_ARROW_STATUS(info, client_->Execute(call_options_, query));
+  return std::make_unique<FlightChunkedResult>(client_, call_options_,
+                                               std::move(info),
+                                               expected_outputs);
+}
+
+}  // namespace scql::engine
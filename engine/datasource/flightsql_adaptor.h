@@ -0,0 +1,50 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/flight/sql/client.h"
+
+#include "engine/datasource/datasource_adaptor.h"
+
+namespace scql::engine {
+
+DECLARE_int32(flightsql_max_parallel_streams);
+
+/// @brief FlightSqlAdaptor runs queries over Arrow Flight SQL. Endpoints of
+/// a query result are read in parallel, and the record batches become tensor
+/// chunks as they are, in endpoint order.
+class FlightSqlAdaptor : public DatasourceAdaptor {
+ public:
+  /// @param[in] connection_str location of the Flight SQL server, e.g.
+  /// grpc+tcp://127.0.0.1:8815 or grpc+tls://example.com:443, optionally
+  /// followed by credentials: ";user=<user>;password=<password>" for basic
+  /// auth or ";token=<token>" for a bearer token.
+  explicit FlightSqlAdaptor(const std::string& connection_str);
+
+  ~FlightSqlAdaptor() = default;
+
+  std::unique_ptr<ChunkedResult> ExecQueryChunked(
+      const std::string& query,
+      const std::vector<ColumnDesc>& expected_outputs) override;
+
+ private:
+  std::shared_ptr<arrow::flight::sql::FlightSqlClient> client_;
+  // carries the authorization header of every call
+  arrow::flight::FlightCallOptions call_options_;
+};
+
+}  // namespace scql::engine
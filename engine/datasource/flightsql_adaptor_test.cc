@@ -0,0 +1,123 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "engine/datasource/flightsql_adaptor.h"
+
+#include "arrow/flight/sql/example/sqlite_server.h"
+#include "gtest/gtest.h"
+
+#include "engine/core/tensor_from_json.h"
+
+namespace scql::engine {
+
+class FlightSqlAdaptorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto server = arrow::flight::sql::example::SQLiteFlightSqlServer::Create();
+    ASSERT_TRUE(server.ok()) << server.status().ToString();
+    server_ = std::move(*server);
+    auto location = arrow::flight::Location::ForGrpcTcp("127.0.0.1", 0);
+    ASSERT_TRUE(location.ok());
+    ASSERT_TRUE(
+        server_->Init(arrow::flight::FlightServerOptions(*location)).ok());
+    ASSERT_TRUE(server_
+                    ->ExecuteSql(R"sql(
+CREATE TABLE staff (id INTEGER, age INTEGER, name TEXT);
+INSERT INTO staff VALUES (1, 21, 'alice'), (2, 42, 'bob'),
+                         (3, 19, 'carol'), (4, 32, 'dave');
+)sql")
+                    .ok());
+    uri_ = fmt::format("grpc+tcp://127.0.0.1:{}", server_->port());
+  }
+
+  void TearDown() override { EXPECT_TRUE(server_->Shutdown().ok()); }
+
+  void CheckTensorEqual(TensorPtr left, TensorPtr right) {
+    auto left_arr = left->ToArrowChunkedArray();
+    auto right_arr = right->ToArrowChunkedArray();
+    EXPECT_TRUE(left_arr->Equals(*right_arr))
+        << "left = " << left_arr->ToString()
+        << "\nright = " << right_arr->ToString();
+  }
+
+  std::shared_ptr<arrow::flight::sql::example::SQLiteFlightSqlServer> server_;
+  std::string uri_;
+};
+
+TEST_F(FlightSqlAdaptorTest, QueryWithPredicate) {
+  // Given
+  FlightSqlAdaptor adaptor(uri_);
+  std::vector<ColumnDesc> outputs{{"age", pb::PrimitiveDataType::INT64},
+                                  {"name", pb::PrimitiveDataType::STRING}};
+
+  // When
+  auto results = adaptor.ExecQuery(
+      "select age, name from staff where age > 30 order by id", outputs);
+
+  // Then
+  ASSERT_EQ(results.size(), 2);
+  CheckTensorEqual(results[0], TensorFromJSON(arrow::int64(), "[42,32]"));
+  CheckTensorEqual(results[1],
+                   TensorFromJSON(arrow::utf8(), R"json(["bob","dave"])json"));
+}
+
+TEST_F(FlightSqlAdaptorTest, EmptyResult) {
+  // Given
+  FlightSqlAdaptor adaptor(uri_);
+  std::vector<ColumnDesc> outputs{{"id", pb::PrimitiveDataType::INT64}};
+
+  // When
+  auto result = adaptor.ExecQueryChunked(
+      "select id from staff where age > 100", outputs);
+
+  // Then
+  auto chunk = result->Fetch();
+  ASSERT_TRUE(chunk.has_value());
+  EXPECT_EQ((*chunk)[0]->Length(), 0);
+  EXPECT_FALSE(result->Fetch().has_value());
+}
+
+TEST_F(FlightSqlAdaptorTest, DestroyResultBeforeFetched) {
+  // Given
+  gflags::FlagSaver saver;
+  FLAGS_flightsql_max_parallel_streams = 1;
+  FlightSqlAdaptor adaptor(uri_);
+  std::vector<ColumnDesc> outputs{{"id", pb::PrimitiveDataType::INT64}};
+
+  // When
+  auto result = adaptor.ExecQueryChunked("select id from staff", outputs);
+
+  // Then the reading stream is cancelled without hanging
+  EXPECT_NO_THROW(result.reset());
+}
+
+TEST_F(FlightSqlAdaptorTest, ConnectionStrWithCredentials) {
+  // Given the example server ignores the authorization header
+  FlightSqlAdaptor adaptor(uri_ + ";token=secret");
+  std::vector<ColumnDesc> outputs{{"id", pb::PrimitiveDataType::INT64}};
+
+  // When
+  auto results = adaptor.ExecQuery("select id from staff where age > 40",
+                                   outputs);
+
+  // Then
+  ASSERT_EQ(results.size(), 1);
+  CheckTensorEqual(results[0], TensorFromJSON(arrow::int64(), "[2]"));
+  EXPECT_THROW(FlightSqlAdaptor(uri_ + ";db=staff"), yacl::EnforceNotMet);
+  EXPECT_THROW(FlightSqlAdaptor(uri_ + ";user=alice;token=secret"),
+               yacl::EnforceNotMet);
+}
+
+}  // namespace scql::engine
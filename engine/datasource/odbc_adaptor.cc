@@ -14,7 +14,9 @@
 
 #include "engine/datasource/odbc_adaptor.h"
 
+#include <deque>
 #include <mutex>
+#include <type_traits>
 
 #include "Poco/Data/MySQL/Connector.h"
 #ifdef ENABLE_POSTGRESQL
@@ -23,6 +25,8 @@
 #include "Poco/Data/MetaColumn.h"
 #include "Poco/Data/RecordSet.h"
 #include "Poco/Data/SQLite/Connector.h"
+#include "Poco/UnicodeConverter.h"
+#include "spdlog/spdlog.h"
 #include "yacl/base/exception.h"
 
 #include "engine/core/primitive_builder.h"
@@ -30,45 +34,18 @@
 
 namespace scql::engine {
 
+DEFINE_int64(odbc_fetch_batch_rows, 64 * 1024,
+             "max rows fetched from odbc datasource per batch, all rows are "
+             "fetched at once if <= 0");
+
 namespace {
 std::once_flag mysql_register_flag;
-}
-
-OdbcAdaptor::OdbcAdaptor(OdbcAdaptorOptions options)
-    : options_(std::move(options)), pool_(nullptr) {
-  try {
-    Init();
-  } catch (const Poco::Data::DataException& e) {
-    // NOTE: Poco Exception's what() method only return the exception category
-    // without detail information, so we rethrow it with displayText() method.
-    // https://docs.pocoproject.org/current/Poco.Exception.html#13533
-    YACL_THROW("catch unexpected Poco::Data::DataException: {}",
-               e.displayText());
-  }
-}
-
-std::vector<TensorPtr> OdbcAdaptor::ExecQuery(
-    const std::string& query, const std::vector<ColumnDesc>& expected_outputs) {
-  std::vector<TensorPtr> result;
-  try {
-    result = ExecQueryImpl(query, expected_outputs);
-  } catch (const Poco::Data::DataException& e) {
-    YACL_THROW("catch unexpected Poco::Data::DataException: {}",
-               e.displayText());
-  }
-  return result;
-}
-
-std::vector<TensorPtr> OdbcAdaptor::ExecQueryImpl(
-    const std::string& query, const std::vector<ColumnDesc>& expected_outputs) {
-  auto session = CreateSession();
-
-  Poco::Data::Statement select(session);
-  select << query;
-  select.execute();
 
-  Poco::Data::RecordSet rs(select);
+using Poco::Data::MetaColumn;
 
+std::vector<std::unique_ptr<TensorBuilder>> CreateBuilders(
+    const Poco::Data::RecordSet& rs,
+    const std::vector<ColumnDesc>& expected_outputs) {
   // check amount of columns
   std::size_t column_cnt = rs.columnCount();
   if (column_cnt != expected_outputs.size()) {
@@ -77,8 +54,6 @@ std::vector<TensorPtr> OdbcAdaptor::ExecQueryImpl(
   }
 
   // TODO(shunde.csd): check output data type
-  using Poco::Data::MetaColumn;
-
   std::vector<std::unique_ptr<TensorBuilder>> builders;
   for (std::size_t i = 0; i < column_cnt; ++i) {
     std::unique_ptr<TensorBuilder> builder;
@@ -103,7 +78,11 @@ std::vector<TensorPtr> OdbcAdaptor::ExecQueryImpl(
         break;
       case MetaColumn::ColumnDataType::FDT_STRING:
       case MetaColumn::ColumnDataType::FDT_WSTRING:
-        builder = std::make_unique<StringTensorBuilder>();
+        if (FLAGS_datasource_dictionary_encode_string) {
+          builder = std::make_unique<StringDictionaryTensorBuilder>();
+        } else {
+          builder = std::make_unique<StringTensorBuilder>();
+        }
         break;
       default:
         YACL_THROW("unsupported Poco::Data::MetaColumn::ColumnDataType {}",
@@ -111,63 +90,258 @@ std::vector<TensorPtr> OdbcAdaptor::ExecQueryImpl(
     }
     builders.push_back(std::move(builder));
   }
+  return builders;
+}
 
-  for (auto it = rs.begin(); it != rs.end(); ++it) {
-    auto& row = *it;
-    for (std::size_t col_index = 0; col_index < column_cnt; col_index++) {
-      auto& var = row[col_index];
-      if (var.isEmpty()) {
-        builders[col_index]->AppendNull();
-        continue;
-      }
+// internal extractions are reset before each execute, but fetched rows are
+// taken from the tail anyway in case poco appends them.
+template <typename C>
+std::size_t FirstFetchedRow(const Poco::Data::Column<C>& column,
+                            std::size_t fetched) {
+  return column.rowCount() - std::min(fetched, column.rowCount());
+}
 
-      switch (rs.columnType(col_index)) {
-        case MetaColumn::ColumnDataType::FDT_BOOL: {
-          BooleanTensorBuilder* builder =
-              static_cast<BooleanTensorBuilder*>(builders[col_index].get());
-          builder->Append(var.convert<bool>());
-          break;
-        }
-        case MetaColumn::ColumnDataType::FDT_INT8:
-        case MetaColumn::ColumnDataType::FDT_UINT8:
-        case MetaColumn::ColumnDataType::FDT_INT16:
-        case MetaColumn::ColumnDataType::FDT_UINT16:
-        case MetaColumn::ColumnDataType::FDT_INT32:
-        case MetaColumn::ColumnDataType::FDT_UINT32:
-        case MetaColumn::ColumnDataType::FDT_INT64:
-        case MetaColumn::ColumnDataType::FDT_UINT64: {
-          Int64TensorBuilder* builder =
-              static_cast<Int64TensorBuilder*>(builders[col_index].get());
-          builder->Append(var.convert<int64_t>());
-          break;
-        }
-        case MetaColumn::ColumnDataType::FDT_STRING:
-        case MetaColumn::ColumnDataType::FDT_WSTRING: {
-          StringTensorBuilder* builder =
-              static_cast<StringTensorBuilder*>(builders[col_index].get());
-          builder->Append(var.convert<std::string>());
-          break;
-        }
-        case MetaColumn::ColumnDataType::FDT_FLOAT:
-        case MetaColumn::ColumnDataType::FDT_DOUBLE: {
-          DoubleTensorBuilder* builder =
-              static_cast<DoubleTensorBuilder*>(builders[col_index].get());
-          builder->Append(var.convert<double>());
-          break;
-        }
-        default:
-          YACL_THROW("unsupported Poco::Data::MetaColumn::ColumnDataType {}",
-                     rs.columnType(col_index));
+// append fetched rows of numeric column @param[in] col, which poco extracts
+// into std::deque<T>, to builder in one call.
+template <typename T, typename BuilderT>
+void AppendNumericColumn(const Poco::Data::RecordSet& rs, std::size_t col,
+                         std::size_t fetched, TensorBuilder* builder) {
+  using value_type = typename BuilderT::value_type;
+  const auto& column = rs.column<std::deque<T>>(col);
+  const std::size_t begin = FirstFetchedRow(column, fetched);
+  const std::size_t length = column.rowCount() - begin;
+  std::vector<value_type> values(length);
+  std::vector<uint8_t> valid_bytes(length);
+  for (std::size_t i = 0; i < length; ++i) {
+    valid_bytes[i] = !rs.isNull(col, begin + i);
+    values[i] = static_cast<value_type>(column.value(begin + i));
+  }
+  static_cast<BuilderT*>(builder)->AppendValues(values.data(), length,
+                                                valid_bytes.data());
+}
+
+template <typename T, typename BuilderT>
+void AppendColumnByRow(const Poco::Data::RecordSet& rs, std::size_t col,
+                       std::size_t fetched, TensorBuilder* builder) {
+  auto* typed_builder = static_cast<BuilderT*>(builder);
+  const auto& column = rs.column<std::deque<T>>(col);
+  const std::size_t begin = FirstFetchedRow(column, fetched);
+  typed_builder->Reserve(column.rowCount() - begin);
+  for (std::size_t row = begin; row < column.rowCount(); ++row) {
+    if (rs.isNull(col, row)) {
+      typed_builder->AppendNull();
+    } else if constexpr (std::is_same_v<T, Poco::UTF16String>) {
+      std::string utf8;
+      Poco::UnicodeConverter::convert(column.value(row), utf8);
+      typed_builder->Append(utf8);
+    } else {
+      typed_builder->Append(column.value(row));
+    }
+  }
+}
+
+template <typename T>
+void AppendStringColumn(const Poco::Data::RecordSet& rs, std::size_t col,
+                        std::size_t fetched, TensorBuilder* builder) {
+  if (FLAGS_datasource_dictionary_encode_string) {
+    AppendColumnByRow<T, StringDictionaryTensorBuilder>(rs, col, fetched,
+                                                        builder);
+  } else {
+    AppendColumnByRow<T, StringTensorBuilder>(rs, col, fetched, builder);
+  }
+}
+
+// append the @param[in] fetched rows of column @param[in] col to
+// @param[in] builder. Values are read from poco's typed column directly
+// instead of converting each cell by Poco::Dynamic::Var.
+void AppendColumn(const Poco::Data::RecordSet& rs, std::size_t col,
+                  std::size_t fetched, TensorBuilder* builder) {
+  switch (rs.columnType(col)) {
+    case MetaColumn::ColumnDataType::FDT_BOOL:
+      AppendColumnByRow<bool, BooleanTensorBuilder>(rs, col, fetched, builder);
+      break;
+    case MetaColumn::ColumnDataType::FDT_INT8:
+      AppendNumericColumn<Poco::Int8, Int64TensorBuilder>(rs, col, fetched,
+                                                          builder);
+      break;
+    case MetaColumn::ColumnDataType::FDT_UINT8:
+      AppendNumericColumn<Poco::UInt8, Int64TensorBuilder>(rs, col, fetched,
+                                                           builder);
+      break;
+    case MetaColumn::ColumnDataType::FDT_INT16:
+      AppendNumericColumn<Poco::Int16, Int64TensorBuilder>(rs, col, fetched,
+                                                           builder);
+      break;
+    case MetaColumn::ColumnDataType::FDT_UINT16:
+      AppendNumericColumn<Poco::UInt16, Int64TensorBuilder>(rs, col, fetched,
+                                                            builder);
+      break;
+    case MetaColumn::ColumnDataType::FDT_INT32:
+      AppendNumericColumn<Poco::Int32, Int64TensorBuilder>(rs, col, fetched,
+                                                           builder);
+      break;
+    case MetaColumn::ColumnDataType::FDT_UINT32:
+      AppendNumericColumn<Poco::UInt32, Int64TensorBuilder>(rs, col, fetched,
+                                                            builder);
+      break;
+    case MetaColumn::ColumnDataType::FDT_INT64:
+      AppendNumericColumn<Poco::Int64, Int64TensorBuilder>(rs, col, fetched,
+                                                           builder);
+      break;
+    case MetaColumn::ColumnDataType::FDT_UINT64:
+      AppendNumericColumn<Poco::UInt64, Int64TensorBuilder>(rs, col, fetched,
+                                                            builder);
+      break;
+    case MetaColumn::ColumnDataType::FDT_FLOAT:
+      AppendNumericColumn<float, DoubleTensorBuilder>(rs, col, fetched,
+                                                      builder);
+      break;
+    case MetaColumn::ColumnDataType::FDT_DOUBLE:
+      AppendNumericColumn<double, DoubleTensorBuilder>(rs, col, fetched,
+                                                       builder);
+      break;
+    case MetaColumn::ColumnDataType::FDT_STRING:
+      AppendStringColumn<std::string>(rs, col, fetched, builder);
+      break;
+    case MetaColumn::ColumnDataType::FDT_WSTRING:
+      AppendStringColumn<Poco::UTF16String>(rs, col, fetched, builder);
+      break;
+    default:
+      YACL_THROW("unsupported Poco::Data::MetaColumn::ColumnDataType {}",
+                 rs.columnType(col));
+  }
+}
+
+// OdbcChunkedResult fetches odbc_fetch_batch_rows rows per chunk. PostgreSQL
+// query runs in a server-side cursor, other databases rely on poco's limit to
+// fetch rows incrementally.
+class OdbcChunkedResult : public ChunkedResult {
+ public:
+  OdbcChunkedResult(Poco::Data::Session session, DataSourceKind kind,
+                    const std::string& query,
+                    std::vector<ColumnDesc> expected_outputs)
+      : session_(std::move(session)),
+        expected_outputs_(std::move(expected_outputs)),
+        use_cursor_(kind == DataSourceKind::POSTGRESQL) {
+    if (use_cursor_) {
+      session_.begin();
+      session_ << fmt::format("DECLARE {} NO SCROLL CURSOR FOR {}",
+                              kCursorName, query),
+          Poco::Data::Keywords::now;
+      return;
+    }
+    select_ = std::make_unique<Poco::Data::Statement>(session_);
+    if (FLAGS_odbc_fetch_batch_rows > 0) {
+      *select_ << query, Poco::Data::Keywords::limit(static_cast<Poco::UInt32>(
+                             FLAGS_odbc_fetch_batch_rows));
+    } else {
+      *select_ << query;
+    }
+    // typed columns are read as std::deque<T>.
+    select_->setStorage(Poco::Data::StatementImpl::DEQUE);
+  }
+
+  ~OdbcChunkedResult() override {
+    if (use_cursor_ && !done_) {
+      try {
+        session_.rollback();
+      } catch (const Poco::Exception& e) {
+        SPDLOG_WARN("rollback cursor failed: {}", e.displayText());
       }
     }
   }
 
-  std::vector<TensorPtr> results(column_cnt);
-  for (std::size_t i = 0; i < column_cnt; ++i) {
-    builders[i]->Finish(&results[i]);
+  std::optional<std::vector<TensorPtr>> Fetch() override {
+    if (done_) {
+      return std::nullopt;
+    }
+    try {
+      return use_cursor_ ? FetchFromCursor() : FetchFromStatement();
+    } catch (const Poco::Data::DataException& e) {
+      YACL_THROW("catch unexpected Poco::Data::DataException: {}",
+                 e.displayText());
+    }
   }
 
-  return results;
+ private:
+  static constexpr char kCursorName[] = "scql_cursor";
+
+  std::vector<TensorPtr> FetchFromStatement() {
+    std::size_t fetched = select_->execute();
+    done_ = select_->done();
+    Poco::Data::RecordSet rs(*select_);
+    return BuildChunk(rs, fetched);
+  }
+
+  std::vector<TensorPtr> FetchFromCursor() {
+    Poco::Data::Statement select(session_);
+    if (FLAGS_odbc_fetch_batch_rows > 0) {
+      select << fmt::format("FETCH FORWARD {} FROM {}",
+                            FLAGS_odbc_fetch_batch_rows, kCursorName);
+    } else {
+      select << fmt::format("FETCH ALL FROM {}", kCursorName);
+    }
+    select.setStorage(Poco::Data::StatementImpl::DEQUE);
+    std::size_t fetched = select.execute();
+    Poco::Data::RecordSet rs(select);
+    auto chunk = BuildChunk(rs, fetched);
+    if (FLAGS_odbc_fetch_batch_rows <= 0 ||
+        fetched < static_cast<std::size_t>(FLAGS_odbc_fetch_batch_rows)) {
+      session_ << fmt::format("CLOSE {}", kCursorName),
+          Poco::Data::Keywords::now;
+      session_.commit();
+      done_ = true;
+    }
+    return chunk;
+  }
+
+  std::vector<TensorPtr> BuildChunk(const Poco::Data::RecordSet& rs,
+                                    std::size_t fetched) {
+    auto builders = CreateBuilders(rs, expected_outputs_);
+    std::vector<TensorPtr> chunk(builders.size());
+    for (std::size_t i = 0; i < builders.size(); ++i) {
+      AppendColumn(rs, i, fetched, builders[i].get());
+      builders[i]->Finish(&chunk[i]);
+    }
+    return chunk;
+  }
+
+  Poco::Data::Session session_;
+  const std::vector<ColumnDesc> expected_outputs_;
+  const bool use_cursor_;
+  std::unique_ptr<Poco::Data::Statement> select_;
+  bool done_ = false;
+};
+
+}  // namespace
+
+OdbcAdaptor::OdbcAdaptor(OdbcAdaptorOptions options)
+    : options_(std::move(options)), pool_(nullptr) {
+  try {
+    Init();
+  } catch (const Poco::Data::DataException& e) {
+    // NOTE: Poco Exception's what() method only return the exception category
+    // without detail information, so we rethrow it with displayText() method.
+    // https://docs.pocoproject.org/current/Poco.Exception.html#13533
+    YACL_THROW("catch unexpected Poco::Data::DataException: {}",
+               e.displayText());
+  }
+}
+
+std::unique_ptr<ChunkedResult> OdbcAdaptor::ExecQueryChunked(
+    const std::string& query, const std::vector<ColumnDesc>& expected_outputs) {
+  try {
+    return std::make_unique<OdbcChunkedResult>(CreateSession(), options_.kind,
+                                               query, expected_outputs);
+  } catch (const Poco::Data::DataException& e) {
+    YACL_THROW("catch unexpected Poco::Data::DataException: {}",
+               e.displayText());
+  }
+}
+
+int64_t OdbcAdaptor::MaxConcurrentQueries() const {
+  // pool_->get() throws once all sessions of the pool are in use.
+  return pool_ ? static_cast<int64_t>(options_.pool_size) : 0;
 }
 
 Poco::Data::Session OdbcAdaptor::CreateSession() {
@@ -25,6 +25,8 @@
 
 namespace scql::engine {
 
+DECLARE_int64(odbc_fetch_batch_rows);
+
 struct OdbcAdaptorOptions {
   DataSourceKind kind;
   std::string connection_str;
@@ -43,17 +45,16 @@ class OdbcAdaptor : public DatasourceAdaptor {
   explicit OdbcAdaptor(OdbcAdaptorOptions options);
   ~OdbcAdaptor() = default;
 
-  std::vector<TensorPtr> ExecQuery(
+  std::unique_ptr<ChunkedResult> ExecQueryChunked(
       const std::string& query,
       const std::vector<ColumnDesc>& expected_outputs) override;
 
+ protected:
+  int64_t MaxConcurrentQueries() const override;
+
  private:
   void Init();
 
-  std::vector<TensorPtr> ExecQueryImpl(
-      const std::string& query,
-      const std::vector<ColumnDesc>& expected_outputs);
-
   // Returns a session from session pool if using pooled session,
   // Otherwise, creates a new session.
   Poco::Data::Session CreateSession();
@@ -0,0 +1,117 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "Poco/Data/RecordSet.h"
+#include "Poco/Data/SQLite/Connector.h"
+#include "benchmark/benchmark.h"
+#include "fmt/format.h"
+
+#include "engine/core/primitive_builder.h"
+#include "engine/core/string_tensor_builder.h"
+#include "engine/datasource/odbc_adaptor.h"
+
+namespace scql::engine {
+namespace {
+
+// same table as odbc_adaptor_sqlite_test, filled with more rows.
+class PersonTable {
+ public:
+  explicit PersonTable(int64_t rows)
+      : db_connection_str_(
+            fmt::format("file:obdc_adaptor_benchmark_{}?mode=memory&cache=shared",
+                        rows)) {
+    Poco::Data::SQLite::Connector::registerConnector();
+    session_ =
+        std::make_unique<Poco::Data::Session>("SQLite", db_connection_str_);
+
+    using Poco::Data::Keywords::now;
+    *session_
+        << "CREATE TABLE person(name VARCHAR(30), age INTEGER(3), credit REAL)",
+        now;
+    *session_ << "BEGIN", now;
+    for (int64_t i = 0; i < rows; ++i) {
+      *session_ << fmt::format("INSERT INTO person VALUES(\"name{}\", {}, {})",
+                               i, i % 100, i * 0.5),
+          now;
+    }
+    *session_ << "COMMIT", now;
+  }
+
+  const std::string& connection_str() const { return db_connection_str_; }
+
+ private:
+  std::string db_connection_str_;
+  std::unique_ptr<Poco::Data::Session> session_;
+};
+
+const std::string kQuery = "SELECT name, age, credit FROM person";
+
+// baseline: fetch all rows at once and convert each cell by
+// Poco::Dynamic::Var, which is what OdbcAdaptor used to do.
+void BM_ExecQueryByVar(benchmark::State& state) {
+  PersonTable table(state.range(0));
+  for (auto _ : state) {
+    Poco::Data::Session session("sqlite", table.connection_str());
+    Poco::Data::Statement select(session);
+    select << kQuery;
+    select.execute();
+    Poco::Data::RecordSet rs(select);
+
+    StringTensorBuilder names;
+    Int64TensorBuilder ages;
+    DoubleTensorBuilder credits;
+    for (auto it = rs.begin(); it != rs.end(); ++it) {
+      auto& row = *it;
+      names.Append(row[0].convert<std::string>());
+      ages.Append(row[1].convert<int64_t>());
+      credits.Append(row[2].convert<double>());
+    }
+    TensorPtr result;
+    names.Finish(&result);
+    ages.Finish(&result);
+    credits.Finish(&result);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ExecQuery(benchmark::State& state) {
+  PersonTable table(state.range(0));
+  FLAGS_odbc_fetch_batch_rows = state.range(1);
+  OdbcAdaptorOptions options;
+  options.kind = DataSourceKind::SQLITE;
+  options.connection_str = table.connection_str();
+  options.connection_type = ConnectionType::Short;
+  OdbcAdaptor adaptor(options);
+  std::vector<ColumnDesc> outputs{{"name", pb::PrimitiveDataType::STRING},
+                                  {"age", pb::PrimitiveDataType::INT64},
+                                  {"credit", pb::PrimitiveDataType::DOUBLE}};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(adaptor.ExecQuery(kQuery, outputs));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+constexpr int64_t kRows = 1 << 18;
+
+BENCHMARK(BM_ExecQueryByVar)->Arg(kRows)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ExecQuery)
+    ->Args({kRows, 0})
+    ->Args({kRows, 4 * 1024})
+    ->Args({kRows, 64 * 1024})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace scql::engine
@@ -13,12 +13,25 @@
 // limitations under the License.
 
 #include "Poco/Data/SQLite/Connector.h"
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "gtest/gtest.h"
+#include "yacl/base/exception.h"
 
 #include "engine/datasource/odbc_adaptor.h"
 
 namespace scql::engine {
 
+namespace {
+
+std::shared_ptr<arrow::Array> Concatenate(const TensorPtr& tensor) {
+  auto result = arrow::Concatenate(tensor->ToArrowChunkedArray()->chunks());
+  EXPECT_TRUE(result.ok());
+  return *result;
+}
+
+}  // namespace
+
 class OdbcAdaptorSQLiteTest : public ::testing::Test {
  protected:
   void SetUp() override {
@@ -78,4 +91,110 @@ TEST_F(OdbcAdaptorSQLiteTest, works) {
   EXPECT_EQ(results[2]->GetNullCount(), 1);
 }
 
-}  // namespace scql::engine
\ No newline at end of file
+TEST_F(OdbcAdaptorSQLiteTest, fetchInBatches) {
+  // Given
+  gflags::FlagSaver saver;
+  FLAGS_odbc_fetch_batch_rows = 3;
+  OdbcAdaptorOptions options;
+  options.kind = DataSourceKind::SQLITE;
+  options.connection_str = db_connection_str_;
+  options.connection_type = ConnectionType::Short;
+
+  OdbcAdaptor adaptor(options);
+
+  // When
+  const std::string query = "SELECT name, age, credit FROM person";
+  std::vector<ColumnDesc> outputs{{"name", pb::PrimitiveDataType::STRING},
+                                  {"age", pb::PrimitiveDataType::INT32},
+                                  {"credit", pb::PrimitiveDataType::DOUBLE}};
+
+  auto results = adaptor.ExecQuery(query, outputs);
+
+  // Then
+  ASSERT_EQ(results.size(), 3);
+  auto names = std::dynamic_pointer_cast<arrow::StringArray>(
+      Concatenate(results[0]));
+  ASSERT_EQ(names->length(), 4);
+  EXPECT_EQ(names->GetString(0), "alice");
+  EXPECT_EQ(names->GetString(2), "carol");
+  EXPECT_TRUE(names->IsNull(3));
+
+  auto ages = std::dynamic_pointer_cast<arrow::Int64Array>(
+      Concatenate(results[1]));
+  ASSERT_EQ(ages->length(), 4);
+  EXPECT_EQ(ages->Value(0), 18);
+  EXPECT_EQ(ages->Value(1), 20);
+  EXPECT_TRUE(ages->IsNull(2));
+  EXPECT_TRUE(ages->IsNull(3));
+
+  auto credits = std::dynamic_pointer_cast<arrow::DoubleArray>(
+      Concatenate(results[2]));
+  ASSERT_EQ(credits->length(), 4);
+  EXPECT_DOUBLE_EQ(credits->Value(0), 675.0);
+  EXPECT_DOUBLE_EQ(credits->Value(2), 880.0);
+  EXPECT_TRUE(credits->IsNull(3));
+}
+
+TEST_F(OdbcAdaptorSQLiteTest, execQueryChunked) {
+  // Given
+  gflags::FlagSaver saver;
+  FLAGS_odbc_fetch_batch_rows = 3;
+  OdbcAdaptorOptions options;
+  options.kind = DataSourceKind::SQLITE;
+  options.connection_str = db_connection_str_;
+  options.connection_type = ConnectionType::Short;
+
+  OdbcAdaptor adaptor(options);
+  const std::string query = "SELECT name, age FROM person";
+  std::vector<ColumnDesc> outputs{{"name", pb::PrimitiveDataType::STRING},
+                                  {"age", pb::PrimitiveDataType::INT32}};
+
+  // When
+  auto result = adaptor.ExecQueryChunked(query, outputs);
+  auto chunk0 = result->Fetch();
+  auto chunk1 = result->Fetch();
+  auto chunk2 = result->Fetch();
+
+  // Then
+  ASSERT_TRUE(chunk0.has_value());
+  ASSERT_EQ(chunk0->size(), 2);
+  EXPECT_EQ((*chunk0)[0]->Length(), 3);
+  ASSERT_TRUE(chunk1.has_value());
+  EXPECT_EQ((*chunk1)[1]->Length(), 1);
+  EXPECT_FALSE(chunk2.has_value());
+
+  // result exceeding memory cap is rejected
+  result = adaptor.ExecQueryChunked(query, outputs);
+  EXPECT_THROW(ReadAllChunks(result.get(), 8), ::yacl::EnforceNotMet);
+}
+
+TEST_F(OdbcAdaptorSQLiteTest, execQueryPartitioned) {
+  // Given
+  gflags::FlagSaver saver;
+  FLAGS_odbc_fetch_batch_rows = 1;
+  FLAGS_run_sql_max_buffered_chunks = 1;
+  OdbcAdaptorOptions options;
+  options.kind = DataSourceKind::SQLITE;
+  options.connection_str = db_connection_str_;
+  options.connection_type = ConnectionType::Short;
+
+  auto adaptor = std::make_shared<OdbcAdaptor>(options);
+  const std::string query = "SELECT name, age FROM person";
+  std::vector<ColumnDesc> outputs{{"name", pb::PrimitiveDataType::STRING},
+                                  {"age", pb::PrimitiveDataType::INT32}};
+
+  // When
+  auto result = adaptor->ExecQueryPartitioned(query, outputs, "age", 3);
+  auto tensors = ReadAllChunks(result.get());
+
+  // Then all rows are returned although later partitions are blocked
+  ASSERT_EQ(tensors.size(), 2);
+  EXPECT_EQ(tensors[1]->Length(), 4);
+  EXPECT_EQ(tensors[1]->GetNullCount(), 2);
+
+  // destroying a result being produced doesn't wait for the workers
+  result = adaptor->ExecQueryPartitioned(query, outputs, "age", 3);
+  EXPECT_NO_THROW(result.reset());
+}
+
+}  // namespace scql::engine
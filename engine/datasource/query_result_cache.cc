@@ -0,0 +1,212 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "engine/datasource/query_result_cache.h"
+
+#include <cctype>
+#include <filesystem>
+
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/table.h"
+#include "spdlog/spdlog.h"
+#include "yacl/base/exception.h"
+
+#include "engine/core/arrow_helper.h"
+
+namespace scql::engine {
+
+namespace {
+
+constexpr char kFilePrefix[] = "scql_result_";
+
+arrow::Status WriteTensors(const std::string& path,
+                           const std::vector<TensorPtr>& tensors) {
+  arrow::FieldVector fields;
+  arrow::ChunkedArrayVector columns;
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    auto column = tensors[i]->ToArrowChunkedArray();
+    fields.push_back(arrow::field(fmt::format("c{}", i), column->type()));
+    columns.push_back(std::move(column));
+  }
+  auto table = arrow::Table::Make(arrow::schema(fields), columns);
+  ARROW_ASSIGN_OR_RAISE(auto out, arrow::io::FileOutputStream::Open(path));
+  // uncompressed, so that buffers are read from the mapped file directly.
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        arrow::ipc::MakeFileWriter(out, table->schema()));
+  ARROW_RETURN_NOT_OK(writer->WriteTable(*table));
+  ARROW_RETURN_NOT_OK(writer->Close());
+  return out->Close();
+}
+
+arrow::Result<std::vector<TensorPtr>> ReadTensors(const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto file, arrow::io::MemoryMappedFile::Open(
+                                       path, arrow::io::FileMode::READ));
+  ARROW_ASSIGN_OR_RAISE(auto reader,
+                        arrow::ipc::RecordBatchFileReader::Open(file));
+  const auto& schema = reader->schema();
+  std::vector<arrow::ArrayVector> columns(schema->num_fields());
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(i));
+    for (int j = 0; j < batch->num_columns(); ++j) {
+      columns[j].push_back(batch->column(j));
+    }
+  }
+  std::vector<TensorPtr> tensors;
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto chunked_arr,
+        arrow::ChunkedArray::Make(std::move(columns[i]),
+                                  schema->field(i)->type()));
+    tensors.push_back(std::make_shared<Tensor>(std::move(chunked_arr)));
+  }
+  return tensors;
+}
+
+}  // namespace
+
+QueryResultCache::QueryResultCache(QueryResultCacheOptions options)
+    : options_(std::move(options)) {
+  std::filesystem::create_directories(options_.dir);
+  // files left by a former process are not indexed, remove them.
+  for (const auto& file : std::filesystem::directory_iterator(options_.dir)) {
+    if (file.path().filename().string().rfind(kFilePrefix, 0) == 0) {
+      std::error_code ec;
+      std::filesystem::remove(file.path(), ec);
+    }
+  }
+}
+
+QueryResultCache::~QueryResultCache() {
+  absl::MutexLock lock(&mu_);
+  while (!lru_.empty()) {
+    Erase(lru_.back());
+  }
+}
+
+std::string QueryResultCache::MakeKey(const std::string& datasource_id,
+                                      const std::string& query,
+                                      const std::vector<ColumnDesc>& outputs) {
+  std::string normalized;
+  char quote = 0;
+  for (char c : query) {
+    if (quote == 0 && std::isspace(static_cast<unsigned char>(c))) {
+      if (!normalized.empty() && normalized.back() != ' ') {
+        normalized.push_back(' ');
+      }
+      continue;
+    }
+    if (quote == 0 && (c == '\'' || c == '"' || c == '`')) {
+      quote = c;
+    } else if (c == quote) {
+      quote = 0;
+    }
+    normalized.push_back(c);
+  }
+  if (!normalized.empty() && normalized.back() == ' ') {
+    normalized.pop_back();
+  }
+
+  std::string key = fmt::format("{}\n{}\n", datasource_id, normalized);
+  for (const auto& output : outputs) {
+    key += fmt::format("{},", static_cast<int>(output.dtype));
+  }
+  return key;
+}
+
+std::optional<std::vector<TensorPtr>> QueryResultCache::Get(
+    const std::string& key, const std::string& version) {
+  std::string path;
+  {
+    absl::MutexLock lock(&mu_);
+    auto iter = entries_.find(key);
+    if (iter == entries_.end()) {
+      return std::nullopt;
+    }
+    auto& entry = iter->second;
+    if (std::chrono::steady_clock::now() - entry.created > options_.ttl ||
+        entry.version != version) {
+      Erase(key);
+      return std::nullopt;
+    }
+    lru_.splice(lru_.begin(), lru_, entry.lru_iter);
+    path = entry.path;
+  }
+  // the file is kept open by the mapping even if the entry is evicted now.
+  auto tensors = ReadTensors(path);
+  if (!tensors.ok()) {
+    SPDLOG_WARN("read cached result {} failed: {}", path,
+                tensors.status().ToString());
+    return std::nullopt;
+  }
+  return std::move(*tensors);
+}
+
+void QueryResultCache::Put(const std::string& key, const std::string& version,
+                           const std::vector<TensorPtr>& tensors) {
+  std::string path;
+  {
+    absl::MutexLock lock(&mu_);
+    path = (std::filesystem::path(options_.dir) /
+            fmt::format("{}{}.arrow", kFilePrefix, next_file_id_++))
+               .string();
+  }
+  auto status = WriteTensors(path, tensors);
+  std::error_code ec;
+  int64_t bytes = std::filesystem::file_size(path, ec);
+  if (!status.ok() || ec || bytes > options_.max_bytes) {
+    SPDLOG_WARN("skip caching query result, status={}, bytes={}",
+                status.ToString(), bytes);
+    std::filesystem::remove(path, ec);
+    return;
+  }
+
+  absl::MutexLock lock(&mu_);
+  if (entries_.contains(key)) {
+    Erase(key);
+  }
+  while (total_bytes_ + bytes > options_.max_bytes && !lru_.empty()) {
+    Erase(lru_.back());
+  }
+  lru_.push_front(key);
+  Entry entry;
+  entry.path = path;
+  entry.version = version;
+  entry.bytes = bytes;
+  entry.created = std::chrono::steady_clock::now();
+  entry.lru_iter = lru_.begin();
+  entries_.emplace(key, std::move(entry));
+  total_bytes_ += bytes;
+}
+
+int64_t QueryResultCache::TotalBytes() {
+  absl::MutexLock lock(&mu_);
+  return total_bytes_;
+}
+
+void QueryResultCache::Erase(const std::string& key) {
+  auto iter = entries_.find(key);
+  if (iter == entries_.end()) {
+    return;
+  }
+  std::error_code ec;
+  std::filesystem::remove(iter->second.path, ec);
+  total_bytes_ -= iter->second.bytes;
+  lru_.erase(iter->second.lru_iter);
+  entries_.erase(iter);
+}
+
+}  // namespace scql::engine
@@ -0,0 +1,89 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <chrono>
+#include <list>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
+#include "engine/datasource/datasource_adaptor.h"
+
+namespace scql::engine {
+
+struct QueryResultCacheOptions {
+  // directory of cached arrow ipc files
+  std::string dir;
+  // entries older than ttl are not returned
+  std::chrono::milliseconds ttl;
+  // max bytes of all cached files, least recently used entries are evicted
+  // once exceeded
+  int64_t max_bytes;
+};
+
+/// @brief QueryResultCache keeps query results shared by sessions as Arrow
+/// IPC files. Cached files are memory-mapped when read, so tensors returned
+/// by Get are zero-copy.
+class QueryResultCache {
+ public:
+  explicit QueryResultCache(QueryResultCacheOptions options);
+  ~QueryResultCache();
+
+  /// @returns key of @param[in] query on @param[in] datasource_id, whitespace
+  /// outside of quotes in query is normalized.
+  static std::string MakeKey(const std::string& datasource_id,
+                             const std::string& query,
+                             const std::vector<ColumnDesc>& outputs);
+
+  /// @returns cached tensors of @param[in] key, std::nullopt if there are
+  /// none, they are expired or they were put with a different version.
+  std::optional<std::vector<TensorPtr>> Get(const std::string& key,
+                                            const std::string& version);
+
+  void Put(const std::string& key, const std::string& version,
+           const std::vector<TensorPtr>& tensors);
+
+  int64_t TotalBytes();
+
+ private:
+  struct Entry {
+    std::string path;
+    std::string version;
+    int64_t bytes = 0;
+    std::chrono::steady_clock::time_point created;
+    // position in lru_
+    std::list<std::string>::iterator lru_iter;
+  };
+
+  // remove entry of @param[in] key and its file, mu_ must be held.
+  void Erase(const std::string& key);
+
+  const QueryResultCacheOptions options_;
+
+  absl::Mutex mu_;
+  // following member variables are protected by `mu_`
+  absl::flat_hash_map<std::string, Entry> entries_;
+  // keys in order of access, most recent first
+  std::list<std::string> lru_;
+  int64_t total_bytes_ = 0;
+  uint64_t next_file_id_ = 0;
+};
+
+}  // namespace scql::engine
@@ -0,0 +1,121 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "engine/datasource/query_result_cache.h"
+
+#include <filesystem>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "engine/core/tensor_from_json.h"
+
+namespace scql::engine {
+
+class QueryResultCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    options_.dir = (std::filesystem::temp_directory_path() /
+                    "query_result_cache_test")
+                       .string();
+    options_.ttl = std::chrono::seconds(60);
+    options_.max_bytes = 1024 * 1024;
+  }
+
+  void TearDown() override { std::filesystem::remove_all(options_.dir); }
+
+  QueryResultCacheOptions options_;
+  std::vector<TensorPtr> tensors_{
+      TensorFromJSON(arrow::int64(), "[1,2,null,4]"),
+      TensorFromJSON(arrow::utf8(), R"json(["a","b","c",null])json")};
+};
+
+TEST_F(QueryResultCacheTest, PutAndGet) {
+  // Given
+  QueryResultCache cache(options_);
+  std::vector<ColumnDesc> outputs{{"id", pb::PrimitiveDataType::INT64},
+                                  {"name", pb::PrimitiveDataType::STRING}};
+  auto key = QueryResultCache::MakeKey("ds001", "select id, name from t",
+                                       outputs);
+
+  // When
+  cache.Put(key, "v1", tensors_);
+  auto same_query = QueryResultCache::MakeKey(
+      "ds001", "  select id,\n  name   from t ", outputs);
+  auto result = cache.Get(same_query, "v1");
+
+  // Then
+  EXPECT_EQ(key, same_query);
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->size(), 2);
+  for (size_t i = 0; i < tensors_.size(); ++i) {
+    EXPECT_TRUE((*result)[i]->ToArrowChunkedArray()->Equals(
+        *tensors_[i]->ToArrowChunkedArray()));
+  }
+  EXPECT_GT(cache.TotalBytes(), 0);
+}
+
+TEST_F(QueryResultCacheTest, KeyKeepsQuotedWhitespace) {
+  std::vector<ColumnDesc> outputs{{"id", pb::PrimitiveDataType::INT64}};
+  EXPECT_NE(
+      QueryResultCache::MakeKey("ds001", "select id from t where s='a  b'",
+                                outputs),
+      QueryResultCache::MakeKey("ds001", "select id from t where s='a b'",
+                                outputs));
+  EXPECT_NE(QueryResultCache::MakeKey("ds001", "select id from t", outputs),
+            QueryResultCache::MakeKey("ds002", "select id from t", outputs));
+}
+
+TEST_F(QueryResultCacheTest, VersionChangedOrExpired) {
+  // Given
+  options_.ttl = std::chrono::milliseconds(100);
+  QueryResultCache cache(options_);
+  cache.Put("k1", "v1", tensors_);
+  cache.Put("k2", "v1", tensors_);
+
+  // When
+  auto changed = cache.Get("k1", "v2");
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  auto expired = cache.Get("k2", "v1");
+
+  // Then
+  EXPECT_FALSE(changed.has_value());
+  EXPECT_FALSE(expired.has_value());
+  EXPECT_EQ(cache.TotalBytes(), 0);
+}
+
+TEST_F(QueryResultCacheTest, EvictLeastRecentlyUsed) {
+  // Given
+  {
+    QueryResultCache probe(options_);
+    probe.Put("k", "", tensors_);
+    // room for two entries
+    options_.max_bytes = probe.TotalBytes() * 2;
+  }
+  QueryResultCache cache(options_);
+  cache.Put("k1", "", tensors_);
+  cache.Put("k2", "", tensors_);
+
+  // When
+  EXPECT_TRUE(cache.Get("k1", "").has_value());
+  cache.Put("k3", "", tensors_);
+
+  // Then
+  EXPECT_TRUE(cache.Get("k1", "").has_value());
+  EXPECT_FALSE(cache.Get("k2", "").has_value());
+  EXPECT_TRUE(cache.Get("k3", "").has_value());
+}
+
+}  // namespace scql::engine
@@ -79,6 +79,16 @@ DEFINE_string(engine_credential, "", "scdb authorization credential");
 DEFINE_int32(session_timeout_s, 1800,
              "TTL for session, should be greater than the typical runtime of "
              "the specific tasks.");
+DEFINE_int32(result_ttl_s, 600,
+             "how long a session keeps its result for FetchResult since the "
+             "plan finished or the last fetch.");
+DEFINE_int64(fetch_result_max_rows, 100000,
+             "max number of rows returned by one FetchResult.");
+DEFINE_bool(enable_run_sql_prefetch, true,
+            "whether to start queries of RunSQL nodes once the plan arrives, "
+            "instead of when the nodes are reached.");
+DEFINE_int32(run_sql_prefetch_threads, 8,
+             "threads to run prefetching queries of RunSQL nodes.");
 // DataBase connection flags.
 DEFINE_string(datasource_router, "embed", "datasource router type");
 DEFINE_string(
@@ -194,6 +204,10 @@ std::unique_ptr<scql::engine::EngineServiceImpl> BuildEngineService(
   scql::engine::EngineServiceOptions engine_service_opt;
   engine_service_opt.enable_authorization = FLAGS_enable_scdb_authorization;
   engine_service_opt.credential = FLAGS_engine_credential;
+  engine_service_opt.result_ttl_s = FLAGS_result_ttl_s;
+  engine_service_opt.fetch_result_max_rows = FLAGS_fetch_result_max_rows;
+  engine_service_opt.prefetch_run_sql = FLAGS_enable_run_sql_prefetch;
+  engine_service_opt.prefetch_threads = FLAGS_run_sql_prefetch_threads;
   return std::make_unique<scql::engine::EngineServiceImpl>(
       engine_service_opt, std::move(session_manager), channel_manager);
 }
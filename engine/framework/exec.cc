@@ -21,7 +21,14 @@
 namespace scql::engine {
 
 ExecContext::ExecContext(const pb::ExecNode& node, Session* session)
-    : node_(node), session_(session) {}
+    : node_(node),
+      session_(session),
+      router_(session->GetRouter()),
+      ds_mgr_(session->GetDatasourceAdaptorMgr()) {}
+
+ExecContext::ExecContext(const pb::ExecNode& node, Router* router,
+                         DatasourceAdaptorMgr* ds_mgr)
+    : node_(node), session_(nullptr), router_(router), ds_mgr_(ds_mgr) {}
 
 const std::string& ExecContext::GetNodeName() const {
   return node_.node_name();
@@ -68,6 +75,12 @@ int64_t ExecContext::GetInt64ValueFromAttribute(const std::string& name) const {
   return util::GetInt64Value(attr.t());
 }
 
+std::vector<int64_t> ExecContext::GetInt64ValuesFromAttribute(
+    const std::string& name) const {
+  const auto& attr = GetAttribute(name);
+  return util::GetInt64Values(attr.t());
+}
+
 bool ExecContext::GetBooleanValueFromAttribute(const std::string& name) const {
   const auto& attr = GetAttribute(name);
   return util::GetBooleanValue(attr.t());
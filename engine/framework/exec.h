@@ -25,13 +25,16 @@ class ExecContext {
  public:
   ExecContext(const pb::ExecNode& node, Session* session);
 
+  /// @brief context without session, only for operators which read
+  /// datasource and node attributes, e.g. prefetching queries of RunSQL.
+  ExecContext(const pb::ExecNode& node, Router* router,
+              DatasourceAdaptorMgr* ds_mgr);
+
   TensorTable* GetTensorTable() const { return session_->GetTensorTable(); }
 
-  Router* GetDatasourceRouter() const { return session_->GetRouter(); }
+  Router* GetDatasourceRouter() const { return router_; }
 
-  DatasourceAdaptorMgr* GetDatasourceAdaptorMgr() const {
-    return session_->GetDatasourceAdaptorMgr();
-  }
+  DatasourceAdaptorMgr* GetDatasourceAdaptorMgr() const { return ds_mgr_; }
 
   Session* GetSession() const { return session_; }
 
@@ -54,11 +57,15 @@ class ExecContext {
       const std::string& name) const;
   std::string GetStringValueFromAttribute(const std::string& name) const;
   int64_t GetInt64ValueFromAttribute(const std::string& name) const;
+  std::vector<int64_t> GetInt64ValuesFromAttribute(
+      const std::string& name) const;
   bool GetBooleanValueFromAttribute(const std::string& name) const;
 
  private:
   const pb::ExecNode& node_;
   Session* session_;
+  Router* router_;
+  DatasourceAdaptorMgr* ds_mgr_;
 };
 
 }  // namespace scql::engine
\ No newline at end of file
@@ -17,10 +17,11 @@
 #include "arrow/array.h"
 #include "arrow/visit_array_inline.h"
 #include "openssl/sha.h"
+#include "yacl/utils/parallel.h"
 
 #include "engine/core/arrow_helper.h"
-#include "engine/core/primitive_builder.h"
 #include "engine/core/string_tensor_builder.h"
+#include "engine/util/tensor_util.h"
 
 namespace scql::engine {
 
@@ -51,6 +52,44 @@ Session::Session(const SessionOptions& session_opt,
   }
 }
 
+bool PrefetchState::Reserve(int64_t bytes, int64_t max_bytes) {
+  if (IsCancelled()) {
+    return false;
+  }
+  int64_t total = bytes_ += bytes;
+  if (max_bytes > 0 && total > max_bytes) {
+    bytes_ -= bytes;
+    return false;
+  }
+  return true;
+}
+
+void Session::AddPrefetchedResult(
+    const std::string& node_name, std::shared_ptr<PrefetchClaim> claim,
+    std::shared_future<PrefetchedResult> result) {
+  prefetched_results_[node_name] =
+      PrefetchTask{std::move(claim), std::move(result)};
+}
+
+std::optional<std::vector<TensorPtr>> Session::TakePrefetchedResult(
+    const std::string& node_name) {
+  auto iter = prefetched_results_.find(node_name);
+  if (iter == prefetched_results_.end()) {
+    return std::nullopt;
+  }
+  auto task = std::move(iter->second);
+  prefetched_results_.erase(iter);
+  if (task.claim->TryClaim()) {
+    // the task is still queued, it skips the query once it starts.
+    return std::nullopt;
+  }
+  // rethrows error of the prefetching query.
+  const auto& result = task.result.get();
+  // the result is owned by tensor table from now on.
+  prefetch_state_->Release(result.bytes);
+  return result.tensors;
+}
+
 void Session::InitLink() {
   yacl::link::ContextDesc ctx_desc;
   {
@@ -95,13 +134,11 @@ namespace {
 // https://stackoverflow.com/questions/19411742/what-is-the-default-hash-function-used-in-c-stdunordered-map
 
 static_assert(sizeof(size_t) == 8);
-size_t CryptoHash(const std::string& str) {
+size_t CryptoHash(const char* data, size_t size) {
   std::array<unsigned char, SHA256_DIGEST_LENGTH> hash;
-  SHA256_CTX c;
-
-  SHA256_Init(&c);
-  SHA256_Update(&c, str.data(), str.size());
-  SHA256_Final(hash.data(), &c);
+  // NOTE: one-shot SHA256 avoids ctx setup per string, and openssl picks
+  // SHA extensions(SHA-NI) at runtime if cpu supports.
+  SHA256(reinterpret_cast<const unsigned char*>(data), size, hash.data());
 
   size_t ret;
   std::memcpy(&ret, hash.data(), sizeof(ret));
@@ -110,15 +147,16 @@ size_t CryptoHash(const std::string& str) {
 
 class StringToHashConverter {
  public:
+  // @param[in] hash_to_string could be nullptr, which means no reverse
+  // dictionary is needed.
   explicit StringToHashConverter(
       absl::flat_hash_map<size_t, std::string>* hash_to_string)
-      : hash_to_string_(hash_to_string) {
-    YACL_ENFORCE(hash_to_string, "hash_to_string can not be null.");
-    builder_ = std::make_unique<UInt64TensorBuilder>();
-  }
+      : hash_to_string_(hash_to_string) {}
 
   void GetHashResult(std::shared_ptr<Tensor>* tensor) {
-    builder_->Finish(tensor);
+    auto result = arrow::ChunkedArray::Make(chunks_, arrow::uint64());
+    THROW_IF_ARROW_NOT_OK(result.status());
+    *tensor = std::make_shared<Tensor>(result.ValueOrDie());
   }
 
   template <typename T>
@@ -129,26 +167,96 @@ class StringToHashConverter {
   }
 
   arrow::Status Visit(const arrow::StringArray& array) {
-    for (int64_t i = 0; i < array.length(); i++) {
-      const std::string& cur_str = array.GetString(i);
-      size_t hash_value = CryptoHash(cur_str);
+    ARROW_ASSIGN_OR_RAISE(auto buffer, HashStrings(array));
+    chunks_.push_back(std::make_shared<arrow::UInt64Array>(array.length(),
+                                                           std::move(buffer)));
+    return arrow::Status::OK();
+  }
+
+  // Only distinct strings in dictionary are hashed, rows just look up hash
+  // of their indices. Chunks of an encoded tensor usually share the same
+  // dictionary, so its hashes are cached across chunks.
+  arrow::Status Visit(const arrow::DictionaryArray& array) {
+    if (array.dictionary()->type_id() != arrow::Type::STRING) {
+      return arrow::Status::NotImplemented(fmt::format(
+          "dictionary of type {} is not implemented in StringToHashConverter",
+          array.dictionary()->type()->ToString()));
+    }
+    if (array.data()->dictionary != cached_dictionary_) {
+      const auto& dict =
+          static_cast<const arrow::StringArray&>(*array.dictionary());
+      ARROW_ASSIGN_OR_RAISE(cached_dict_hashes_, HashStrings(dict));
+      cached_dictionary_ = array.data()->dictionary;
+    }
+    const auto* dict_hashes =
+        reinterpret_cast<const uint64_t*>(cached_dict_hashes_->data());
+    // null slot is hashed as empty string, the same as plain string array,
+    // whose reverse entry is absent if "" is not in the dictionary.
+    const uint64_t null_hash = CryptoHash("", 0);
+    if (hash_to_string_ != nullptr && array.null_count() > 0) {
+      hash_to_string_->try_emplace(null_hash, "");
+    }
 
-      hash_to_string_->emplace(hash_value, cur_str);
-      builder_->Append(hash_value);
+    const int64_t length = array.length();
+    ARROW_ASSIGN_OR_RAISE(auto buffer,
+                          arrow::AllocateBuffer(length * sizeof(uint64_t)));
+    auto* hashes = reinterpret_cast<uint64_t*>(buffer->mutable_data());
+    for (int64_t i = 0; i < length; ++i) {
+      hashes[i] =
+          array.IsNull(i) ? null_hash : dict_hashes[array.GetValueIndex(i)];
     }
+
+    chunks_.push_back(
+        std::make_shared<arrow::UInt64Array>(length, std::move(buffer)));
     return arrow::Status::OK();
   }
 
  private:
+  arrow::Result<std::shared_ptr<arrow::Buffer>> HashStrings(
+      const arrow::StringArray& array) {
+    const int64_t length = array.length();
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Buffer> buffer,
+                          arrow::AllocateBuffer(length * sizeof(uint64_t)));
+    auto* hashes = reinterpret_cast<uint64_t*>(buffer->mutable_data());
+
+    // hash strings of the chunk in parallel, each task owns a disjoint range
+    // of output buffer.
+    yacl::parallel_for(0, length, kHashGrainSize,
+                       [&](int64_t begin, int64_t end) {
+                         for (int64_t i = begin; i < end; ++i) {
+                           auto view = array.GetView(i);
+                           hashes[i] = CryptoHash(view.data(), view.size());
+                         }
+                       });
+
+    if (hash_to_string_ != nullptr) {
+      for (int64_t i = 0; i < length; i++) {
+        auto iter = hash_to_string_->find(hashes[i]);
+        if (iter == hash_to_string_->end()) {
+          hash_to_string_->emplace(hashes[i], array.GetString(i));
+        }
+      }
+    }
+    return buffer;
+  }
+
+  static constexpr int64_t kHashGrainSize = 4096;
+
   absl::flat_hash_map<size_t, std::string>* hash_to_string_;
-  std::unique_ptr<UInt64TensorBuilder> builder_;
+  arrow::ArrayVector chunks_;
+
+  std::shared_ptr<arrow::ArrayData> cached_dictionary_;
+  std::shared_ptr<arrow::Buffer> cached_dict_hashes_;
 };
 
 class HashToStringConverter {
  public:
-  explicit HashToStringConverter(
-      absl::flat_hash_map<size_t, std::string>* hash_to_string)
-      : hash_to_string_(hash_to_string) {
+  // @param[in] strict whether to fail on hash values missing in the
+  // dictionary instead of filling placeholders.
+  HashToStringConverter(
+      const absl::flat_hash_map<size_t, std::string>* hash_to_string,
+      bool strict)
+      : hash_to_string_(hash_to_string), strict_(strict) {
     YACL_ENFORCE(hash_to_string, "hash_to_string can not be null.");
     builder_ = std::make_unique<StringTensorBuilder>();
   }
@@ -168,25 +276,33 @@ class HashToStringConverter {
     for (int64_t i = 0; i < array.length(); i++) {
       const auto& hash_value = array.GetView(i);
       auto iter = hash_to_string_->find(hash_value);
-      if (iter == hash_to_string_->end()) {
-        builder_->Append(kStringPlaceHolder);
-      } else {
+      if (iter != hash_to_string_->end()) {
         builder_->Append(iter->second);
+      } else if (strict_) {
+        return arrow::Status::KeyError(fmt::format(
+            "hash value {} not found in reverse dictionary of strings, the "
+            "string reveal scope may miss its source tensor",
+            hash_value));
+      } else {
+        builder_->Append(kStringPlaceHolder);
       }
     }
     return arrow::Status::OK();
   }
 
  private:
-  absl::flat_hash_map<size_t, std::string>* hash_to_string_;
+  const absl::flat_hash_map<size_t, std::string>* hash_to_string_;
+  const bool strict_;
   std::unique_ptr<StringTensorBuilder> builder_;
   static constexpr char kStringPlaceHolder[] = "__null__";
 };
 
 }  // namespace
 
-TensorPtr Session::StringToHash(const Tensor& string_tensor) {
-  StringToHashConverter converter(&hash_to_string_values_);
+TensorPtr Session::StringToHash(const Tensor& string_tensor,
+                                bool keep_reverse_dict) {
+  StringToHashConverter converter(keep_reverse_dict ? &hash_to_string_values_
+                                                    : nullptr);
   const auto& chunked_arr = string_tensor.ToArrowChunkedArray();
   for (int i = 0; i < chunked_arr->num_chunks(); ++i) {
     THROW_IF_ARROW_NOT_OK(
@@ -198,8 +314,26 @@ TensorPtr Session::StringToHash(const Tensor& string_tensor) {
   return result;
 }
 
-TensorPtr Session::HashToString(const Tensor& hash_tensor) {
-  HashToStringConverter converter(&hash_to_string_values_);
+void Session::SetStringRevealScope(
+    absl::flat_hash_set<std::string> tensor_names) {
+  string_reveal_scope_ = std::move(tensor_names);
+}
+
+bool Session::IsInStringRevealScope(const std::string& tensor_name) const {
+  return !string_reveal_scope_.has_value() ||
+         string_reveal_scope_->contains(tensor_name);
+}
+
+void Session::ReleaseStringDictionary() {
+  absl::flat_hash_map<size_t, std::string>().swap(hash_to_string_values_);
+  string_dictionary_released_ = true;
+}
+
+TensorPtr Session::HashToString(const Tensor& hash_tensor, bool strict) {
+  YACL_ENFORCE(!string_dictionary_released_,
+               "reverse dictionary of strings has been released, could not "
+               "convert hashes back to strings");
+  HashToStringConverter converter(&hash_to_string_values_, strict);
   const auto& chunked_arr = hash_tensor.ToArrowChunkedArray();
   for (int i = 0; i < chunked_arr->num_chunks(); ++i) {
     THROW_IF_ARROW_NOT_OK(
@@ -211,4 +345,20 @@ TensorPtr Session::HashToString(const Tensor& hash_tensor) {
   return result;
 }
 
+std::string Session::GetPublishResultsInArrowIpc() const {
+  return util::SerializeToArrowIpc(publish_names_, publish_tensors_);
+}
+
+std::string Session::GetPublishResultsInArrowIpc(int64_t offset,
+                                                 int64_t length) const {
+  std::vector<TensorPtr> pages;
+  pages.reserve(publish_tensors_.size());
+  for (const auto& tensor : publish_tensors_) {
+    // slice is zero-copy, so the page is only materialized by serializing.
+    pages.push_back(std::make_shared<Tensor>(
+        tensor->ToArrowChunkedArray()->Slice(offset, length)));
+  }
+  return util::SerializeToArrowIpc(publish_names_, pages);
+}
+
 }  // namespace scql::engine
\ No newline at end of file
@@ -14,11 +14,16 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <future>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "libspu/device/symbol_table.h"
 #include "libspu/kernel/context.h"
 #include "yacl/link/link.h"
@@ -42,6 +47,55 @@ struct SessionOptions {
   uint32_t link_recv_timeout_ms = 30 * 1000;  // 30s
 };
 
+/// @brief state shared by a session and its prefetching queries, which may
+/// still run after the session is removed.
+class PrefetchState {
+ public:
+  /// @brief tells prefetching queries to stop at the next chunk.
+  void Cancel() { cancelled_ = true; }
+
+  bool IsCancelled() const { return cancelled_; }
+
+  /// @brief takes @param[in] bytes from the budget of all prefetched results
+  /// of the session, no limit if @param[in] max_bytes <= 0.
+  /// @returns false and takes nothing if cancelled or the budget runs out.
+  bool Reserve(int64_t bytes, int64_t max_bytes);
+
+  /// @brief gives back @param[in] bytes taken by Reserve.
+  void Release(int64_t bytes) { bytes_ -= bytes; }
+
+  int64_t GetBytes() const { return bytes_; }
+
+ private:
+  std::atomic<bool> cancelled_{false};
+  std::atomic<int64_t> bytes_{0};
+};
+
+// cancels prefetching queries of a session once it is removed, without
+// waiting for them.
+struct PrefetchCanceller {
+  void operator()(PrefetchState* state) const { state->Cancel(); }
+};
+
+/// @brief a prefetched node is queried by whichever claims it first: the
+/// prefetching task when a pool thread starts it, or the node when it runs
+/// before that, so the node never waits for a task queued behind others.
+class PrefetchClaim {
+ public:
+  /// @returns true if the caller is the first to claim.
+  bool TryClaim() { return !claimed_.exchange(true); }
+
+ private:
+  std::atomic<bool> claimed_{false};
+};
+
+// result of prefetching query with the bytes it takes from PrefetchState,
+// std::nullopt if the query gave up.
+struct PrefetchedResult {
+  std::optional<std::vector<TensorPtr>> tensors;
+  int64_t bytes = 0;
+};
+
 /// @brief Session holds everything needed to run the execution plan.
 class Session {
  public:
@@ -82,15 +136,35 @@ class Session {
 
   void SetState(SessionState new_state) { state_ = new_state; }
 
-  std::chrono::time_point<std::chrono::system_clock> GetStartTime() {
+  std::chrono::time_point<std::chrono::system_clock> GetStartTime() const {
     return start_time_;
   }
 
   void MergeDeviceSymbolsFrom(const spu::device::SymbolTable& other);
 
-  TensorPtr StringToHash(const Tensor& string_tensor);
+  /// @brief hash strings to 64-bit integers so they can be fed into spu.
+  /// @param[in] keep_reverse_dict whether to record hash -> string mapping,
+  /// which is required to convert hashes back by HashToString.
+  TensorPtr StringToHash(const Tensor& string_tensor,
+                         bool keep_reverse_dict = true);
+
+  /// @brief convert hashes back to strings by the reverse dictionary, hashes
+  /// missing in it become placeholders, since strings of other parties are
+  /// only known by them, e.g. in joint publish.
+  /// @param[in] strict fail on missing hashes instead, only for callers who
+  /// know the dictionary holds every string of @param[in] hash_tensor.
+  /// @throw if the dictionary has been released by ReleaseStringDictionary.
+  TensorPtr HashToString(const Tensor& hash_tensor, bool strict = false);
+
+  /// @brief limit reverse dictionary of strings to the tensors whose hash
+  /// values may be revealed. If never set, all tensors are in the scope.
+  void SetStringRevealScope(absl::flat_hash_set<std::string> tensor_names);
+
+  bool IsInStringRevealScope(const std::string& tensor_name) const;
 
-  TensorPtr HashToString(const Tensor& hash_tensor);
+  /// @brief free the reverse dictionary once no one would reveal strings,
+  /// HashToString fails afterwards.
+  void ReleaseStringDictionary();
 
   void AddPublishResult(std::shared_ptr<pb::Tensor> pb) {
     publish_results_.emplace_back(std::move(pb));
@@ -100,12 +174,76 @@ class Session {
     return publish_results_;
   }
 
+  /// @brief if enabled, Publish keeps result tensors as they are instead of
+  /// copying values into pb::Tensor, see GetPublishResultsInArrowIpc.
+  void SetArrowIpcResult(bool enable) { arrow_ipc_result_ = enable; }
+
+  bool IsArrowIpcResult() const { return arrow_ipc_result_; }
+
+  /// @brief if enabled, Publish keeps result tensors in session, which are
+  /// fetched in pages later, see GetPublishResultsInArrowIpc.
+  void SetResultCursor(bool enable) { result_cursor_ = enable; }
+
+  bool IsResultCursor() const { return result_cursor_; }
+
+  bool KeepsPublishTensors() const {
+    return arrow_ipc_result_ || result_cursor_;
+  }
+
+  void AddPublishTensor(const std::string& name, TensorPtr tensor) {
+    publish_names_.push_back(name);
+    publish_tensors_.push_back(std::move(tensor));
+  }
+
+  /// @returns published tensors serialized as one arrow ipc stream
+  std::string GetPublishResultsInArrowIpc() const;
+
+  /// @returns rows [offset, offset + length) of published tensors serialized
+  /// as one arrow ipc stream, rows out of range are ignored.
+  std::string GetPublishResultsInArrowIpc(int64_t offset,
+                                          int64_t length) const;
+
+  /// @returns number of rows of published tensors
+  int64_t GetPublishRowCount() const {
+    return publish_tensors_.empty() ? 0 : publish_tensors_[0]->Length();
+  }
+
+  /// @returns state which prefetching queries of the session share, they
+  /// must not refer to the session since it doesn't wait for them.
+  std::shared_ptr<PrefetchState> GetPrefetchState() const {
+    return prefetch_state_;
+  }
+
+  /// @brief keep result of RunSQL node @param[in] node_name which is queried
+  /// in background before the node runs, the task only queries if it gets
+  /// @param[in] claim first.
+  void AddPrefetchedResult(const std::string& node_name,
+                           std::shared_ptr<PrefetchClaim> claim,
+                           std::shared_future<PrefetchedResult> result);
+
+  /// @returns prefetched result of @param[in] node_name and removes it from
+  /// session, std::nullopt if the node is not prefetched, the prefetching
+  /// query hasn't started or gave up, the bytes it takes are given back to
+  /// PrefetchState.
+  std::optional<std::vector<TensorPtr>> TakePrefetchedResult(
+      const std::string& node_name);
+
   void SetAffectedRows(int64_t affected_rows) {
     affected_rows_ = affected_rows;
   }
 
   int64_t GetAffectedRows() { return affected_rows_; }
 
+  /// @brief records bytes and files written by DumpFile
+  void SetWrittenFiles(int64_t bytes, int64_t files) {
+    written_bytes_ = bytes;
+    written_files_ = files;
+  }
+
+  int64_t GetWrittenBytes() { return written_bytes_; }
+
+  int64_t GetWrittenFiles() { return written_files_; }
+
  private:
   void InitLink();
 
@@ -129,9 +267,30 @@ class Session {
   spu::device::SymbolTable device_symbols_;    // spu device symbols table
 
   absl::flat_hash_map<size_t, std::string> hash_to_string_values_;
+  std::optional<absl::flat_hash_set<std::string>> string_reveal_scope_;
+  bool string_dictionary_released_ = false;
 
   std::vector<std::shared_ptr<pb::Tensor>> publish_results_;
-  int64_t affected_rows_;
+  bool arrow_ipc_result_ = false;
+  bool result_cursor_ = false;
+  std::vector<std::string> publish_names_;
+  std::vector<TensorPtr> publish_tensors_;
+  int64_t affected_rows_ = 0;
+  int64_t written_bytes_ = 0;
+  int64_t written_files_ = 0;
+
+  std::shared_ptr<PrefetchState> prefetch_state_ =
+      std::make_shared<PrefetchState>();
+  // doesn't own the state, prefetching queries keep it alive.
+  std::unique_ptr<PrefetchState, PrefetchCanceller> prefetch_canceller_{
+      prefetch_state_.get()};
+  // node name --> prefetched result of RunSQL node, nodes are added and
+  // taken by the thread running the plan.
+  struct PrefetchTask {
+    std::shared_ptr<PrefetchClaim> claim;
+    std::shared_future<PrefetchedResult> result;
+  };
+  absl::flat_hash_map<std::string, PrefetchTask> prefetched_results_;
 };
 
 }  // namespace scql::engine
\ No newline at end of file
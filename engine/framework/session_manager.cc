@@ -119,6 +119,7 @@ void SessionManager::RemoveSession(const std::string& session_id) {
         end - iter->second->GetStartTime());
 
     id_to_session_.erase(iter);
+    keep_alive_until_.erase(session_id);
 
     SPDLOG_INFO(
         "session({}) removed, running_cost({}ms), current running session={}",
@@ -154,6 +155,21 @@ bool SessionManager::SetSessionState(const std::string& session_id,
   return true;
 }
 
+void SessionManager::KeepSessionAlive(const std::string& session_id,
+                                      std::chrono::seconds ttl) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (id_to_session_.find(session_id) == id_to_session_.end()) {
+    SPDLOG_WARN("session({}) not exists.", session_id);
+    return;
+  }
+  keep_alive_until_[session_id] = std::chrono::system_clock::now() + ttl;
+}
+
+bool SessionManager::IsSessionKeptAlive(const std::string& session_id) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return keep_alive_until_.find(session_id) != keep_alive_until_.end();
+}
+
 void SessionManager::WatchSessionTimeoutThread() {
   SPDLOG_INFO("WatchSessionTimeoutThread startup, session default timeout={}s",
               session_default_timeout_s_.count());
@@ -207,8 +223,7 @@ SessionManager::NextCheckTime() {
     if (iter == id_to_session_.end()) {
       session_timeout_queue_.pop();
     } else {
-      return std::min(
-          result, iter->second->GetStartTime() + session_default_timeout_s_);
+      return std::min(result, GetDeadline(session, *iter->second));
     }
   }
 
@@ -218,7 +233,11 @@ SessionManager::NextCheckTime() {
 std::optional<std::string> SessionManager::GetTimeoutSession() {
   auto now = std::chrono::system_clock::now();
   std::unique_lock<std::mutex> lock(mutex_);
-  while (!session_timeout_queue_.empty()) {
+  // sessions kept alive are moved to the back of the queue, so they don't
+  // block the timeout of sessions started after them.
+  size_t kept_alive_count = 0;
+  while (!session_timeout_queue_.empty() &&
+         kept_alive_count < session_timeout_queue_.size()) {
     const auto& session = session_timeout_queue_.front();
     auto iter = id_to_session_.find(session);
     if (iter == id_to_session_.end()) {
@@ -226,14 +245,29 @@ std::optional<std::string> SessionManager::GetTimeoutSession() {
       continue;
     }
 
-    if (iter->second->GetStartTime() + session_default_timeout_s_ <= now) {
+    if (GetDeadline(session, *iter->second) <= now) {
       return session;
-    } else {
+    }
+    if (iter->second->GetStartTime() + session_default_timeout_s_ > now) {
       return std::nullopt;
     }
+    std::string kept_alive_session = session;
+    session_timeout_queue_.pop();
+    session_timeout_queue_.push(std::move(kept_alive_session));
+    ++kept_alive_count;
   }
 
   return std::nullopt;
 }
 
+std::chrono::time_point<std::chrono::system_clock> SessionManager::GetDeadline(
+    const std::string& session_id, const Session& session) {
+  auto deadline = session.GetStartTime() + session_default_timeout_s_;
+  auto iter = keep_alive_until_.find(session_id);
+  if (iter != keep_alive_until_.end()) {
+    deadline = std::max(deadline, iter->second);
+  }
+  return deadline;
+}
+
 }  // namespace scql::engine
\ No newline at end of file
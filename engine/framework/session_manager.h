@@ -53,6 +53,14 @@ class SessionManager {
                        SessionState expect_current_state,
                        SessionState dest_state);
 
+  // Keep session alive until @ttl passed from now even if session timeout is
+  // reached, used by session whose result is fetched after the plan finished.
+  void KeepSessionAlive(const std::string& session_id,
+                        std::chrono::seconds ttl);
+
+  // @returns true if session is kept alive by KeepSessionAlive
+  bool IsSessionKeptAlive(const std::string& session_id);
+
  private:
   void WatchSessionTimeoutThread();
 
@@ -60,6 +68,10 @@ class SessionManager {
 
   std::optional<std::string> GetTimeoutSession();
 
+  // should be called with mutex_ held.
+  std::chrono::time_point<std::chrono::system_clock> GetDeadline(
+      const std::string& session_id, const Session& session);
+
  private:
   // used to construct session
   const SessionOptions session_opt_;
@@ -76,6 +88,8 @@ class SessionManager {
   std::atomic<bool> to_stop_{false};
   std::unique_ptr<std::thread> watch_thread_;
   std::queue<std::string> session_timeout_queue_;
+  std::map<std::string, std::chrono::time_point<std::chrono::system_clock>>
+      keep_alive_until_;
 };
 
 }  // namespace scql::engine
\ No newline at end of file
@@ -102,6 +102,19 @@ TEST_F(SessionManagerTest, Works) {
   EXPECT_NE(nullptr, listener_manager.GetListener(session_id));
   sleep(2);
   EXPECT_EQ(nullptr, listener_manager.GetListener(session_id));
+
+  // test keep alive.
+  session_id = session_id + "_keep_alive";
+  params.set_session_id(session_id);
+  EXPECT_NO_THROW(mgr->CreateSession(params));
+  EXPECT_FALSE(mgr->IsSessionKeptAlive(session_id));
+  mgr->KeepSessionAlive(session_id, std::chrono::seconds(3));
+  EXPECT_TRUE(mgr->IsSessionKeptAlive(session_id));
+  sleep(2);
+  EXPECT_NE(nullptr, mgr->GetSession(session_id));
+  sleep(3);
+  EXPECT_EQ(nullptr, mgr->GetSession(session_id));
+  EXPECT_FALSE(mgr->IsSessionKeptAlive(session_id));
 }
 
 }  // namespace scql::engine
\ No newline at end of file
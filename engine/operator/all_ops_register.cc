@@ -25,6 +25,7 @@
 #include "engine/operator/dump_file.h"
 #include "engine/operator/filter.h"
 #include "engine/operator/filter_by_index.h"
+#include "engine/operator/group_he_sum.h"
 #include "engine/operator/in.h"
 #include "engine/operator/join.h"
 #include "engine/operator/logical.h"
@@ -109,6 +110,10 @@ void RegisterAllOpsImpl() {
   ADD_OPERATOR_TO_REGISTRY(ObliviousGroupAvg);
   ADD_OPERATOR_TO_REGISTRY(ObliviousGroupMax);
   ADD_OPERATOR_TO_REGISTRY(ObliviousGroupMin);
+  ADD_OPERATOR_TO_REGISTRY(ObliviousGroupAgg);
+
+  // he groupby
+  ADD_OPERATOR_TO_REGISTRY(GroupHeSum);
 
   ADD_OPERATOR_TO_REGISTRY(Concat);
 }
@@ -52,7 +52,7 @@ void Constant::Execute(ExecContext* ctx) {
   } else if (output_status == pb::TensorStatus::TENSORSTATUS_PUBLIC) {
     auto hctx = ctx->GetSession()->GetSpuHalContext();
     spu::device::ColocatedIo cio(hctx);
-    util::SpuInfeedHelper infeed_helper(&cio);
+    util::SpuInfeedHelper infeed_helper(hctx, &cio);
 
     auto tensor = BuildTensorFromScalar(scalar_attr);
     YACL_ENFORCE(tensor != nullptr,
@@ -14,10 +14,16 @@
 
 #include "engine/operator/copy.h"
 
-#include "arrow/io/memory.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "arrow/io/interfaces.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/table.h"
+#include "arrow/util/compression.h"
+#include "gflags/gflags.h"
 
 #include "engine/core/arrow_helper.h"
 #include "engine/core/type.h"
@@ -27,6 +33,178 @@
 
 namespace scql::engine::op {
 
+DEFINE_int64(copy_batch_rows, 1 << 20,
+             "max rows of each record batch sent by Copy");
+DEFINE_string(copy_ipc_compression, "zstd",
+              "compression codec for Copy's arrow ipc body, options: "
+              "uncompressed, lz4, zstd");
+DEFINE_int64(copy_max_inflight_batches, 4,
+             "max record batches Copy sends before the receiver reads them");
+
+namespace {
+
+constexpr char kAckTagSuffix[] = ".ack";
+
+/// @brief LinkOutputStream buffers bytes written by ipc writer and sends them
+/// to peer as one link message when SendPending() is called.
+///
+/// LinkInputStream acks every message it reads, and at most max_inflight
+/// messages are sent but not acked, so neither party buffers the whole table.
+class LinkOutputStream : public arrow::io::OutputStream {
+ public:
+  LinkOutputStream(std::shared_ptr<yacl::link::Context> lctx, size_t to_rank,
+                   std::string tag, int64_t max_inflight)
+      : lctx_(std::move(lctx)),
+        to_rank_(to_rank),
+        tag_(std::move(tag)),
+        ack_tag_(tag_ + kAckTagSuffix),
+        max_inflight_(max_inflight) {}
+
+  arrow::Status Close() override {
+    closed_ = true;
+    return arrow::Status::OK();
+  }
+
+  bool closed() const override { return closed_; }
+
+  arrow::Result<int64_t> Tell() const override { return position_; }
+
+  arrow::Status Write(const void* data, int64_t nbytes) override {
+    if (closed_) {
+      return arrow::Status::Invalid("write to closed LinkOutputStream");
+    }
+    pending_.append(static_cast<const char*>(data), nbytes);
+    position_ += nbytes;
+    return arrow::Status::OK();
+  }
+
+  // NOTE: send asynchronously, so that serializing the next batch overlaps
+  // with transferring the current one.
+  void SendPending() {
+    if (pending_.empty()) {
+      return;
+    }
+    if (sent_ - acked_ >= max_inflight_) {
+      WaitAck();
+    }
+    lctx_->SendAsync(to_rank_, yacl::ByteContainerView(pending_), tag_);
+    ++sent_;
+    pending_.clear();
+  }
+
+  /// @brief waits until peer has read all sent messages.
+  void WaitAllAcks() {
+    while (acked_ < sent_) {
+      WaitAck();
+    }
+  }
+
+ private:
+  void WaitAck() {
+    lctx_->Recv(to_rank_, ack_tag_);
+    ++acked_;
+  }
+
+  std::shared_ptr<yacl::link::Context> lctx_;
+  const size_t to_rank_;
+  const std::string tag_;
+  const std::string ack_tag_;
+  const int64_t max_inflight_;
+
+  std::string pending_;
+  int64_t position_ = 0;
+  int64_t sent_ = 0;
+  int64_t acked_ = 0;
+  bool closed_ = false;
+};
+
+/// @brief LinkInputStream receives link messages from peer on demand, and
+/// exposes them as a contiguous byte stream to ipc reader.
+class LinkInputStream : public arrow::io::InputStream {
+ public:
+  LinkInputStream(std::shared_ptr<yacl::link::Context> lctx, size_t from_rank,
+                  std::string tag)
+      : lctx_(std::move(lctx)),
+        from_rank_(from_rank),
+        tag_(std::move(tag)),
+        ack_tag_(tag_ + kAckTagSuffix) {}
+
+  arrow::Status Close() override {
+    closed_ = true;
+    current_ = yacl::Buffer();
+    return arrow::Status::OK();
+  }
+
+  bool closed() const override { return closed_; }
+
+  arrow::Result<int64_t> Tell() const override { return position_; }
+
+  arrow::Result<int64_t> Read(int64_t nbytes, void* out) override {
+    if (closed_) {
+      return arrow::Status::Invalid("read from closed LinkInputStream");
+    }
+    auto* dst = static_cast<uint8_t*>(out);
+    int64_t total = 0;
+    while (total < nbytes) {
+      if (offset_ == current_.size()) {
+        // previous message is fully consumed, wait for next one
+        current_ = lctx_->Recv(from_rank_, tag_);
+        lctx_->SendAsync(from_rank_, yacl::ByteContainerView(), ack_tag_);
+        offset_ = 0;
+        if (current_.size() == 0) {
+          break;
+        }
+      }
+      int64_t n = std::min<int64_t>(nbytes - total, current_.size() - offset_);
+      std::memcpy(dst + total, current_.data<uint8_t>() + offset_, n);
+      offset_ += n;
+      total += n;
+    }
+    position_ += total;
+    return total;
+  }
+
+  arrow::Result<std::shared_ptr<arrow::Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, arrow::AllocateResizableBuffer(nbytes));
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          Read(nbytes, buffer->mutable_data()));
+    RETURN_NOT_OK(buffer->Resize(bytes_read, false));
+    return std::shared_ptr<arrow::Buffer>(std::move(buffer));
+  }
+
+ private:
+  std::shared_ptr<yacl::link::Context> lctx_;
+  const size_t from_rank_;
+  const std::string tag_;
+  const std::string ack_tag_;
+
+  yacl::Buffer current_;
+  int64_t offset_ = 0;
+  int64_t position_ = 0;
+  bool closed_ = false;
+};
+
+arrow::ipc::IpcWriteOptions MakeIpcWriteOptions() {
+  auto options = arrow::ipc::IpcWriteOptions::Defaults();
+  arrow::Compression::type codec_type;
+  ASSIGN_OR_THROW_ARROW_STATUS(
+      codec_type,
+      arrow::util::Codec::GetCompressionType(FLAGS_copy_ipc_compression));
+  if (codec_type == arrow::Compression::UNCOMPRESSED) {
+    return options;
+  }
+  // arrow ipc only supports LZ4_FRAME and ZSTD body compression
+  YACL_ENFORCE(codec_type == arrow::Compression::LZ4_FRAME ||
+                   codec_type == arrow::Compression::ZSTD,
+               "unsupported copy ipc compression: {}",
+               FLAGS_copy_ipc_compression);
+  ASSIGN_OR_THROW_ARROW_STATUS(options.codec,
+                               arrow::util::Codec::Create(codec_type));
+  return options;
+}
+
+}  // namespace
+
 const std::string Copy::kOpType("Copy");
 
 const std::string& Copy::Type() const { return kOpType; }
@@ -55,27 +233,19 @@ void Copy::Execute(ExecContext* ctx) {
       ctx->GetStringValueFromAttribute(kOutputPartyCodesAttr);
   const std::string self_party = ctx->GetSession()->SelfPartyCode();
 
-  auto lctx = ctx->GetSession()->GetLink();
-
   if (self_party == from_party) {
     auto table = ConstructTableFromTensors(ctx, input_pbs);
     YACL_ENFORCE(table, "construct table failed");
 
-    auto buffer = SerializeTable(std::move(table));
-    YACL_ENFORCE(buffer, "serialize table failed");
-
     auto send_to_rank = ctx->GetSession()->GetPartyRank(to_party);
     YACL_ENFORCE(send_to_rank != -1, "unknown rank for party={}", to_party);
-    lctx->Send(send_to_rank,
-               yacl::ByteContainerView(buffer->mutable_data(), buffer->size()),
-               ctx->GetNodeName());
+    SendTable(ctx, std::move(table), send_to_rank);
   } else {
     auto recv_from_rank = ctx->GetSession()->GetPartyRank(from_party);
     YACL_ENFORCE(recv_from_rank != -1, "unknown rank for party={}", from_party);
-    yacl::Buffer value = lctx->Recv(recv_from_rank, ctx->GetNodeName());
 
-    auto table = DeserializeTable(std::move(value));
-    YACL_ENFORCE(table, "deserialize table failed");
+    auto table = RecvTable(ctx, recv_from_rank);
+    YACL_ENFORCE(table, "receive table failed");
 
     InsertTensorsFromTable(ctx, output_pbs, std::move(table));
   }
@@ -106,37 +276,64 @@ std::shared_ptr<arrow::Table> Copy::ConstructTableFromTensors(
   return table;
 }
 
-std::shared_ptr<arrow::Buffer> Copy::SerializeTable(
-    std::shared_ptr<arrow::Table> table) {
-  std::shared_ptr<arrow::io::BufferOutputStream> out_stream;
-  ASSIGN_OR_THROW_ARROW_STATUS(out_stream,
-                               arrow::io::BufferOutputStream::Create());
+void Copy::SendTable(ExecContext* ctx, std::shared_ptr<arrow::Table> table,
+                     size_t to_rank) {
+  YACL_ENFORCE(FLAGS_copy_batch_rows > 0,
+               "copy_batch_rows should be positive, but got {}",
+               FLAGS_copy_batch_rows);
+  YACL_ENFORCE(FLAGS_copy_max_inflight_batches > 0,
+               "copy_max_inflight_batches should be positive, but got {}",
+               FLAGS_copy_max_inflight_batches);
+  auto out_stream = std::make_shared<LinkOutputStream>(
+      ctx->GetSession()->GetLink(), to_rank, ctx->GetNodeName(),
+      FLAGS_copy_max_inflight_batches);
 
   std::shared_ptr<arrow::ipc::RecordBatchWriter> writer;
   ASSIGN_OR_THROW_ARROW_STATUS(
-      writer, arrow::ipc::MakeStreamWriter(out_stream, table->schema()));
+      writer, arrow::ipc::MakeStreamWriter(out_stream, table->schema(),
+                                           MakeIpcWriteOptions()));
 
-  THROW_IF_ARROW_NOT_OK(writer->WriteTable(*table));
+  arrow::TableBatchReader batch_reader(*table);
+  batch_reader.set_chunksize(FLAGS_copy_batch_rows);
+  while (true) {
+    std::shared_ptr<arrow::RecordBatch> batch;
+    THROW_IF_ARROW_NOT_OK(batch_reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    THROW_IF_ARROW_NOT_OK(writer->WriteRecordBatch(*batch));
+    out_stream->SendPending();
+  }
+  // schema(for empty table) and end-of-stream marker
   THROW_IF_ARROW_NOT_OK(writer->Close());
-
-  std::shared_ptr<arrow::Buffer> buffer;
-  ASSIGN_OR_THROW_ARROW_STATUS(buffer, out_stream->Finish());
-  return buffer;
+  out_stream->SendPending();
+  // no ack is left on the link for later nodes
+  out_stream->WaitAllAcks();
 }
 
-std::shared_ptr<arrow::Table> Copy::DeserializeTable(yacl::Buffer value) {
-  auto buffer = std::make_shared<arrow::Buffer>(value.data<const uint8_t>(),
-                                                value.size());
-  value.release();  // buffer owns datas.
-
-  auto buffer_reader = std::make_shared<arrow::io::BufferReader>(buffer);
+std::shared_ptr<arrow::Table> Copy::RecvTable(ExecContext* ctx,
+                                              size_t from_rank) {
+  auto in_stream = std::make_shared<LinkInputStream>(
+      ctx->GetSession()->GetLink(), from_rank, ctx->GetNodeName());
 
   std::shared_ptr<arrow::ipc::RecordBatchStreamReader> reader;
   ASSIGN_OR_THROW_ARROW_STATUS(
-      reader, arrow::ipc::RecordBatchStreamReader::Open(buffer_reader));
+      reader, arrow::ipc::RecordBatchStreamReader::Open(in_stream));
+
+  // batches are zero-copy appended as chunks of the output tensors
+  arrow::RecordBatchVector batches;
+  while (true) {
+    std::shared_ptr<arrow::RecordBatch> batch;
+    THROW_IF_ARROW_NOT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    batches.push_back(std::move(batch));
+  }
 
   std::shared_ptr<arrow::Table> table;
-  ASSIGN_OR_THROW_ARROW_STATUS(table, reader->ToTable());
+  ASSIGN_OR_THROW_ARROW_STATUS(
+      table, arrow::Table::FromRecordBatches(reader->schema(), batches));
   THROW_IF_ARROW_NOT_OK(table->Validate());
 
   return table;
@@ -157,4 +354,4 @@ void Copy::InsertTensorsFromTable(ExecContext* ctx,
   }
 }
 
-}  // namespace scql::engine::op
\ No newline at end of file
+}  // namespace scql::engine::op
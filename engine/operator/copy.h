@@ -40,10 +40,13 @@ class Copy : public Operator {
   std::shared_ptr<arrow::Table> ConstructTableFromTensors(
       ExecContext* ctx, const RepeatedTensor& input_pbs);
 
-  std::shared_ptr<arrow::Buffer> SerializeTable(
-      std::shared_ptr<arrow::Table> table);
+  // SendTable streams table in record batches of FLAGS_copy_batch_rows rows,
+  // each batch is sent as soon as it is serialized.
+  void SendTable(ExecContext* ctx, std::shared_ptr<arrow::Table> table,
+                 size_t to_rank);
 
-  std::shared_ptr<arrow::Table> DeserializeTable(yacl::Buffer value);
+  // RecvTable collects record batches as they arrive.
+  std::shared_ptr<arrow::Table> RecvTable(ExecContext* ctx, size_t from_rank);
 
   void InsertTensorsFromTable(ExecContext* ctx,
                               const RepeatedTensor& output_pbs,
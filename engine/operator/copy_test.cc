@@ -15,6 +15,7 @@
 #include "engine/operator/copy.h"
 
 #include "arrow/type.h"
+#include "gflags/gflags.h"
 #include "gtest/gtest.h"
 
 #include "engine/core/tensor_from_json.h"
@@ -22,6 +23,10 @@
 
 namespace scql::engine::op {
 
+DECLARE_int64(copy_batch_rows);
+DECLARE_string(copy_ipc_compression);
+DECLARE_int64(copy_max_inflight_batches);
+
 struct CopyTestCase {
   std::vector<test::NamedTensor> datas;
   std::vector<std::string> output_names;
@@ -33,6 +38,8 @@ class CopyTest : public ::testing::TestWithParam<
   static pb::ExecNode MakeCopyExecNode(const CopyTestCase& tc);
 
   static void FeedInputs(ExecContext* ctx, const CopyTestCase& tc);
+
+  static void RunAndCheck(spu::ProtocolKind protocol, const CopyTestCase& tc);
 };
 
 INSTANTIATE_TEST_SUITE_P(
@@ -53,6 +60,13 @@ INSTANTIATE_TEST_SUITE_P(
                     "x1", TensorFromJSON(arrow::utf8(),
                                          R"json(["D","C",null,"B","A"])json"))},
                 .output_names = {"x1_copy"}},
+            CopyTestCase{
+                .datas = {test::NamedTensor(
+                    "x1",
+                    TensorFromJSON(
+                        arrow::dictionary(arrow::int32(), arrow::utf8()),
+                        R"json(["D","C",null,"D","C","D"])json"))},
+                .output_names = {"x1_copy"}},
             CopyTestCase{
                 .datas = {test::NamedTensor(
                     "x1", TensorFromJSON(arrow::int64(),
@@ -61,42 +75,19 @@ INSTANTIATE_TEST_SUITE_P(
     TestParamNameGenerator(CopyTest));
 
 TEST_P(CopyTest, works) {
-  // Given
   auto parm = GetParam();
-  auto tc = std::get<1>(parm);
-  auto node = MakeCopyExecNode(tc);
-  std::vector<Session> sessions = test::Make2PCSession(std::get<0>(parm));
-
-  ExecContext alice_ctx(node, &sessions[0]);
-  ExecContext bob_ctx(node, &sessions[1]);
-
-  // feed inputs, test copy from alice to bob.
-  FeedInputs(&alice_ctx, tc);
-
-  // When
-  test::OperatorTestRunner<Copy> alice;
-  test::OperatorTestRunner<Copy> bob;
-
-  alice.Start(&alice_ctx);
-  bob.Start(&bob_ctx);
-
-  // Then
-  EXPECT_NO_THROW({ alice.Wait(); });
-  EXPECT_NO_THROW({ bob.Wait(); });
+  RunAndCheck(std::get<0>(parm), std::get<1>(parm));
+}
 
-  // check bob output
-  auto tensor_table = bob_ctx.GetTensorTable();
-  for (size_t i = 0; i < tc.output_names.size(); ++i) {
-    auto in_arr = tc.datas[i].tensor->ToArrowChunkedArray();
-    auto out = tensor_table->GetTensor(tc.output_names[i]);
-    ASSERT_TRUE(out);
-    // compare tensor content
-    EXPECT_TRUE(out->ToArrowChunkedArray()->Equals(in_arr))
-        << "expect type = " << in_arr->type()->ToString()
-        << ", got type = " << out->ToArrowChunkedArray()->type()->ToString()
-        << "\nexpect result = " << in_arr->ToString()
-        << "\nbut actual got result = "
-        << out->ToArrowChunkedArray()->ToString();
+TEST_P(CopyTest, worksInSmallBatches) {
+  gflags::FlagSaver saver;
+  auto parm = GetParam();
+  // one batch in flight makes the sender wait for an ack of every batch
+  FLAGS_copy_max_inflight_batches = 1;
+  for (const auto* compression : {"uncompressed", "lz4", "zstd"}) {
+    FLAGS_copy_batch_rows = 2;
+    FLAGS_copy_ipc_compression = compression;
+    RunAndCheck(std::get<0>(parm), std::get<1>(parm));
   }
 }
 
@@ -136,4 +127,42 @@ void CopyTest::FeedInputs(ExecContext* ctx, const CopyTestCase& tc) {
   test::FeedInputsAsPrivate(ctx, tc.datas);
 }
 
-}  // namespace scql::engine::op
\ No newline at end of file
+void CopyTest::RunAndCheck(spu::ProtocolKind protocol, const CopyTestCase& tc) {
+  // Given
+  auto node = MakeCopyExecNode(tc);
+  std::vector<Session> sessions = test::Make2PCSession(protocol);
+
+  ExecContext alice_ctx(node, &sessions[0]);
+  ExecContext bob_ctx(node, &sessions[1]);
+
+  // feed inputs, test copy from alice to bob.
+  FeedInputs(&alice_ctx, tc);
+
+  // When
+  test::OperatorTestRunner<Copy> alice;
+  test::OperatorTestRunner<Copy> bob;
+
+  alice.Start(&alice_ctx);
+  bob.Start(&bob_ctx);
+
+  // Then
+  EXPECT_NO_THROW({ alice.Wait(); });
+  EXPECT_NO_THROW({ bob.Wait(); });
+
+  // check bob output
+  auto tensor_table = bob_ctx.GetTensorTable();
+  for (size_t i = 0; i < tc.output_names.size(); ++i) {
+    auto in_arr = tc.datas[i].tensor->ToArrowChunkedArray();
+    auto out = tensor_table->GetTensor(tc.output_names[i]);
+    ASSERT_TRUE(out);
+    // compare tensor content
+    EXPECT_TRUE(out->ToArrowChunkedArray()->Equals(in_arr))
+        << "expect type = " << in_arr->type()->ToString()
+        << ", got type = " << out->ToArrowChunkedArray()->type()->ToString()
+        << "\nexpect result = " << in_arr->ToString()
+        << "\nbut actual got result = "
+        << out->ToArrowChunkedArray()->ToString();
+  }
+}
+
+}  // namespace scql::engine::op
@@ -14,14 +14,22 @@
 
 #include "engine/operator/dump_file.h"
 
+#include <chrono>
 #include <filesystem>
 
 #include "arrow/csv/writer.h"
+#include "arrow/filesystem/filesystem.h"
 #include "arrow/io/file.h"
+#include "arrow/ipc/writer.h"
 #include "arrow/table.h"
+#include "arrow/util/compression.h"
 #include "gflags/gflags.h"
+#include "parquet/arrow/writer.h"
+#include "yacl/utils/parallel.h"
 
 #include "engine/core/arrow_helper.h"
+#include "engine/util/dictionary_util.h"
+#include "engine/util/s3_filesystem.h"
 #include "engine/util/tensor_util.h"
 
 namespace scql::engine::op {
@@ -33,6 +41,167 @@ DEFINE_bool(enable_restricted_write_path, true,
 DEFINE_string(
     restricted_write_path, "./data",
     "in where the file is allow to write if enable restricted write path");
+DEFINE_int64(dump_file_partition_rows, 0,
+             "max rows of one file written by DumpFile, larger output is "
+             "split into several files written in parallel, no limit if <= 0");
+DEFINE_int64(dump_file_row_group_rows, 1 << 20,
+             "max rows of one parquet row group or arrow ipc record batch "
+             "written by DumpFile");
+DEFINE_string(dump_file_s3_endpoint, "",
+              "host[:port] of the S3-compatible service where DumpFile writes "
+              "file path in form of s3://bucket/key, s3 is disabled if empty");
+DEFINE_string(dump_file_s3_access_key, "", "access key of s3 service");
+DEFINE_string(dump_file_s3_secret_key, "", "secret key of s3 service");
+DEFINE_string(dump_file_s3_region, "us-east-1", "region of s3 service");
+DEFINE_bool(dump_file_s3_use_ssl, true, "whether to access s3 by https");
+DEFINE_string(restricted_s3_write_path, "",
+              "s3://bucket/prefix in where DumpFile is allowed to write if "
+              "enable restricted write path, no s3 path is allowed if empty");
+
+namespace {
+
+enum class FileFormat { kCsv, kParquet, kArrowIpc };
+
+bool IsS3Path(const std::string& path) { return path.rfind("s3://", 0) == 0; }
+
+// @returns true if s3 @param[in] path is @param[in] dir itself or under it,
+// false if dir is empty.
+bool IsUnderS3Path(const std::string& path, const std::string& dir) {
+  if (dir.empty()) {
+    return false;
+  }
+  std::string prefix = dir.back() == '/' ? dir : dir + "/";
+  return path == dir || path.rfind(prefix, 0) == 0;
+}
+
+FileFormat ParseFileFormat(const std::string& format) {
+  if (format == DumpFile::kFormatCsv) {
+    return FileFormat::kCsv;
+  }
+  if (format == DumpFile::kFormatParquet) {
+    return FileFormat::kParquet;
+  }
+  if (format == DumpFile::kFormatArrowIpc) {
+    return FileFormat::kArrowIpc;
+  }
+  YACL_THROW("unsupported DumpFile format={}", format);
+}
+
+// @returns path of each partition, the path itself is used if there is only
+// one partition, otherwise "dir/name.csv" becomes "dir/name-00000.csv", ...
+std::vector<std::string> GetPartitionFiles(const std::string& file,
+                                           int64_t num_parts) {
+  if (num_parts == 1) {
+    return {file};
+  }
+  std::filesystem::path path(file);
+  std::vector<std::string> result;
+  for (int64_t i = 0; i < num_parts; ++i) {
+    result.push_back((path.parent_path() /
+                      fmt::format("{}-{:05d}{}", path.stem().string(), i,
+                                  path.extension().string()))
+                         .string());
+  }
+  return result;
+}
+
+void WriteCsv(const arrow::Table& table, char delimiter,
+              arrow::io::OutputStream* out) {
+  arrow::csv::WriteOptions options;
+  options.delimiter = delimiter;
+  THROW_IF_ARROW_NOT_OK(arrow::csv::WriteCSV(table, options, out));
+}
+
+void WriteParquet(const arrow::Table& table,
+                  const std::shared_ptr<arrow::io::OutputStream>& out) {
+  auto props = parquet::WriterProperties::Builder()
+                   .compression(parquet::Compression::ZSTD)
+                   ->build();
+  THROW_IF_ARROW_NOT_OK(
+      parquet::arrow::WriteTable(table, arrow::default_memory_pool(), out,
+                                 FLAGS_dump_file_row_group_rows, props));
+}
+
+void WriteArrowIpc(const arrow::Table& table,
+                   const std::shared_ptr<arrow::io::OutputStream>& out) {
+  auto options = arrow::ipc::IpcWriteOptions::Defaults();
+  ASSIGN_OR_THROW_ARROW_STATUS(
+      options.codec,
+      arrow::util::Codec::Create(arrow::Compression::type::ZSTD));
+  std::shared_ptr<arrow::ipc::RecordBatchWriter> writer;
+  ASSIGN_OR_THROW_ARROW_STATUS(
+      writer, arrow::ipc::MakeFileWriter(out, table.schema(), options));
+  THROW_IF_ARROW_NOT_OK(
+      writer->WriteTable(table, FLAGS_dump_file_row_group_rows));
+  THROW_IF_ARROW_NOT_OK(writer->Close());
+}
+
+std::shared_ptr<arrow::fs::FileSystem> MakeS3FileSystem() {
+  util::S3Options options;
+  options.endpoint = FLAGS_dump_file_s3_endpoint;
+  options.access_key = FLAGS_dump_file_s3_access_key;
+  options.secret_key = FLAGS_dump_file_s3_secret_key;
+  options.region = FLAGS_dump_file_s3_region;
+  options.use_ssl = FLAGS_dump_file_s3_use_ssl;
+  std::shared_ptr<arrow::fs::FileSystem> fs;
+  ASSIGN_OR_THROW_ARROW_STATUS(fs, util::MakeS3FileSystem(options));
+  return fs;
+}
+
+// @returns path "bucket/key" in s3 filesystem of @param[in] file
+// "s3://bucket/key"
+std::string GetS3FsPath(const std::string& file) {
+  std::string bucket;
+  std::string key;
+  YACL_ENFORCE(util::ParseS3Uri(file, &bucket, &key),
+               "invalid s3 path={}, should be s3://bucket/key", file);
+  return bucket + "/" + key;
+}
+
+// @param[in] s3_fs is used if not null, otherwise file is written locally.
+std::shared_ptr<arrow::io::OutputStream> OpenFile(
+    const std::string& file, arrow::fs::FileSystem* s3_fs) {
+  std::shared_ptr<arrow::io::OutputStream> out_stream;
+  if (s3_fs != nullptr) {
+    ASSIGN_OR_THROW_ARROW_STATUS(out_stream,
+                                 s3_fs->OpenOutputStream(GetS3FsPath(file)));
+  } else {
+    ASSIGN_OR_THROW_ARROW_STATUS(
+        out_stream, arrow::io::FileOutputStream::Open(file, false));
+  }
+  return out_stream;
+}
+
+// @returns number of bytes written
+int64_t WriteFile(const arrow::Table& table, const std::string& file,
+                  arrow::fs::FileSystem* s3_fs, FileFormat format,
+                  char delimiter) {
+  auto out_stream = OpenFile(file, s3_fs);
+  try {
+    switch (format) {
+      case FileFormat::kCsv:
+        WriteCsv(table, delimiter, out_stream.get());
+        break;
+      case FileFormat::kParquet:
+        WriteParquet(table, out_stream);
+        break;
+      case FileFormat::kArrowIpc:
+        WriteArrowIpc(table, out_stream);
+        break;
+    }
+  } catch (const std::exception&) {
+    // s3 stream completes the upload if destroyed without closing, abort it
+    // to not leave a truncated object.
+    (void)out_stream->Abort();
+    throw;
+  }
+  int64_t bytes;
+  ASSIGN_OR_THROW_ARROW_STATUS(bytes, out_stream->Tell());
+  THROW_IF_ARROW_NOT_OK(out_stream->Close());
+  return bytes;
+}
+
+}  // namespace
 
 const std::string DumpFile::kOpType("DumpFile");
 const std::string& DumpFile::Type() const { return kOpType; }
@@ -52,6 +221,7 @@ void DumpFile::Validate(ExecContext* ctx) {
 void DumpFile::Execute(ExecContext* ctx) {
   const auto& input_pbs = ctx->GetInput(kIn);
   const auto& output_pbs = ctx->GetOutput(kOut);
+  auto format = ParseFileFormat(GetFormat(ctx));
 
   std::vector<std::shared_ptr<arrow::Field>> fields;
   std::vector<std::shared_ptr<arrow::ChunkedArray>> chunked_arrs;
@@ -61,6 +231,10 @@ void DumpFile::Execute(ExecContext* ctx) {
     auto tensor = ctx->GetTensorTable()->GetTensor(input_pb.name());
     YACL_ENFORCE(tensor != nullptr, "get tensor={} from tensor table failed",
                  input_pb.name());
+    // parquet and arrow ipc keep dictionaries, csv writes plain values.
+    if (format == FileFormat::kCsv) {
+      tensor = util::DictionaryDecode(tensor);
+    }
     auto chunked_arr = tensor->ToArrowChunkedArray();
 
     auto column_out = util::GetStringValue(output_pbs[i]);
@@ -77,30 +251,95 @@ void DumpFile::Execute(ExecContext* ctx) {
   auto table = arrow::Table::Make(arrow::schema(fields), chunked_arrs);
   YACL_ENFORCE(table, "create table failed");
 
-  const auto& absolute_path_file = GetAbsolutePathFile(ctx);
-  YACL_ENFORCE(!std::filesystem::exists(absolute_path_file),
-               "file={} exists before write", absolute_path_file);
-  std::filesystem::create_directories(
-      std::filesystem::path(absolute_path_file).parent_path());
+  int64_t partition_rows =
+      FLAGS_dump_file_partition_rows > 0 ? FLAGS_dump_file_partition_rows
+                                         : std::max<int64_t>(length, 1);
+  int64_t num_parts =
+      std::max<int64_t>((length + partition_rows - 1) / partition_rows, 1);
 
-  std::shared_ptr<arrow::io::FileOutputStream> out_stream;
-  ASSIGN_OR_THROW_ARROW_STATUS(
-      out_stream, arrow::io::FileOutputStream::Open(absolute_path_file, false));
+  const auto& absolute_path_file = GetAbsolutePathFile(ctx);
+  auto files = GetPartitionFiles(absolute_path_file, num_parts);
+  std::shared_ptr<arrow::fs::FileSystem> s3_fs;
+  if (IsS3Path(absolute_path_file)) {
+    s3_fs = MakeS3FileSystem();
+    for (const auto& file : files) {
+      arrow::fs::FileInfo info;
+      ASSIGN_OR_THROW_ARROW_STATUS(info,
+                                   s3_fs->GetFileInfo(GetS3FsPath(file)));
+      YACL_ENFORCE(info.type() == arrow::fs::FileType::NotFound,
+                   "file={} exists before write", file);
+    }
+  } else {
+    for (const auto& file : files) {
+      YACL_ENFORCE(!std::filesystem::exists(file),
+                   "file={} exists before write", file);
+    }
+    std::filesystem::create_directories(
+        std::filesystem::path(absolute_path_file).parent_path());
+  }
 
-  arrow::csv::WriteOptions options;
-  options.delimiter =
-      ctx->GetStringValueFromAttribute(kDeliminatorAttr).front();
+  char delimiter = ctx->GetStringValueFromAttribute(kDeliminatorAttr).front();
+  auto start = std::chrono::steady_clock::now();
+  std::vector<int64_t> bytes(num_parts, 0);
+  // each partition is a zero-copy slice of the table written to its own file.
+  yacl::parallel_for(0, num_parts, 1, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      auto part = table->Slice(i * partition_rows, partition_rows);
+      bytes[i] = WriteFile(*part, files[i], s3_fs.get(), format, delimiter);
+    }
+  });
+  auto cost_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
 
-  THROW_IF_ARROW_NOT_OK(
-      arrow::csv::WriteCSV(*table, options, out_stream.get()));
+  int64_t total_bytes = 0;
+  for (auto b : bytes) {
+    total_bytes += b;
+  }
+  SPDLOG_INFO(
+      "DumpFile wrote {} rows, {} bytes into {} {} file(s) in {}ms, "
+      "throughput={:.2f}MB/s",
+      length, total_bytes, num_parts, GetFormat(ctx), cost_ms,
+      static_cast<double>(total_bytes) / (1 << 20) * 1000 /
+          std::max<int64_t>(cost_ms, 1));
 
   ctx->GetSession()->SetAffectedRows(length);
-  // TODO(jingshi): support put file to oss/minio/s3
+  ctx->GetSession()->SetWrittenFiles(total_bytes, num_parts);
+}
+
+std::string DumpFile::GetFormat(ExecContext* ctx) {
+  std::string format = kFormatCsv;
+  try {
+    format = ctx->GetStringValueFromAttribute(kFormatAttr);
+  } catch (const ::yacl::EnforceNotMet&) {
+    // attribute format is optional, csv is used by default.
+  }
+  return format;
 }
 
 std::string DumpFile::GetAbsolutePathFile(ExecContext* ctx) {
   const std::string& file_path_attr =
       ctx->GetStringValueFromAttribute(kFilePathAttr);
+  if (IsS3Path(file_path_attr)) {
+    YACL_ENFORCE(!FLAGS_dump_file_s3_endpoint.empty(),
+                 "path={} is not allowed since s3 endpoint is not configured",
+                 file_path_attr);
+    std::string bucket;
+    std::string key;
+    YACL_ENFORCE(util::ParseS3Uri(file_path_attr, &bucket, &key),
+                 "invalid s3 path={}, should be s3://bucket/key",
+                 file_path_attr);
+    YACL_ENFORCE(key.find("..") == std::string::npos,
+                 "s3 path={} can not contain '..'", file_path_attr);
+    if (FLAGS_enable_restricted_write_path) {
+      YACL_ENFORCE(
+          IsUnderS3Path(file_path_attr, FLAGS_restricted_s3_write_path),
+          "enable restricted write path, s3 path={} is not under restricted "
+          "s3 write path={}",
+          file_path_attr, FLAGS_restricted_s3_write_path);
+    }
+    return file_path_attr;
+  }
   std::filesystem::path final_path;
   if (FLAGS_enable_restricted_write_path) {
     auto pos = file_path_attr.find("..");
@@ -18,7 +18,10 @@
 
 namespace scql::engine::op {
 
-/// @brief DumpFile write private data to a specific file path in CSV format
+/// @brief DumpFile write private data to a specific file path in CSV, Parquet
+/// or Arrow IPC file format. Large output is split into several files which
+/// are written in parallel. Path in form of "s3://bucket/key" is uploaded to
+/// the S3-compatible service configured by flag dump_file_s3_endpoint.
 class DumpFile : public Operator {
  public:
   static const std::string kOpType;
@@ -27,6 +30,13 @@ class DumpFile : public Operator {
   static constexpr char kOut[] = "Out";
   static constexpr char kFilePathAttr[] = "file_path";
   static constexpr char kDeliminatorAttr[] = "deliminator";
+  static constexpr char kFormatAttr[] = "format";
+
+  static constexpr char kFormatCsv[] = "csv";
+  // parquet compressed by zstd
+  static constexpr char kFormatParquet[] = "parquet";
+  // arrow ipc file format(feather v2) compressed by zstd
+  static constexpr char kFormatArrowIpc[] = "arrow";
 
   const std::string& Type() const override;
 
@@ -36,6 +46,8 @@ class DumpFile : public Operator {
 
  private:
   std::string GetAbsolutePathFile(ExecContext* ctx);
+
+  static std::string GetFormat(ExecContext* ctx);
 };
 
 }  // namespace scql::engine::op
\ No newline at end of file
@@ -14,26 +14,36 @@
 
 #include "engine/operator/dump_file.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <filesystem>
 
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
 #include "butil/file_util.h"
 #include "gflags/gflags.h"
 #include "gtest/gtest.h"
+#include "parquet/arrow/reader.h"
 
 #include "engine/core/tensor_from_json.h"
 #include "engine/operator/test_util.h"
+#include "engine/util/mock_s3_server.h"
 
 namespace scql::engine::op {
 
 DECLARE_bool(enable_restricted_write_path);
 DECLARE_string(restricted_write_path);
+DECLARE_int64(dump_file_partition_rows);
+DECLARE_string(dump_file_s3_endpoint);
+DECLARE_bool(dump_file_s3_use_ssl);
+DECLARE_string(restricted_s3_write_path);
 
 struct DumpFileTestCase {
   std::vector<test::NamedTensor> inputs;
   std::vector<std::string> output_names;
   std::string output_file_path;
   std::string output_file_content;
+  std::string format;
 };
 
 class DumpFileTest : public ::testing::TestWithParam<DumpFileTestCase> {
@@ -115,6 +125,137 @@ TEST_P(DumpFileTest, works) {
   remove(file_path.c_str());
 }
 
+class DumpFileFormatTest : public DumpFileTest {
+ protected:
+  static int64_t CountRows(const std::string& file, const std::string& format);
+};
+
+TEST_F(DumpFileFormatTest, writesPartitionsInEachFormat) {
+  gflags::FlagSaver saver;
+  FLAGS_restricted_write_path = std::filesystem::temp_directory_path();
+  FLAGS_dump_file_partition_rows = 3;
+
+  for (const std::string format :
+       {DumpFile::kFormatCsv, DumpFile::kFormatParquet,
+        DumpFile::kFormatArrowIpc}) {
+    // Given
+    DumpFileTestCase tc{
+        .inputs = {test::NamedTensor(
+                       "x1", TensorFromJSON(arrow::int64(),
+                                            "[0,1,2,3,4,5,6,7]")),
+                   test::NamedTensor(
+                       "x2",
+                       TensorFromJSON(arrow::utf8(),
+                                      R"(["a","b","c","d","e","f","g","h"])"))},
+        .output_names = {"x1_dump", "x2_dump"},
+        .output_file_path = "dump_partition_test/out." + format,
+        .format = format};
+    auto node = MakeDumpFileExecNode(tc);
+    auto session = test::Make1PCSession();
+    ExecContext ctx(node, &session);
+    FeedInputs(&ctx, tc);
+
+    // When
+    DumpFile op;
+    ASSERT_NO_THROW(op.Run(&ctx));
+
+    // Then
+    EXPECT_EQ(8, session.GetAffectedRows());
+    EXPECT_EQ(3, session.GetWrittenFiles());
+    std::vector<int64_t> expect_rows = {3, 3, 2};
+    int64_t expect_bytes = 0;
+    for (size_t i = 0; i < expect_rows.size(); ++i) {
+      std::string file_path =
+          fmt::format("{}/dump_partition_test/out-{:05d}.{}",
+                      FLAGS_restricted_write_path, i, format);
+      EXPECT_EQ(expect_rows[i], CountRows(file_path, format));
+      expect_bytes += std::filesystem::file_size(file_path);
+      remove(file_path.c_str());
+    }
+    EXPECT_EQ(expect_bytes, session.GetWrittenBytes());
+  }
+}
+
+TEST_F(DumpFileTest, writesToS3) {
+  // Given
+  util::MockS3Server s3_server;
+  gflags::FlagSaver saver;
+  FLAGS_dump_file_s3_endpoint = s3_server.Start();
+  ASSERT_FALSE(FLAGS_dump_file_s3_endpoint.empty());
+  FLAGS_dump_file_s3_use_ssl = false;
+  FLAGS_restricted_s3_write_path = "s3://bucket/dump_s3_test";
+  FLAGS_dump_file_partition_rows = 3;
+
+  DumpFileTestCase tc{
+      .inputs = {test::NamedTensor(
+          "x1", TensorFromJSON(arrow::int64(), "[0,1,2,3,4]"))},
+      .output_names = {"x1_dump"},
+      .output_file_path = "s3://bucket/dump_s3_test/out.csv"};
+  auto node = MakeDumpFileExecNode(tc);
+  auto session = test::Make1PCSession();
+  ExecContext ctx(node, &session);
+  FeedInputs(&ctx, tc);
+
+  // When
+  DumpFile op;
+  ASSERT_NO_THROW(op.Run(&ctx));
+
+  // Then
+  EXPECT_EQ(5, session.GetAffectedRows());
+  EXPECT_EQ(s3_server.GetObject("/bucket/dump_s3_test/out-00000.csv"),
+            "\"x1_dump\"\n0\n1\n2\n");
+  EXPECT_EQ(s3_server.GetObject("/bucket/dump_s3_test/out-00001.csv"),
+            "\"x1_dump\"\n3\n4\n");
+}
+
+TEST_F(DumpFileTest, s3PathRestricted) {
+  // Given
+  util::MockS3Server s3_server;
+  gflags::FlagSaver saver;
+  FLAGS_dump_file_s3_endpoint = s3_server.Start();
+  ASSERT_FALSE(FLAGS_dump_file_s3_endpoint.empty());
+  FLAGS_dump_file_s3_use_ssl = false;
+  FLAGS_restricted_s3_write_path = "s3://bucket/dump_s3_test";
+  s3_server.PutObject("/bucket/dump_s3_test/exists.csv", "x1_dump\n0\n");
+
+  // When
+  // Then
+  for (const auto* path :
+       {"s3://bucket/dump_s3_test_other/out.csv", "s3://other/out.csv",
+        "s3://bucket/dump_s3_test/exists.csv"}) {
+    DumpFileTestCase tc{
+        .inputs = {test::NamedTensor("x1",
+                                     TensorFromJSON(arrow::int64(), "[0]"))},
+        .output_names = {"x1_dump"},
+        .output_file_path = path};
+    auto node = MakeDumpFileExecNode(tc);
+    auto session = test::Make1PCSession();
+    ExecContext ctx(node, &session);
+    FeedInputs(&ctx, tc);
+
+    DumpFile op;
+    EXPECT_THROW(op.Run(&ctx), ::yacl::EnforceNotMet) << path;
+  }
+  EXPECT_EQ(s3_server.GetObject("/bucket/dump_s3_test/exists.csv"),
+            "x1_dump\n0\n");
+  EXPECT_EQ(s3_server.NumObjects(), 1);
+}
+
+TEST_F(DumpFileTest, s3DisabledWithoutEndpoint) {
+  DumpFileTestCase tc{
+      .inputs = {test::NamedTensor("x1",
+                                   TensorFromJSON(arrow::int64(), "[0,1]"))},
+      .output_names = {"x1_dump"},
+      .output_file_path = "s3://bucket/out.csv"};
+  auto node = MakeDumpFileExecNode(tc);
+  auto session = test::Make1PCSession();
+  ExecContext ctx(node, &session);
+  FeedInputs(&ctx, tc);
+
+  DumpFile op;
+  EXPECT_THROW(op.Run(&ctx), ::yacl::EnforceNotMet);
+}
+
 /// ===========================
 /// DumpFileTest impl
 /// ===========================
@@ -127,6 +268,9 @@ pb::ExecNode DumpFileTest::MakeDumpFileExecNode(const DumpFileTestCase& tc) {
                          std::vector<std::string>{tc.output_file_path});
   builder.AddStringsAttr(DumpFile::kDeliminatorAttr,
                          std::vector<std::string>{","});
+  if (!tc.format.empty()) {
+    builder.AddStringAttr(DumpFile::kFormatAttr, tc.format);
+  }
   // Add inputs
   std::vector<pb::Tensor> input_datas;
   for (const auto& named_tensor : tc.inputs) {
@@ -155,4 +299,34 @@ void DumpFileTest::FeedInputs(ExecContext* ctx, const DumpFileTestCase& tc) {
   test::FeedInputsAsPrivate(ctx, tc.inputs);
 }
 
-}  // namespace scql::engine::op
\ No newline at end of file
+int64_t DumpFileFormatTest::CountRows(const std::string& file,
+                                      const std::string& format) {
+  if (format == DumpFile::kFormatCsv) {
+    std::string content;
+    EXPECT_TRUE(butil::ReadFileToString(butil::FilePath(file), &content));
+    // exclude the header line
+    return std::count(content.begin(), content.end(), '\n') - 1;
+  }
+  auto input = arrow::io::ReadableFile::Open(file);
+  EXPECT_TRUE(input.ok());
+  if (format == DumpFile::kFormatParquet) {
+    std::unique_ptr<parquet::arrow::FileReader> reader;
+    EXPECT_TRUE(parquet::arrow::OpenFile(*input, arrow::default_memory_pool(),
+                                         &reader)
+                    .ok());
+    std::shared_ptr<arrow::Table> table;
+    EXPECT_TRUE(reader->ReadTable(&table).ok());
+    return table->num_rows();
+  }
+  auto reader = arrow::ipc::RecordBatchFileReader::Open(*input);
+  EXPECT_TRUE(reader.ok());
+  int64_t rows = 0;
+  for (int i = 0; i < (*reader)->num_record_batches(); ++i) {
+    auto batch = (*reader)->ReadRecordBatch(i);
+    EXPECT_TRUE(batch.ok());
+    rows += (*batch)->num_rows();
+  }
+  return rows;
+}
+
+}  // namespace scql::engine::op
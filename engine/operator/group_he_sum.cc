@@ -0,0 +1,533 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "engine/operator/group_he_sum.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <numeric>
+
+#include "absl/container/flat_hash_map.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/compute/api.h"
+#include "gflags/gflags.h"
+#include "heu/library/phe/phe.h"
+#include "openssl/rand.h"
+#include "yacl/base/int128.h"
+#include "yacl/utils/parallel.h"
+
+#include "engine/core/arrow_helper.h"
+#include "engine/util/dictionary_util.h"
+#include "engine/util/tensor_util.h"
+
+namespace scql::engine::op {
+
+DEFINE_int32(group_he_sum_key_bits, 2048,
+             "bits of paillier modulus used by GroupHeSum");
+DEFINE_int64(group_he_sum_batch_rows, 1 << 12,
+             "rows of ciphertexts sent in one message by GroupHeSum");
+
+namespace {
+
+namespace phe = heu::lib::phe;
+
+constexpr int64_t kCryptoGrainSize = 64;
+constexpr int64_t kSumGrainSize = 1 << 12;
+// masks are uniform in [0, 2^kMaskBits), which statistically hides sums of
+// int64 values from the value party
+constexpr int kMaskBits = 126;
+
+std::shared_ptr<arrow::Array> Concatenate(const arrow::ChunkedArray& arr) {
+  if (arr.num_chunks() == 1) {
+    return arr.chunk(0);
+  }
+  std::shared_ptr<arrow::Array> result;
+  if (arr.num_chunks() == 0) {
+    ASSIGN_OR_THROW_ARROW_STATUS(result, arrow::MakeEmptyArray(arr.type()));
+  } else {
+    ASSIGN_OR_THROW_ARROW_STATUS(result, arrow::Concatenate(arr.chunks()));
+  }
+  return result;
+}
+
+bool IsFloat(const pb::Tensor& t) {
+  return t.elem_type() == pb::PrimitiveDataType::FLOAT ||
+         t.elem_type() == pb::PrimitiveDataType::DOUBLE;
+}
+
+TensorPtr GetPrivateTensor(ExecContext* ctx, const pb::Tensor& t) {
+  auto tensor = ctx->GetTensorTable()->GetTensor(t.name());
+  YACL_ENFORCE(tensor, "get private tensor failed, name={}", t.name());
+  return tensor;
+}
+
+/// @returns values of @param[in] t encoded as int64, floats are scaled to
+/// fixed point and nulls are taken as 0, so a group of nulls sums to 0.
+std::vector<int64_t> EncodeValues(ExecContext* ctx, const pb::Tensor& t) {
+  auto chunked = GetPrivateTensor(ctx, t)->ToArrowChunkedArray();
+  std::vector<int64_t> values;
+  values.reserve(chunked->length());
+  if (IsFloat(t)) {
+    arrow::Datum casted;
+    ASSIGN_OR_THROW_ARROW_STATUS(
+        casted, arrow::compute::Cast(chunked, arrow::float64()));
+    const auto scale = static_cast<double>(int64_t(1) << GroupHeSum::kFxpBits);
+    for (const auto& chunk : casted.chunked_array()->chunks()) {
+      const auto& arr = static_cast<const arrow::DoubleArray&>(*chunk);
+      for (int64_t i = 0; i < arr.length(); ++i) {
+        if (arr.IsNull(i)) {
+          values.push_back(0);
+          continue;
+        }
+        const double scaled = arr.Value(i) * scale;
+        // llround is undefined out of int64, NaN fails the comparison too
+        YACL_ENFORCE(std::abs(scaled) < 0x1p63,
+                     "value {} of {} is out of range of fixed point with {} "
+                     "fraction bits",
+                     arr.Value(i), t.name(), GroupHeSum::kFxpBits);
+        values.push_back(std::llround(scaled));
+      }
+    }
+  } else {
+    arrow::Datum casted;
+    ASSIGN_OR_THROW_ARROW_STATUS(
+        casted, arrow::compute::Cast(chunked, arrow::int64()));
+    for (const auto& chunk : casted.chunked_array()->chunks()) {
+      const auto& arr = static_cast<const arrow::Int64Array&>(*chunk);
+      for (int64_t i = 0; i < arr.length(); ++i) {
+        values.push_back(arr.IsNull(i) ? 0 : arr.Value(i));
+      }
+    }
+  }
+  return values;
+}
+
+struct Groups {
+  // group id of every row, groups are numbered by first appearance
+  std::vector<int64_t> ids;
+  // index of the first row of every group
+  std::vector<int64_t> first_rows;
+  // rows of group g are rows[offsets[g]] ... rows[offsets[g + 1] - 1]
+  std::vector<int64_t> offsets;
+  std::vector<int64_t> rows;
+};
+
+/// @returns groups of rows with equal @param[in] keys, null is a group key.
+Groups GroupRows(const std::vector<TensorPtr>& keys) {
+  const int64_t length = keys[0]->Length();
+  Groups groups;
+  groups.ids.assign(length, 0);
+  groups.first_rows = {0};
+  if (length == 0) {
+    groups.first_rows.clear();
+    groups.offsets = {0};
+    return groups;
+  }
+
+  arrow::compute::DictionaryEncodeOptions options(
+      arrow::compute::DictionaryEncodeOptions::NullEncodingBehavior::ENCODE);
+  for (const auto& key : keys) {
+    YACL_ENFORCE_EQ(key->Length(), length, "keys should have the same length");
+    auto arr = Concatenate(*util::DictionaryDecode(key)->ToArrowChunkedArray());
+    arrow::Datum encoded;
+    ASSIGN_OR_THROW_ARROW_STATUS(
+        encoded, arrow::compute::DictionaryEncode(arr, options));
+    const auto& dict_arr =
+        static_cast<const arrow::DictionaryArray&>(*encoded.make_array());
+    std::shared_ptr<arrow::Array> indices;
+    ASSIGN_OR_THROW_ARROW_STATUS(
+        indices, arrow::compute::Cast(*dict_arr.indices(), arrow::int64()));
+    const auto* key_ids = indices->data()->GetValues<int64_t>(1);
+
+    // refine groups of previous keys by ids of this key
+    absl::flat_hash_map<std::pair<int64_t, int64_t>, int64_t> refined;
+    std::vector<int64_t> first_rows;
+    for (int64_t i = 0; i < length; ++i) {
+      auto [it, inserted] = refined.try_emplace(
+          std::make_pair(groups.ids[i], key_ids[i]), first_rows.size());
+      if (inserted) {
+        first_rows.push_back(i);
+      }
+      groups.ids[i] = it->second;
+    }
+    groups.first_rows = std::move(first_rows);
+  }
+
+  // order rows by group with a counting sort
+  const size_t group_num = groups.first_rows.size();
+  groups.offsets.assign(group_num + 1, 0);
+  for (auto id : groups.ids) {
+    ++groups.offsets[id + 1];
+  }
+  std::partial_sum(groups.offsets.begin(), groups.offsets.end(),
+                   groups.offsets.begin());
+  std::vector<int64_t> cursors(groups.offsets.begin(),
+                               groups.offsets.end() - 1);
+  groups.rows.resize(length);
+  for (int64_t i = 0; i < length; ++i) {
+    groups.rows[cursors[groups.ids[i]]++] = i;
+  }
+  return groups;
+}
+
+std::string_view AsStringView(const yacl::Buffer& buf) {
+  return std::string_view(buf.data<char>(), buf.size());
+}
+
+void AppendUint64(uint64_t v, std::string* out) {
+  out->append(reinterpret_cast<const char*>(&v), sizeof(v));
+}
+
+uint64_t ReadUint64(std::string_view* in) {
+  YACL_ENFORCE(in->size() >= sizeof(uint64_t), "truncated message");
+  uint64_t v;
+  std::memcpy(&v, in->data(), sizeof(v));
+  in->remove_prefix(sizeof(v));
+  return v;
+}
+
+/// Every ciphertext is serialized by HEU and prefixed by its length.
+std::string SerializeCiphertexts(const phe::Ciphertext* cs, size_t count) {
+  std::string out;
+  AppendUint64(count, &out);
+  for (size_t i = 0; i < count; ++i) {
+    auto buf = cs[i].Serialize();
+    AppendUint64(buf.size(), &out);
+    out.append(buf.data<char>(), buf.size());
+  }
+  return out;
+}
+
+std::vector<phe::Ciphertext> DeserializeCiphertexts(std::string_view in) {
+  const auto count = ReadUint64(&in);
+  std::vector<phe::Ciphertext> cs(count);
+  for (auto& c : cs) {
+    const auto size = ReadUint64(&in);
+    YACL_ENFORCE(in.size() >= size, "truncated ciphertext");
+    c.Deserialize(yacl::ByteContainerView(in.data(), size));
+    in.remove_prefix(size);
+  }
+  YACL_ENFORCE(in.empty(), "unexpected trailing bytes after ciphertexts");
+  return cs;
+}
+
+/// Exchanges row counts with the peer, so that mismatched inputs fail before
+/// any ciphertext is sent instead of blocking on a receive.
+void CheckRowCount(const std::shared_ptr<yacl::link::Context>& lctx,
+                   size_t peer_rank, const std::string& tag, size_t row_num) {
+  std::string msg;
+  AppendUint64(row_num, &msg);
+  lctx->SendAsync(peer_rank, yacl::ByteContainerView(msg), tag);
+  auto buf = lctx->Recv(peer_rank, tag);
+  std::string_view in = AsStringView(buf);
+  const auto peer_row_num = ReadUint64(&in);
+  YACL_ENFORCE_EQ(peer_row_num, row_num,
+                  "row count of keys and values should be the same");
+}
+
+void SendCiphertexts(const std::shared_ptr<yacl::link::Context>& lctx,
+                     size_t to_rank, const std::string& tag,
+                     const std::vector<phe::Ciphertext>& cs) {
+  const auto batch = static_cast<size_t>(FLAGS_group_he_sum_batch_rows);
+  for (size_t begin = 0; begin < cs.size(); begin += batch) {
+    const size_t end = std::min(cs.size(), begin + batch);
+    auto buf = SerializeCiphertexts(cs.data() + begin, end - begin);
+    lctx->SendAsync(to_rank, yacl::ByteContainerView(buf), tag);
+  }
+}
+
+std::vector<phe::Ciphertext> RecvCiphertexts(
+    const std::shared_ptr<yacl::link::Context>& lctx, size_t from_rank,
+    const std::string& tag, size_t count) {
+  std::vector<phe::Ciphertext> cs;
+  cs.reserve(count);
+  while (cs.size() < count) {
+    auto part = DeserializeCiphertexts(AsStringView(lctx->Recv(from_rank, tag)));
+    YACL_ENFORCE(!part.empty() && cs.size() + part.size() <= count,
+                 "received more ciphertexts than expected {}", count);
+    std::move(part.begin(), part.end(), std::back_inserter(cs));
+  }
+  return cs;
+}
+
+/// @returns ciphertexts of @param[in] values, encrypted in parallel.
+std::vector<phe::Ciphertext> EncryptAll(const phe::Encryptor& encryptor,
+                                        const phe::PlainEncoder& encoder,
+                                        const std::vector<int64_t>& values) {
+  std::vector<phe::Ciphertext> cs(values.size());
+  yacl::parallel_for(0, values.size(), kCryptoGrainSize,
+                     [&](int64_t begin, int64_t end) {
+                       for (int64_t i = begin; i < end; ++i) {
+                         cs[i] = encryptor.Encrypt(encoder.Encode(values[i]));
+                       }
+                     });
+  return cs;
+}
+
+/// @returns sums of ciphertexts @param[in] cs of every group.
+///
+/// Rows are visited in group order and split into fixed chunks. Every chunk
+/// yields one partial sum per run of equal groups, so partial sums take
+/// O(rows / kSumGrainSize + group_num) space in total.
+std::vector<phe::Ciphertext> SumByGroup(const phe::Evaluator& evaluator,
+                                        const std::vector<phe::Ciphertext>& cs,
+                                        const Groups& groups) {
+  const int64_t row_num = cs.size();
+  const int64_t chunk_num = (row_num + kSumGrainSize - 1) / kSumGrainSize;
+  std::vector<std::vector<std::pair<int64_t, phe::Ciphertext>>> partials(
+      chunk_num);
+  yacl::parallel_for(0, chunk_num, 1, [&](int64_t begin, int64_t end) {
+    for (int64_t c = begin; c < end; ++c) {
+      auto& partial = partials[c];
+      const int64_t last = std::min(row_num, (c + 1) * kSumGrainSize);
+      for (int64_t i = c * kSumGrainSize; i < last; ++i) {
+        const auto row = groups.rows[i];
+        const auto group = groups.ids[row];
+        if (partial.empty() || partial.back().first != group) {
+          partial.emplace_back(group, cs[row]);
+        } else {
+          evaluator.AddInplace(&partial.back().second, cs[row]);
+        }
+      }
+    }
+  });
+
+  // only groups on chunk boundaries have more than one partial sum
+  const size_t group_num = groups.first_rows.size();
+  std::vector<phe::Ciphertext> sums(group_num);
+  std::vector<bool> summed(group_num, false);
+  for (auto& partial : partials) {
+    for (auto& [group, c] : partial) {
+      if (summed[group]) {
+        evaluator.AddInplace(&sums[group], c);
+      } else {
+        sums[group] = std::move(c);
+        summed[group] = true;
+      }
+    }
+  }
+  return sums;
+}
+
+int128_t RandomMask() {
+  uint128_t mask;
+  YACL_ENFORCE(RAND_bytes(reinterpret_cast<unsigned char*>(&mask),
+                          sizeof(mask)) == 1,
+               "failed to generate random mask");
+  return static_cast<int128_t>(mask >> (128 - kMaskBits));
+}
+
+}  // namespace
+
+const std::string GroupHeSum::kOpType("GroupHeSum");
+
+const std::string& GroupHeSum::Type() const { return kOpType; }
+
+void GroupHeSum::Validate(ExecContext* ctx) {
+  const auto& keys = ctx->GetInput(kKey);
+  const auto& values = ctx->GetInput(kIn);
+  const auto& outs = ctx->GetOutput(kOut);
+  const auto& out_keys = ctx->GetOutput(kOutKey);
+  const auto& out_count = ctx->GetOutput(kOutCount);
+
+  YACL_ENFORCE(!keys.empty(), "{} input {} should not be empty", Type(), kKey);
+  YACL_ENFORCE(!values.empty(), "{} input {} should not be empty", Type(),
+               kIn);
+  YACL_ENFORCE(values.size() == outs.size(),
+               "{} input {} and output {} should have the same size", Type(),
+               kIn, kOut);
+  YACL_ENFORCE(keys.size() == out_keys.size(),
+               "{} input {} and output {} should have the same size", Type(),
+               kKey, kOutKey);
+  YACL_ENFORCE(out_count.size() == 1, "{} output {} size={} not equal to 1",
+               Type(), kOutCount, out_count.size());
+  for (const auto* tensors : {&keys, &values, &outs, &out_keys, &out_count}) {
+    YACL_ENFORCE(
+        util::AreTensorsStatusMatched(*tensors, pb::TENSORSTATUS_PRIVATE),
+        "{} inputs and outputs should all be private", Type());
+  }
+
+  const auto& party_codes =
+      ctx->GetStringValuesFromAttribute(kInputPartyCodesAttr);
+  YACL_ENFORCE(party_codes.size() == 2,
+               "invalid attribute {} value size, expect 2 but got={}",
+               kInputPartyCodesAttr, party_codes.size());
+  YACL_ENFORCE(party_codes[0] != party_codes[1],
+               "key party and value party should be different");
+}
+
+void GroupHeSum::Execute(ExecContext* ctx) {
+  const auto& party_codes =
+      ctx->GetStringValuesFromAttribute(kInputPartyCodesAttr);
+  const auto& self_party = ctx->GetSession()->SelfPartyCode();
+  if (self_party == party_codes[0]) {
+    auto rank = ctx->GetSession()->GetPartyRank(party_codes[1]);
+    YACL_ENFORCE(rank != -1, "unknown rank for party={}", party_codes[1]);
+    ExecuteAsKeyParty(ctx, rank);
+  } else if (self_party == party_codes[1]) {
+    auto rank = ctx->GetSession()->GetPartyRank(party_codes[0]);
+    YACL_ENFORCE(rank != -1, "unknown rank for party={}", party_codes[0]);
+    ExecuteAsValueParty(ctx, rank);
+  }
+}
+
+void GroupHeSum::ExecuteAsValueParty(ExecContext* ctx, size_t key_rank) {
+  auto lctx = ctx->GetSession()->GetLink();
+  const auto& tag = ctx->GetNodeName();
+  const auto& value_pbs = ctx->GetInput(kIn);
+
+  std::vector<std::vector<int64_t>> values;
+  for (const auto& value_pb : value_pbs) {
+    values.push_back(EncodeValues(ctx, value_pb));
+    YACL_ENFORCE_EQ(values.back().size(), values[0].size(),
+                    "values should have the same length");
+  }
+  CheckRowCount(lctx, key_rank, tag, values[0].size());
+
+  phe::HeKit he_kit(phe::SchemaType::ZPaillier, FLAGS_group_he_sum_key_bits);
+  const auto encoder = he_kit.GetEncoder<phe::PlainEncoder>(1);
+  lctx->SendAsync(key_rank,
+                  yacl::ByteContainerView(he_kit.GetPublicKey()->Serialize()),
+                  tag);
+
+  for (const auto& column : values) {
+    SendCiphertexts(lctx, key_rank, tag,
+                    EncryptAll(*he_kit.GetEncryptor(), encoder, column));
+  }
+
+  // decrypt masked sums of all columns for the key party
+  auto masked = DeserializeCiphertexts(AsStringView(lctx->Recv(key_rank, tag)));
+  std::vector<int128_t> plains(masked.size());
+  const auto& decryptor = he_kit.GetDecryptor();
+  yacl::parallel_for(
+      0, masked.size(), kCryptoGrainSize, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          plains[i] = encoder.Decode<int128_t>(decryptor->Decrypt(masked[i]));
+        }
+      });
+  lctx->SendAsync(key_rank,
+                  yacl::ByteContainerView(plains.data(),
+                                          plains.size() * sizeof(int128_t)),
+                  tag);
+}
+
+void GroupHeSum::ExecuteAsKeyParty(ExecContext* ctx, size_t value_rank) {
+  auto lctx = ctx->GetSession()->GetLink();
+  const auto& tag = ctx->GetNodeName();
+  const auto& key_pbs = ctx->GetInput(kKey);
+  const auto& value_pbs = ctx->GetInput(kIn);
+
+  std::vector<TensorPtr> keys;
+  for (const auto& key_pb : key_pbs) {
+    keys.push_back(GetPrivateTensor(ctx, key_pb));
+  }
+  const size_t row_num = keys[0]->Length();
+  CheckRowCount(lctx, value_rank, tag, row_num);
+  // groups are made while the value party is encrypting
+  auto groups = GroupRows(keys);
+  const size_t group_num = groups.first_rows.size();
+
+  phe::DestinationHeKit he_kit(AsStringView(lctx->Recv(value_rank, tag)));
+  const auto encoder = he_kit.GetEncoder<phe::PlainEncoder>(1);
+  const auto& encryptor = he_kit.GetEncryptor();
+  const auto& evaluator = he_kit.GetEvaluator();
+
+  // sums of all columns are masked by fresh encryptions of random plaintexts
+  // and sent in one message, so the value party only sees random values and
+  // can't link the sums to its ciphertexts.
+  std::vector<phe::Ciphertext> masked;
+  for (int i = 0; i < value_pbs.size(); ++i) {
+    auto cs = RecvCiphertexts(lctx, value_rank, tag, row_num);
+    auto sums = SumByGroup(*evaluator, cs, groups);
+    std::move(sums.begin(), sums.end(), std::back_inserter(masked));
+  }
+  std::vector<int128_t> masks(masked.size());
+  for (auto& mask : masks) {
+    mask = RandomMask();
+  }
+  yacl::parallel_for(
+      0, masked.size(), kCryptoGrainSize, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          evaluator->AddInplace(&masked[i],
+                                encryptor->Encrypt(encoder.Encode(masks[i])));
+        }
+      });
+  auto buf = SerializeCiphertexts(masked.data(), masked.size());
+  lctx->SendAsync(value_rank, yacl::ByteContainerView(buf), tag);
+
+  auto plains = lctx->Recv(value_rank, tag);
+  YACL_ENFORCE_EQ(static_cast<size_t>(plains.size()),
+                  masks.size() * sizeof(int128_t),
+                  "unexpected number of decrypted sums");
+  const auto* masked_sums = plains.data<int128_t>();
+
+  const auto& out_pbs = ctx->GetOutput(kOut);
+  for (int i = 0; i < value_pbs.size(); ++i) {
+    const bool is_float = IsFloat(value_pbs[i]);
+    arrow::Int64Builder int_builder;
+    arrow::DoubleBuilder float_builder;
+    for (size_t g = 0; g < group_num; ++g) {
+      const size_t j = i * group_num + g;
+      const auto sum = static_cast<int64_t>(masked_sums[j] - masks[j]);
+      if (is_float) {
+        THROW_IF_ARROW_NOT_OK(float_builder.Append(
+            std::ldexp(static_cast<double>(sum), -kFxpBits)));
+      } else {
+        THROW_IF_ARROW_NOT_OK(int_builder.Append(sum));
+      }
+    }
+    std::shared_ptr<arrow::Array> arr;
+    if (is_float) {
+      THROW_IF_ARROW_NOT_OK(float_builder.Finish(&arr));
+    } else {
+      THROW_IF_ARROW_NOT_OK(int_builder.Finish(&arr));
+    }
+    ctx->GetTensorTable()->AddTensor(
+        out_pbs[i].name(),
+        std::make_shared<Tensor>(std::make_shared<arrow::ChunkedArray>(arr)));
+  }
+
+  // the key party knows sizes of groups in plaintext
+  arrow::Int64Builder count_builder;
+  for (size_t g = 0; g < group_num; ++g) {
+    THROW_IF_ARROW_NOT_OK(
+        count_builder.Append(groups.offsets[g + 1] - groups.offsets[g]));
+  }
+  std::shared_ptr<arrow::Array> count;
+  THROW_IF_ARROW_NOT_OK(count_builder.Finish(&count));
+  ctx->GetTensorTable()->AddTensor(
+      ctx->GetOutput(kOutCount)[0].name(),
+      std::make_shared<Tensor>(std::make_shared<arrow::ChunkedArray>(count)));
+
+  // the key of every group is taken from its first row
+  arrow::Int64Builder first_rows_builder;
+  THROW_IF_ARROW_NOT_OK(first_rows_builder.AppendValues(groups.first_rows));
+  std::shared_ptr<arrow::Array> first_rows;
+  THROW_IF_ARROW_NOT_OK(first_rows_builder.Finish(&first_rows));
+  const auto& out_key_pbs = ctx->GetOutput(kOutKey);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    arrow::Datum taken;
+    ASSIGN_OR_THROW_ARROW_STATUS(
+        taken,
+        arrow::compute::Take(keys[i]->ToArrowChunkedArray(), first_rows));
+    ctx->GetTensorTable()->AddTensor(
+        out_key_pbs[i].name(),
+        std::make_shared<Tensor>(taken.chunked_array()));
+  }
+}
+
+}  // namespace scql::engine::op
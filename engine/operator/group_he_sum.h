@@ -0,0 +1,59 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "engine/framework/operator.h"
+
+namespace scql::engine::op {
+
+/// @brief GroupHeSum sums private values of one party grouped by private keys
+/// of another party, without secret sharing or oblivious sort.
+///
+/// The value party encrypts its values with HEU's paillier and sends
+/// ciphertexts to the key party, who groups its keys in plaintext and adds
+/// ciphertexts of each group. Sums are masked with random plaintexts before
+/// the value party decrypts them, and only the key party learns the unmasked
+/// sums and the number of rows of every group.
+///
+/// Nulls in values are summed as 0, so a group whose values are all null sums
+/// to 0 rather than null, like SUM over secret shares. Float values must fit
+/// in int64 after scaling by 2^kFxpBits, or the value party fails.
+class GroupHeSum : public Operator {
+ public:
+  static const std::string kOpType;
+
+  static constexpr char kKey[] = "Key";
+  static constexpr char kIn[] = "In";
+  static constexpr char kOut[] = "Out";
+  static constexpr char kOutKey[] = "OutKey";
+  static constexpr char kOutCount[] = "OutCount";
+  // [key party, value party]
+  static constexpr char kInputPartyCodesAttr[] = "input_party_codes";
+
+  // float values are summed in fixed point with kFxpBits fraction bits
+  static constexpr int kFxpBits = 20;
+
+  const std::string& Type() const override;
+
+ protected:
+  void Validate(ExecContext* ctx) override;
+  void Execute(ExecContext* ctx) override;
+
+ private:
+  void ExecuteAsKeyParty(ExecContext* ctx, size_t value_rank);
+  void ExecuteAsValueParty(ExecContext* ctx, size_t key_rank);
+};
+
+}  // namespace scql::engine::op
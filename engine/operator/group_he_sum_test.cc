@@ -0,0 +1,253 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "engine/operator/group_he_sum.h"
+
+#include "gflags/gflags.h"
+#include "gtest/gtest.h"
+
+#include "engine/core/tensor_from_json.h"
+#include "engine/operator/test_util.h"
+
+namespace scql::engine::op {
+
+DECLARE_int32(group_he_sum_key_bits);
+DECLARE_int64(group_he_sum_batch_rows);
+
+struct GroupHeSumTestCase {
+  // keys of alice
+  std::vector<test::NamedTensor> keys;
+  // values of bob
+  std::vector<test::NamedTensor> values;
+  std::vector<test::NamedTensor> expect_outs;
+  std::vector<test::NamedTensor> expect_out_keys;
+  test::NamedTensor expect_out_count;
+};
+
+class GroupHeSumTest : public ::testing::TestWithParam<
+                           std::tuple<spu::ProtocolKind, GroupHeSumTestCase>> {
+ public:
+  static pb::ExecNode MakeExecNode(const GroupHeSumTestCase& tc);
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    GroupHeSumPrivateTest, GroupHeSumTest,
+    testing::Combine(
+        testing::Values(spu::ProtocolKind::SEMI2K),
+        testing::Values(
+            GroupHeSumTestCase{
+                .keys = {test::NamedTensor(
+                    "k", TensorFromJSON(arrow::int64(),
+                                        "[3, 1, 3, 2, 1, 3]"))},
+                .values = {test::NamedTensor(
+                               "x", TensorFromJSON(arrow::int64(),
+                                                   "[1, -2, 3, 4, 5, null]")),
+                           test::NamedTensor(
+                               "y", TensorFromJSON(arrow::float64(),
+                                                   "[0.5, 1.25, -2, 3, 4, "
+                                                   "0.25]"))},
+                .expect_outs = {test::NamedTensor(
+                                    "x_sum", TensorFromJSON(arrow::int64(),
+                                                            "[4, 3, 4]")),
+                                test::NamedTensor(
+                                    "y_sum", TensorFromJSON(arrow::float64(),
+                                                            "[-1.25, 5.25, "
+                                                            "3]"))},
+                .expect_out_keys = {test::NamedTensor(
+                    "k_out", TensorFromJSON(arrow::int64(), "[3, 1, 2]"))},
+                .expect_out_count = test::NamedTensor(
+                    "count", TensorFromJSON(arrow::int64(), "[3, 2, 1]"))},
+            GroupHeSumTestCase{
+                .keys = {test::NamedTensor(
+                             "k1", TensorFromJSON(arrow::utf8(),
+                                                  R"json(["a", "b", null, "a",
+                                                  "b", null, "a"])json")),
+                         test::NamedTensor(
+                             "k2", TensorFromJSON(arrow::boolean(),
+                                                  "[true, true, false, false, "
+                                                  "true, false, true]"))},
+                .values = {test::NamedTensor(
+                    "x", TensorFromJSON(arrow::boolean(),
+                                        "[true, true, true, false, true, "
+                                        "false, true]"))},
+                .expect_outs = {test::NamedTensor(
+                    "x_sum", TensorFromJSON(arrow::int64(), "[2, 2, 1, 0]"))},
+                .expect_out_keys =
+                    {test::NamedTensor(
+                         "k1_out", TensorFromJSON(arrow::utf8(),
+                                                  R"json(["a", "b", null,
+                                                  "a"])json")),
+                     test::NamedTensor(
+                         "k2_out", TensorFromJSON(arrow::boolean(),
+                                                  "[true, true, false, "
+                                                  "false]"))},
+                .expect_out_count = test::NamedTensor(
+                    "count", TensorFromJSON(arrow::int64(), "[2, 2, 2, 1]"))},
+            // testcase: empty inputs
+            GroupHeSumTestCase{
+                .keys = {test::NamedTensor(
+                    "k", TensorFromJSON(arrow::int64(), "[]"))},
+                .values = {test::NamedTensor(
+                    "x", TensorFromJSON(arrow::float64(), "[]"))},
+                .expect_outs = {test::NamedTensor(
+                    "x_sum", TensorFromJSON(arrow::float64(), "[]"))},
+                .expect_out_keys = {test::NamedTensor(
+                    "k_out", TensorFromJSON(arrow::int64(), "[]"))},
+                .expect_out_count = test::NamedTensor(
+                    "count", TensorFromJSON(arrow::int64(), "[]"))})),
+    TestParamNameGenerator(GroupHeSumTest));
+
+TEST_P(GroupHeSumTest, works) {
+  // Given
+  gflags::FlagSaver saver;
+  // short keys and small batches keep tests fast and cover batching
+  FLAGS_group_he_sum_key_bits = 512;
+  FLAGS_group_he_sum_batch_rows = 2;
+  auto parm = GetParam();
+  auto tc = std::get<1>(parm);
+  auto node = MakeExecNode(tc);
+  std::vector<Session> sessions = test::Make2PCSession(std::get<0>(parm));
+
+  ExecContext alice_ctx(node, &sessions[0]);
+  ExecContext bob_ctx(node, &sessions[1]);
+  test::FeedInputsAsPrivate(&alice_ctx, tc.keys);
+  test::FeedInputsAsPrivate(&bob_ctx, tc.values);
+
+  // When
+  test::OperatorTestRunner<GroupHeSum> alice;
+  test::OperatorTestRunner<GroupHeSum> bob;
+
+  alice.Start(&alice_ctx);
+  bob.Start(&bob_ctx);
+
+  // Then
+  EXPECT_NO_THROW({ alice.Wait(); });
+  EXPECT_NO_THROW({ bob.Wait(); });
+
+  auto tensor_table = alice_ctx.GetTensorTable();
+  std::vector<test::NamedTensor> expect_out_count = {tc.expect_out_count};
+  for (const auto* expects :
+       {&tc.expect_outs, &tc.expect_out_keys, &expect_out_count}) {
+    for (const auto& expect : *expects) {
+      auto out = tensor_table->GetTensor(expect.name);
+      ASSERT_TRUE(out) << expect.name;
+      auto actual_arr = out->ToArrowChunkedArray();
+      auto expect_arr = expect.tensor->ToArrowChunkedArray();
+      EXPECT_TRUE(actual_arr->ApproxEquals(
+          *expect_arr, arrow::EqualOptions::Defaults().atol(0.001)))
+          << "\nexpect result = " << expect_arr->ToString()
+          << "\nbut actual got result = " << actual_arr->ToString();
+    }
+  }
+  // bob learns nothing
+  for (const auto& expect : tc.expect_outs) {
+    EXPECT_FALSE(bob_ctx.GetTensorTable()->GetTensor(expect.name));
+  }
+}
+
+TEST_P(GroupHeSumTest, row_count_mismatch) {
+  // Given
+  gflags::FlagSaver saver;
+  FLAGS_group_he_sum_key_bits = 512;
+  auto tc = std::get<1>(GetParam());
+  // drop the last key row, so keys are one row shorter than values
+  auto key = tc.keys[0].tensor->ToArrowChunkedArray();
+  if (key->length() == 0) {
+    return;
+  }
+  tc.keys = {test::NamedTensor(
+      tc.keys[0].name,
+      std::make_shared<Tensor>(key->Slice(0, key->length() - 1)))};
+  tc.expect_out_keys.erase(tc.expect_out_keys.begin() + 1,
+                           tc.expect_out_keys.end());
+  auto node = MakeExecNode(tc);
+  std::vector<Session> sessions =
+      test::Make2PCSession(std::get<0>(GetParam()));
+
+  ExecContext alice_ctx(node, &sessions[0]);
+  ExecContext bob_ctx(node, &sessions[1]);
+  test::FeedInputsAsPrivate(&alice_ctx, tc.keys);
+  test::FeedInputsAsPrivate(&bob_ctx, tc.values);
+
+  // When
+  test::OperatorTestRunner<GroupHeSum> alice;
+  test::OperatorTestRunner<GroupHeSum> bob;
+
+  alice.Start(&alice_ctx);
+  bob.Start(&bob_ctx);
+
+  // Then both parties fail before any ciphertext is sent
+  EXPECT_THROW({ alice.Wait(); }, yacl::EnforceNotMet);
+  EXPECT_THROW({ bob.Wait(); }, yacl::EnforceNotMet);
+}
+
+TEST(GroupHeSumValueTest, float_out_of_range) {
+  // Given
+  gflags::FlagSaver saver;
+  FLAGS_group_he_sum_key_bits = 512;
+  GroupHeSumTestCase tc{
+      .keys = {test::NamedTensor("k",
+                                 TensorFromJSON(arrow::int64(), "[1, 2]"))},
+      .values = {test::NamedTensor(
+          "x", TensorFromJSON(arrow::float64(), "[1, 1e13]"))},
+      .expect_outs = {test::NamedTensor(
+          "x_sum", TensorFromJSON(arrow::float64(), "[]"))},
+      .expect_out_keys = {test::NamedTensor(
+          "k_out", TensorFromJSON(arrow::int64(), "[]"))},
+      .expect_out_count = test::NamedTensor(
+          "count", TensorFromJSON(arrow::int64(), "[]"))};
+  auto node = GroupHeSumTest::MakeExecNode(tc);
+  std::vector<Session> sessions =
+      test::Make2PCSession(spu::ProtocolKind::SEMI2K);
+
+  ExecContext bob_ctx(node, &sessions[1]);
+  test::FeedInputsAsPrivate(&bob_ctx, tc.values);
+
+  // When
+  GroupHeSum op;
+
+  // Then the value party fails before sending anything
+  EXPECT_THROW(op.Run(&bob_ctx), yacl::EnforceNotMet);
+}
+
+/// ===========================
+/// GroupHeSumTest impl
+/// ===========================
+
+pb::ExecNode GroupHeSumTest::MakeExecNode(const GroupHeSumTestCase& tc) {
+  test::ExecNodeBuilder builder(GroupHeSum::kOpType);
+
+  builder.SetNodeName("group-he-sum-test");
+  builder.AddStringsAttr(
+      GroupHeSum::kInputPartyCodesAttr,
+      std::vector<std::string>{test::kPartyAlice, test::kPartyBob});
+
+  auto make_refs = [](const std::vector<test::NamedTensor>& ts) {
+    std::vector<pb::Tensor> refs;
+    for (const auto& named_tensor : ts) {
+      refs.push_back(test::MakePrivateTensorReference(
+          named_tensor.name, named_tensor.tensor->Type()));
+    }
+    return refs;
+  };
+  builder.AddInput(GroupHeSum::kKey, make_refs(tc.keys));
+  builder.AddInput(GroupHeSum::kIn, make_refs(tc.values));
+  builder.AddOutput(GroupHeSum::kOut, make_refs(tc.expect_outs));
+  builder.AddOutput(GroupHeSum::kOutKey, make_refs(tc.expect_out_keys));
+  builder.AddOutput(GroupHeSum::kOutCount, make_refs({tc.expect_out_count}));
+
+  return builder.Build();
+}
+
+}  // namespace scql::engine::op
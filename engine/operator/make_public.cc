@@ -56,8 +56,9 @@ void MakePublic::Execute(ExecContext* ctx) {
 
 void MakePublic::PrivateToPublic(ExecContext* ctx, const RepeatedTensor& inputs,
                                  const RepeatedTensor& outputs) {
-  spu::device::ColocatedIo cio(ctx->GetSession()->GetSpuHalContext());
-  util::SpuInfeedHelper infeed_helper(&cio);
+  auto* hctx = ctx->GetSession()->GetSpuHalContext();
+  spu::device::ColocatedIo cio(hctx);
+  util::SpuInfeedHelper infeed_helper(hctx, &cio);
 
   for (int i = 0; i < inputs.size(); ++i) {
     const auto& in_name = inputs[i].name();
@@ -41,8 +41,9 @@ void MakeShare::Validate(ExecContext* ctx) {
 }
 
 void MakeShare::Execute(ExecContext* ctx) {
-  spu::device::ColocatedIo cio(ctx->GetSession()->GetSpuHalContext());
-  util::SpuInfeedHelper infeed_helper(&cio);
+  auto* hctx = ctx->GetSession()->GetSpuHalContext();
+  spu::device::ColocatedIo cio(hctx);
+  util::SpuInfeedHelper infeed_helper(hctx, &cio);
 
   const auto& input_pbs = ctx->GetInput(kIn);
   const auto& output_pbs = ctx->GetOutput(kOut);
@@ -58,7 +59,8 @@ void MakeShare::Execute(ExecContext* ctx) {
     // NOTE: if tensor' type is string, we should convert it to
     // integer first, currently use hash value of string.
     if (in_t->Type() == pb::PrimitiveDataType::STRING) {
-      in_t = ctx->GetSession()->StringToHash(*in_t);
+      in_t = ctx->GetSession()->StringToHash(
+          *in_t, ctx->GetSession()->IsInStringRevealScope(output_pb.name()));
     }
     infeed_helper.InfeedTensorAsSecret(output_pb.name(), *in_t);
   }
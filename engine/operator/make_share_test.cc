@@ -20,6 +20,7 @@
 #include "engine/core/tensor_from_json.h"
 #include "engine/core/type.h"
 #include "engine/operator/test_util.h"
+#include "engine/util/dictionary_util.h"
 #include "engine/util/ndarray_to_arrow.h"
 #include "engine/util/spu_io.h"
 
@@ -76,6 +77,20 @@ INSTANTIATE_TEST_SUITE_P(
                                              "[false, false, false, true]"))},
                 .owners = {0, 1},
                 .output_names = {"x_hat", "y_hat"}},
+            // multi-chunk tensors
+            MakeShareTestCase{
+                .inputs =
+                    {test::NamedTensor(
+                         "x", TensorFromJSON(arrow::int64(),
+                                             std::vector<std::string>{
+                                                 "[1,2,3]", "[]", "[4,5]"})),
+                     test::NamedTensor(
+                         "y", TensorFromJSON(arrow::boolean(),
+                                             std::vector<std::string>{
+                                                 "[true, false]",
+                                                 "[false, true, true]"}))},
+                .owners = {0, 1},
+                .output_names = {"x_hat", "y_hat"}},
             MakeShareTestCase{
                 .inputs = {test::NamedTensor("x", TensorFromJSON(arrow::int64(),
                                                                  "[]")),
@@ -131,6 +146,57 @@ TEST_P(MakeShareTest, works) {
   }
 }
 
+TEST(MakeShareStringDictionaryTest, HashToStringFailsAfterRelease) {
+  // Given
+  std::vector<Session> sessions =
+      test::Make2PCSession(spu::ProtocolKind::SEMI2K);
+  auto* session = &sessions[0];
+  auto strs = TensorFromJSON(arrow::utf8(), R"json(["A", "B", "C"])json");
+  auto others = TensorFromJSON(arrow::utf8(), R"json(["X"])json");
+  session->SetStringRevealScope({"x_hat"});
+  auto hashes = session->StringToHash(*strs);
+  auto other_hashes = session->StringToHash(*others, false);
+
+  // When
+  TensorPtr revealed;
+  EXPECT_NO_THROW({ revealed = session->HashToString(*hashes); });
+
+  // Then
+  EXPECT_TRUE(revealed->ToArrowChunkedArray()->Equals(
+      *strs->ToArrowChunkedArray()));
+  // hash out of the reveal scope is not recorded
+  EXPECT_THROW(session->HashToString(*other_hashes, true), yacl::Exception);
+  TensorPtr placeholders;
+  EXPECT_NO_THROW({ placeholders = session->HashToString(*other_hashes); });
+  EXPECT_EQ(placeholders->Length(), 1);
+
+  session->ReleaseStringDictionary();
+  EXPECT_THROW(session->HashToString(*hashes), yacl::Exception);
+}
+
+TEST(MakeShareStringDictionaryTest, RevealNullString) {
+  // Given
+  std::vector<Session> sessions =
+      test::Make2PCSession(spu::ProtocolKind::SEMI2K);
+  auto plain = TensorFromJSON(arrow::utf8(), R"json(["A", null, "B"])json");
+  // reveal through plain path in alice and dictionary path in bob
+  std::vector<TensorPtr> inputs = {plain, util::DictionaryEncode(plain)};
+  auto expected = TensorFromJSON(arrow::utf8(), R"json(["A", "", "B"])json");
+
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    // When
+    auto hashes = sessions[i].StringToHash(*inputs[i]);
+    TensorPtr revealed;
+    EXPECT_NO_THROW({ revealed = sessions[i].HashToString(*hashes); });
+
+    // Then
+    ASSERT_NE(revealed, nullptr);
+    EXPECT_TRUE(revealed->ToArrowChunkedArray()->Equals(
+        *expected->ToArrowChunkedArray()))
+        << "actual output = " << revealed->ToArrowChunkedArray()->ToString();
+  }
+}
+
 /// ===================
 /// MakeShareTest impl
 /// ===================
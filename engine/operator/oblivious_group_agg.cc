@@ -14,8 +14,10 @@
 
 #include "engine/operator/oblivious_group_agg.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -98,45 +100,160 @@ spu::Value TransferGroupMask(spu::HalContext* ctx, const spu::Value& in) {
       0);
 }
 
-using ScanFn = std::function<std::pair<spu::Value, spu::Value>(
-    const spu::Value&, const spu::Value&, const spu::Value&,
-    const spu::Value&)>;
+enum class ScanKind { kSum, kMax, kMin };
+
+struct ScanColumn {
+  spu::Value value;
+  ScanKind kind;
+};
+
+// new value of lhs after merging rhs, if lhs and rhs are in the same group.
+spu::Value Combine(spu::HalContext* ctx, ScanKind kind, const spu::Value& lhs_v,
+                   const spu::Value& lhs_gm, const spu::Value& rhs_v) {
+  switch (kind) {
+    case ScanKind::kSum:
+      return spu::kernel::hlo::Add(ctx, lhs_v,
+                                   spu::kernel::hlo::Mul(ctx, lhs_gm, rhs_v));
+    case ScanKind::kMax:
+      return spu::kernel::hlo::Select(
+          ctx, lhs_gm, spu::kernel::hlo::Max(ctx, lhs_v, rhs_v), lhs_v);
+    case ScanKind::kMin:
+      return spu::kernel::hlo::Select(
+          ctx, lhs_gm, spu::kernel::hlo::Min(ctx, lhs_v, rhs_v), lhs_v);
+  }
+  YACL_THROW("unknown scan kind: {}", static_cast<int>(kind));
+}
+
+// indices of the same rows in every column of a stack of @param[in] columns
+// columns, each has @param[in] row_cnt rows.
+std::vector<int64_t> StackIndices(const std::vector<int64_t>& indices,
+                                  int64_t row_cnt, int64_t columns) {
+  std::vector<int64_t> ret;
+  ret.reserve(indices.size() * columns);
+  for (int64_t c = 0; c < columns; ++c) {
+    for (auto idx : indices) {
+      ret.push_back(c * row_cnt + idx);
+    }
+  }
+  return ret;
+}
 
 // Referrence: "Scape: Scalable Collaborative Analytics System on Private
 // Database with Malicious Security", Fig. 13
 //
-spu::Value Scan(spu::HalContext* ctx, const spu::Value& origin_value,
-                const spu::Value& origin_group_mask, const ScanFn& scan_fn) {
-  const int64_t row_cnt = origin_value.shape()[0];
+// All columns are scanned together: the group mask is propagated only once
+// per level, and columns of the same kind and dtype are stacked into one
+// value, so that each level issues one combiner call for all of them.
+std::vector<spu::Value> Scan(spu::HalContext* ctx,
+                             const std::vector<ScanColumn>& columns,
+                             const spu::Value& origin_group_mask) {
+  const int64_t row_cnt = RowCount(columns[0].value);
   spu::Value group_mask = TransferGroupMask(ctx, origin_group_mask);
-  spu::Value value = origin_value.clone();
+
+  struct Lane {
+    ScanKind kind;
+    std::vector<size_t> columns;
+    spu::Value stacked;
+  };
+  std::vector<Lane> lanes;
+  for (size_t i = 0; i < columns.size(); ++i) {
+    YACL_ENFORCE_EQ(RowCount(columns[i].value), row_cnt);
+    auto iter = std::find_if(lanes.begin(), lanes.end(), [&](const Lane& l) {
+      const auto& first = columns[l.columns[0]].value;
+      return l.kind == columns[i].kind &&
+             first.dtype() == columns[i].value.dtype() &&
+             first.vtype() == columns[i].value.vtype();
+    });
+    if (iter == lanes.end()) {
+      lanes.push_back(Lane{columns[i].kind, {i}, spu::Value()});
+    } else {
+      iter->columns.push_back(i);
+    }
+  }
+  for (auto& lane : lanes) {
+    std::vector<spu::Value> flat;
+    for (auto i : lane.columns) {
+      flat.push_back(
+          spu::kernel::hlo::Reshape(ctx, columns[i].value, {row_cnt}));
+    }
+    lane.stacked = flat.size() == 1
+                       ? flat[0].clone()
+                       : spu::kernel::hlo::Concatenate(ctx, flat, 0);
+  }
+
   const std::vector<IndexTuple> indices = GenScanIndex(row_cnt);
   for (const auto& index_tuple : indices) {
-    spu::Value lhs_v(value.data().linear_gather(index_tuple.first),
-                     value.dtype());
     spu::Value lhs_gm(group_mask.data().linear_gather(index_tuple.first),
                       group_mask.dtype());
-
-    spu::Value rhs_v(value.data().linear_gather(index_tuple.second),
-                     value.dtype());
     spu::Value rhs_gm(group_mask.data().linear_gather(index_tuple.second),
                       group_mask.dtype());
 
-    const auto [new_v, new_gm] = scan_fn(lhs_v, lhs_gm, rhs_v, rhs_gm);
-
-    YACL_ENFORCE_EQ(value.dtype(), new_v.dtype());
-    YACL_ENFORCE_EQ(value.vtype(), new_v.vtype());
+    for (auto& lane : lanes) {
+      const int64_t num_columns = lane.columns.size();
+      auto lhs_idx = StackIndices(index_tuple.first, row_cnt, num_columns);
+      auto rhs_idx = StackIndices(index_tuple.second, row_cnt, num_columns);
+      spu::Value lhs_v(lane.stacked.data().linear_gather(lhs_idx),
+                       lane.stacked.dtype());
+      spu::Value rhs_v(lane.stacked.data().linear_gather(rhs_idx),
+                       lane.stacked.dtype());
+      // the mask is shared by all columns, tiling it is local.
+      spu::Value lane_gm =
+          num_columns == 1
+              ? lhs_gm
+              : spu::kernel::hlo::Concatenate(
+                    ctx, std::vector<spu::Value>(num_columns, lhs_gm), 0);
+
+      auto new_v = Combine(ctx, lane.kind, lhs_v, lane_gm, rhs_v);
+      YACL_ENFORCE_EQ(lane.stacked.dtype(), new_v.dtype());
+      YACL_ENFORCE_EQ(lane.stacked.vtype(), new_v.vtype());
+      lane.stacked.data().linear_scatter(new_v.data(), lhs_idx);
+    }
 
+    spu::Value new_gm = spu::kernel::hlo::Mul(ctx, lhs_gm, rhs_gm);
     YACL_ENFORCE_EQ(group_mask.dtype(), new_gm.dtype());
     YACL_ENFORCE_EQ(group_mask.vtype(), new_gm.vtype());
-
-    value.data().linear_scatter(new_v.data(), index_tuple.first);
     group_mask.data().linear_scatter(new_gm.data(), index_tuple.first);
   }
 
+  std::vector<spu::Value> results(columns.size());
+  for (const auto& lane : lanes) {
+    for (size_t c = 0; c < lane.columns.size(); ++c) {
+      const int64_t begin = static_cast<int64_t>(c) * row_cnt;
+      auto column = lane.columns.size() == 1
+                        ? lane.stacked
+                        : spu::kernel::hlo::Slice(ctx, lane.stacked, {begin},
+                                                  {begin + row_cnt}, {});
+      auto i = lane.columns[c];
+      results[i] =
+          spu::kernel::hlo::Reshape(ctx, column, columns[i].value.shape());
+    }
+  }
+  return results;
+}
+
+// NOTE: hack for boolean value, which is summed as int64.
+spu::Value ToSummable(spu::HalContext* ctx, const spu::Value& value) {
+  if (value.dtype() == spu::DT_I1) {
+    return spu::kernel::hlo::Cast(ctx, value, value.vtype(), spu::DT_I64);
+  }
   return value;
 }
 
+spu::Value SecretOnes(spu::HalContext* ctx, const spu::Value& value) {
+  return spu::kernel::hlo::Seal(
+      ctx, spu::kernel::hlo::Constant(ctx, int64_t(1), value.shape()));
+}
+
+spu::Value Average(spu::HalContext* ctx, const spu::Value& sum,
+                   const spu::Value& count) {
+  if (sum.isInt()) {
+    const auto sum_f =
+        spu::kernel::hlo::Cast(ctx, sum, sum.vtype(), spu::DT_FXP);
+    return spu::kernel::hlo::Div(ctx, sum_f, count);
+  }
+  return spu::kernel::hlo::Div(ctx, sum, count);
+}
+
 }  // namespace
 
 void ObliviousGroupAggBase::Validate(ExecContext* ctx) {
@@ -168,19 +285,28 @@ void ObliviousGroupAggBase::Execute(ExecContext* ctx) {
   auto group_value =
       symbols->getVar(util::SpuVarNameEncoder::GetValueName(group.name()));
 
-  for (int i = 0; i < input_pbs.size(); ++i) {
-    auto value = symbols->getVar(
-        util::SpuVarNameEncoder::GetValueName(input_pbs[i].name()));
+  std::vector<spu::Value> values;
+  for (const auto& input_pb : input_pbs) {
+    values.push_back(symbols->getVar(
+        util::SpuVarNameEncoder::GetValueName(input_pb.name())));
+  }
 
-    spu::Value result;
-    if (RowCount(value) == 0) {
-      result = HandleEmptyInput(value);
-    } else {
-      result = CalculateResult(hctx, value, group_value);
+  std::vector<spu::Value> results;
+  if (RowCount(values[0]) == 0) {
+    for (const auto& value : values) {
+      results.push_back(HandleEmptyInput(value));
     }
+  } else {
+    for (const auto& value : values) {
+      YACL_ENFORCE(RowCount(value) == RowCount(group_value));
+    }
+    // all columns go through one scan instead of one scan per column.
+    results = CalculateResults(hctx, values, group_value);
+  }
 
+  for (int i = 0; i < output_pbs.size(); ++i) {
     symbols->setVar(util::SpuVarNameEncoder::GetValueName(output_pbs[i].name()),
-                    result);
+                    results[i]);
   }
 }
 
@@ -192,30 +318,14 @@ const std::string ObliviousGroupSum::kOpType("ObliviousGroupSum");
 
 const std::string& ObliviousGroupSum::Type() const { return kOpType; }
 
-spu::Value ObliviousGroupSum::CalculateResult(spu::HalContext* hctx,
-                                              const spu::Value& value,
-                                              const spu::Value& group) {
-  int64_t row_count = RowCount(value);
-  YACL_ENFORCE(row_count == RowCount(group));
-
-  spu::Value value_hat;
-
-  // NOTE: hack for boolean value.
-  if (value.dtype() == spu::DT_I1) {
-    value_hat = spu::kernel::hlo::Cast(hctx, value, value.vtype(), spu::DT_I64);
-  } else {
-    value_hat = value;
+std::vector<spu::Value> ObliviousGroupSum::CalculateResults(
+    spu::HalContext* hctx, const std::vector<spu::Value>& values,
+    const spu::Value& group) {
+  std::vector<ScanColumn> columns;
+  for (const auto& value : values) {
+    columns.push_back({ToSummable(hctx, value), ScanKind::kSum});
   }
-
-  return Scan(hctx, value_hat, group,
-              [&](const spu::Value& lhs_v, const spu::Value& lhs_gm,
-                  const spu::Value& rhs_v, const spu::Value& rhs_gm) {
-                spu::Value new_v = spu::kernel::hlo::Add(
-                    hctx, lhs_v, spu::kernel::hlo::Mul(hctx, lhs_gm, rhs_v));
-                spu::Value new_gm = spu::kernel::hlo::Mul(hctx, lhs_gm, rhs_gm);
-
-                return std::make_pair(new_v, new_gm);
-              });
+  return Scan(hctx, columns, group);
 }
 
 // ===========================
@@ -226,24 +336,17 @@ const std::string ObliviousGroupCount::kOpType("ObliviousGroupCount");
 
 const std::string& ObliviousGroupCount::Type() const { return kOpType; }
 
-spu::Value ObliviousGroupCount::CalculateResult(spu::HalContext* hctx,
-                                                const spu::Value& value,
-                                                const spu::Value& group) {
-  int64_t row_count = RowCount(value);
-  YACL_ENFORCE(row_count == RowCount(group));
-
-  spu::Value ones = spu::kernel::hlo::Seal(
-      hctx, spu::kernel::hlo::Constant(hctx, int64_t(1), value.shape()));
-
-  return Scan(hctx, ones, group,
-              [&](const spu::Value& lhs_v, const spu::Value& lhs_gm,
-                  const spu::Value& rhs_v, const spu::Value& rhs_gm) {
-                spu::Value new_v = spu::kernel::hlo::Add(
-                    hctx, lhs_v, spu::kernel::hlo::Mul(hctx, lhs_gm, rhs_v));
-                spu::Value new_gm = spu::kernel::hlo::Mul(hctx, lhs_gm, rhs_gm);
-
-                return std::make_pair(new_v, new_gm);
-              });
+std::vector<spu::Value> ObliviousGroupCount::CalculateResults(
+    spu::HalContext* hctx, const std::vector<spu::Value>& values,
+    const spu::Value& group) {
+  // counts only depend on group, so all columns share one result.
+  auto count =
+      Scan(hctx, {{SecretOnes(hctx, values[0]), ScanKind::kSum}}, group)[0];
+  std::vector<spu::Value> results;
+  for (const auto& value : values) {
+    results.push_back(spu::kernel::hlo::Reshape(hctx, count, value.shape()));
+  }
+  return results;
 }
 
 // ===========================
@@ -254,19 +357,22 @@ const std::string ObliviousGroupAvg::kOpType("ObliviousGroupAvg");
 
 const std::string& ObliviousGroupAvg::Type() const { return kOpType; }
 
-spu::Value ObliviousGroupAvg::CalculateResult(spu::HalContext* hctx,
-                                              const spu::Value& value,
-                                              const spu::Value& group) {
-  auto sum_result = ObliviousGroupSum().CalculateResult(hctx, value, group);
-  auto count_result = ObliviousGroupCount().CalculateResult(hctx, value, group);
+std::vector<spu::Value> ObliviousGroupAvg::CalculateResults(
+    spu::HalContext* hctx, const std::vector<spu::Value>& values,
+    const spu::Value& group) {
+  // sums and the count are scanned together, the count is the last column.
+  std::vector<ScanColumn> columns;
+  for (const auto& value : values) {
+    columns.push_back({ToSummable(hctx, value), ScanKind::kSum});
+  }
+  columns.push_back({SecretOnes(hctx, values[0]), ScanKind::kSum});
+  auto scanned = Scan(hctx, columns, group);
 
-  if (sum_result.isInt()) {
-    const auto sum_result_f = spu::kernel::hlo::Cast(
-        hctx, sum_result, sum_result.vtype(), spu::DT_FXP);
-    return spu::kernel::hlo::Div(hctx, sum_result_f, count_result);
-  } else {
-    return spu::kernel::hlo::Div(hctx, sum_result, count_result);
+  std::vector<spu::Value> results;
+  for (size_t i = 0; i < values.size(); ++i) {
+    results.push_back(Average(hctx, scanned[i], scanned.back()));
   }
+  return results;
 }
 
 // ===========================
@@ -277,22 +383,14 @@ const std::string ObliviousGroupMax::kOpType("ObliviousGroupMax");
 
 const std::string& ObliviousGroupMax::Type() const { return kOpType; }
 
-spu::Value ObliviousGroupMax::CalculateResult(spu::HalContext* hctx,
-                                              const spu::Value& value,
-                                              const spu::Value& group) {
-  int64_t row_count = RowCount(value);
-  YACL_ENFORCE(row_count == RowCount(group));
-
-  return Scan(hctx, value, group,
-              [&](const spu::Value& lhs_v, const spu::Value& lhs_gm,
-                  const spu::Value& rhs_v, const spu::Value& rhs_gm) {
-                spu::Value new_v = spu::kernel::hlo::Select(
-                    hctx, lhs_gm, spu::kernel::hlo::Max(hctx, lhs_v, rhs_v),
-                    lhs_v);
-                spu::Value new_gm = spu::kernel::hlo::Mul(hctx, lhs_gm, rhs_gm);
-
-                return std::make_pair(new_v, new_gm);
-              });
+std::vector<spu::Value> ObliviousGroupMax::CalculateResults(
+    spu::HalContext* hctx, const std::vector<spu::Value>& values,
+    const spu::Value& group) {
+  std::vector<ScanColumn> columns;
+  for (const auto& value : values) {
+    columns.push_back({value, ScanKind::kMax});
+  }
+  return Scan(hctx, columns, group);
 }
 
 // ===========================
@@ -303,22 +401,126 @@ const std::string ObliviousGroupMin::kOpType("ObliviousGroupMin");
 
 const std::string& ObliviousGroupMin::Type() const { return kOpType; }
 
-spu::Value ObliviousGroupMin::CalculateResult(spu::HalContext* hctx,
-                                              const spu::Value& value,
-                                              const spu::Value& group) {
-  int64_t row_count = RowCount(value);
-  YACL_ENFORCE(row_count == RowCount(group));
-
-  return Scan(hctx, value, group,
-              [&](const spu::Value& lhs_v, const spu::Value& lhs_gm,
-                  const spu::Value& rhs_v, const spu::Value& rhs_gm) {
-                spu::Value new_v = spu::kernel::hlo::Select(
-                    hctx, lhs_gm, spu::kernel::hlo::Min(hctx, lhs_v, rhs_v),
-                    lhs_v);
-                spu::Value new_gm = spu::kernel::hlo::Mul(hctx, lhs_gm, rhs_gm);
-
-                return std::make_pair(new_v, new_gm);
-              });
+std::vector<spu::Value> ObliviousGroupMin::CalculateResults(
+    spu::HalContext* hctx, const std::vector<spu::Value>& values,
+    const spu::Value& group) {
+  std::vector<ScanColumn> columns;
+  for (const auto& value : values) {
+    columns.push_back({value, ScanKind::kMin});
+  }
+  return Scan(hctx, columns, group);
+}
+
+// ===========================
+//   Fused impl
+// ===========================
+
+const std::string ObliviousGroupAgg::kOpType("ObliviousGroupAgg");
+
+const std::string& ObliviousGroupAgg::Type() const { return kOpType; }
+
+void ObliviousGroupAgg::Validate(ExecContext* ctx) {
+  const auto& group = ctx->GetInput(kGroup);
+  YACL_ENFORCE(group.size() == 1, "group size must be 1");
+  const auto& inputs = ctx->GetInput(kIn);
+  YACL_ENFORCE(inputs.size() > 0, "input size cannot be 0");
+  const auto& outputs = ctx->GetOutput(kOut);
+  YACL_ENFORCE(outputs.size() == inputs.size(),
+               "outputs' size={} not equal to inputs' size={}", outputs.size(),
+               inputs.size());
+
+  YACL_ENFORCE(util::IsTensorStatusMatched(group[0], pb::TENSORSTATUS_SECRET),
+               "group's status is not secret");
+  YACL_ENFORCE(util::AreTensorsStatusMatched(inputs, pb::TENSORSTATUS_SECRET),
+               "inputs' status are not all secret");
+  YACL_ENFORCE(util::AreTensorsStatusMatched(outputs, pb::TENSORSTATUS_SECRET),
+               "outputs' status are not all secret");
+
+  auto agg_funcs = ctx->GetStringValuesFromAttribute(kAggFuncsAttr);
+  YACL_ENFORCE(agg_funcs.size() == static_cast<size_t>(inputs.size()),
+               "agg_funcs' size={} not equal to inputs' size={}",
+               agg_funcs.size(), inputs.size());
+}
+
+void ObliviousGroupAgg::Execute(ExecContext* ctx) {
+  const auto& input_pbs = ctx->GetInput(kIn);
+  const auto& output_pbs = ctx->GetOutput(kOut);
+  auto agg_funcs = ctx->GetStringValuesFromAttribute(kAggFuncsAttr);
+
+  auto symbols = ctx->GetSession()->GetDeviceSymbols();
+  auto hctx = ctx->GetSession()->GetSpuHalContext();
+
+  const auto& group = ctx->GetInput(kGroup)[0];
+  auto group_value =
+      symbols->getVar(util::SpuVarNameEncoder::GetValueName(group.name()));
+
+  std::vector<spu::Value> values;
+  for (const auto& input_pb : input_pbs) {
+    values.push_back(symbols->getVar(
+        util::SpuVarNameEncoder::GetValueName(input_pb.name())));
+  }
+
+  std::vector<spu::Value> results(values.size());
+  if (RowCount(values[0]) == 0) {
+    for (size_t i = 0; i < values.size(); ++i) {
+      results[i] = EmptyResult(agg_funcs[i], values[i]);
+    }
+  } else {
+    YACL_ENFORCE(RowCount(values[0]) == RowCount(group_value));
+    // columns to be scanned, count is shared by all count and avg.
+    std::vector<ScanColumn> columns;
+    std::vector<size_t> slots(values.size());
+    std::optional<size_t> count_slot;
+    auto get_count_slot = [&](const spu::Value& value) {
+      if (!count_slot.has_value()) {
+        count_slot = columns.size();
+        columns.push_back({SecretOnes(hctx, value), ScanKind::kSum});
+      }
+      return *count_slot;
+    };
+    for (size_t i = 0; i < values.size(); ++i) {
+      const auto& func = agg_funcs[i];
+      if (func == kSum || func == kAvg) {
+        slots[i] = columns.size();
+        columns.push_back({ToSummable(hctx, values[i]), ScanKind::kSum});
+        if (func == kAvg) {
+          get_count_slot(values[i]);
+        }
+      } else if (func == kCount) {
+        slots[i] = get_count_slot(values[i]);
+      } else if (func == kMax || func == kMin) {
+        slots[i] = columns.size();
+        columns.push_back(
+            {values[i], func == kMax ? ScanKind::kMax : ScanKind::kMin});
+      } else {
+        YACL_THROW("unsupported aggregation function: {}", func);
+      }
+    }
+
+    auto scanned = Scan(hctx, columns, group_value);
+    for (size_t i = 0; i < values.size(); ++i) {
+      results[i] = agg_funcs[i] == kAvg
+                       ? Average(hctx, scanned[slots[i]], scanned[*count_slot])
+                       : scanned[slots[i]];
+    }
+  }
+
+  for (size_t i = 0; i < results.size(); ++i) {
+    symbols->setVar(util::SpuVarNameEncoder::GetValueName(output_pbs[i].name()),
+                    results[i]);
+  }
+}
+
+spu::Value ObliviousGroupAgg::EmptyResult(const std::string& agg_func,
+                                          const spu::Value& in) {
+  if (agg_func == kSum) {
+    return ObliviousGroupSum().HandleEmptyInput(in);
+  } else if (agg_func == kCount) {
+    return ObliviousGroupCount().HandleEmptyInput(in);
+  } else if (agg_func == kAvg) {
+    return ObliviousGroupAvg().HandleEmptyInput(in);
+  }
+  return in;
 }
 
 };  // namespace scql::engine::op
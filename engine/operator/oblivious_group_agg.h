@@ -27,9 +27,11 @@ class ObliviousGroupAggBase : public Operator {
  public:
   virtual spu::Value HandleEmptyInput(const spu::Value& in) { return in; }
 
-  virtual spu::Value CalculateResult(spu::HalContext* hctx,
-                                     const spu::Value& value,
-                                     const spu::Value& group_value) = 0;
+  /// @returns aggregated results of all @param[in] values, which are
+  /// scanned in one batch.
+  virtual std::vector<spu::Value> CalculateResults(
+      spu::HalContext* hctx, const std::vector<spu::Value>& values,
+      const spu::Value& group_value) = 0;
 
  protected:
   void Validate(ExecContext* ctx) override;
@@ -53,8 +55,9 @@ class ObliviousGroupSum : public ObliviousGroupAggBase {
     }
   }
 
-  spu::Value CalculateResult(spu::HalContext* hctx, const spu::Value& value,
-                             const spu::Value& group_value) override;
+  std::vector<spu::Value> CalculateResults(
+      spu::HalContext* hctx, const std::vector<spu::Value>& values,
+      const spu::Value& group_value) override;
 };
 
 class ObliviousGroupCount : public ObliviousGroupAggBase {
@@ -68,8 +71,9 @@ class ObliviousGroupCount : public ObliviousGroupAggBase {
     return in.clone().setDtype(spu::DT_I64, true);
   }
 
-  spu::Value CalculateResult(spu::HalContext* hctx, const spu::Value& value,
-                             const spu::Value& group_value) override;
+  std::vector<spu::Value> CalculateResults(
+      spu::HalContext* hctx, const std::vector<spu::Value>& values,
+      const spu::Value& group_value) override;
 };
 
 class ObliviousGroupAvg : public ObliviousGroupAggBase {
@@ -83,8 +87,9 @@ class ObliviousGroupAvg : public ObliviousGroupAggBase {
     return in.clone().setDtype(spu::DT_FXP, true);
   }
 
-  spu::Value CalculateResult(spu::HalContext* hctx, const spu::Value& value,
-                             const spu::Value& group_value) override;
+  std::vector<spu::Value> CalculateResults(
+      spu::HalContext* hctx, const std::vector<spu::Value>& values,
+      const spu::Value& group_value) override;
 };
 
 class ObliviousGroupMax : public ObliviousGroupAggBase {
@@ -94,8 +99,9 @@ class ObliviousGroupMax : public ObliviousGroupAggBase {
   const std::string& Type() const override;
 
  public:
-  spu::Value CalculateResult(spu::HalContext* hctx, const spu::Value& value,
-                             const spu::Value& group_value) override;
+  std::vector<spu::Value> CalculateResults(
+      spu::HalContext* hctx, const std::vector<spu::Value>& values,
+      const spu::Value& group_value) override;
 };
 
 class ObliviousGroupMin : public ObliviousGroupAggBase {
@@ -105,9 +111,38 @@ class ObliviousGroupMin : public ObliviousGroupAggBase {
   const std::string& Type() const override;
 
  public:
-  spu::Value CalculateResult(spu::HalContext* hctx, const spu::Value& value,
-                             const spu::Value& group_value) override;
+  std::vector<spu::Value> CalculateResults(
+      spu::HalContext* hctx, const std::vector<spu::Value>& values,
+      const spu::Value& group_value) override;
 };
 // TODO(jingshi) : Add ObliviousGroupMedian.
 
+/// @brief aggregates every input by its own function in attribute
+/// agg_funcs, all inputs share one scan, so the group mask is propagated
+/// once instead of once per aggregation.
+class ObliviousGroupAgg : public Operator {
+ public:
+  static const std::string kOpType;
+  static constexpr char kGroup[] = "Group";
+  static constexpr char kIn[] = "In";
+  static constexpr char kOut[] = "Out";
+  static constexpr char kAggFuncsAttr[] = "agg_funcs";
+
+  static constexpr char kSum[] = "sum";
+  static constexpr char kCount[] = "count";
+  static constexpr char kAvg[] = "avg";
+  static constexpr char kMax[] = "max";
+  static constexpr char kMin[] = "min";
+
+  const std::string& Type() const override;
+
+ protected:
+  void Validate(ExecContext* ctx) override;
+  void Execute(ExecContext* ctx) override;
+
+ private:
+  static spu::Value EmptyResult(const std::string& agg_func,
+                                const spu::Value& in);
+};
+
 }  // namespace scql::engine::op
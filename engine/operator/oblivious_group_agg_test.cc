@@ -27,6 +27,8 @@ struct ObliviousGroupAggTestCase {
   std::vector<test::NamedTensor> inputs;
   test::NamedTensor group;
   std::vector<test::NamedTensor> outputs;
+  // only used by ObliviousGroupAgg
+  std::vector<std::string> agg_funcs = {};
 };
 
 class ObliviousGroupAggTest
@@ -117,6 +119,10 @@ pb::ExecNode ObliviousGroupAggTest::MakeExecNode(
   }
   builder.AddOutput(ObliviousGroupAggBase::kOut, outputs);
 
+  if (!tc.agg_funcs.empty()) {
+    builder.AddStringsAttr(ObliviousGroupAgg::kAggFuncsAttr, tc.agg_funcs);
+  }
+
   return builder.Build();
 }
 
@@ -167,6 +173,38 @@ INSTANTIATE_TEST_SUITE_P(
                     "out",
                     TensorFromJSON(arrow::float32(),
                                    "[-3.14, 1.1, 11.1, 111.1, 31415.9]"))}},
+            ObliviousGroupAggTestCase{
+                .op_type = ObliviousGroupSum::kOpType,
+                .inputs = {test::NamedTensor("in_a",
+                                             TensorFromJSON(arrow::int64(),
+                                                            "[1, 2, 3, 4, 5]")),
+                           test::NamedTensor("in_b",
+                                             TensorFromJSON(arrow::int64(),
+                                                            "[5, 4, 3, 2, 1]")),
+                           test::NamedTensor(
+                               "in_c", TensorFromJSON(arrow::float32(),
+                                                      "[0.5, 1, 1.5, 2, 2.5]")),
+                           test::NamedTensor(
+                               "in_d",
+                               TensorFromJSON(arrow::boolean(),
+                                              "[true, true, false, true, "
+                                              "false]"))},
+                .group = test::NamedTensor("group",
+                                           TensorFromJSON(arrow::boolean(),
+                                                          "[1, 0, 0, 1, 1]")),
+                .outputs = {test::NamedTensor(
+                                "out_a", TensorFromJSON(arrow::int64(),
+                                                        "[1, 2, 5, 9, 5]")),
+                            test::NamedTensor(
+                                "out_b", TensorFromJSON(arrow::int64(),
+                                                        "[5, 4, 7, 9, 1]")),
+                            test::NamedTensor(
+                                "out_c", TensorFromJSON(arrow::float32(),
+                                                        "[0.5, 1, 2.5, 4.5, "
+                                                        "2.5]")),
+                            test::NamedTensor(
+                                "out_d", TensorFromJSON(arrow::int64(),
+                                                        "[1, 1, 1, 2, 0]"))}},
             ObliviousGroupAggTestCase{
                 .op_type = ObliviousGroupSum::kOpType,
                 .inputs = {test::NamedTensor(
@@ -246,6 +284,25 @@ INSTANTIATE_TEST_SUITE_P(
                     "out",
                     TensorFromJSON(arrow::float32(),
                                    "[-3.14, 1.3, 5.65, 37.1, 314.08]"))}},
+            ObliviousGroupAggTestCase{
+                .op_type = ObliviousGroupAvg::kOpType,
+                .inputs = {test::NamedTensor("in_a",
+                                             TensorFromJSON(arrow::int64(),
+                                                            "[1, 2, 3, 4, 5]")),
+                           test::NamedTensor(
+                               "in_b", TensorFromJSON(arrow::float32(),
+                                                      "[-3.14, 1.3, 10, 100, "
+                                                      "314.08]"))},
+                .group = test::NamedTensor("group",
+                                           TensorFromJSON(arrow::boolean(),
+                                                          "[1, 0, 0, 1, 1]")),
+                .outputs = {test::NamedTensor(
+                                "out_a", TensorFromJSON(arrow::float32(),
+                                                        "[1, 2, 2.5, 3, 5]")),
+                            test::NamedTensor(
+                                "out_b", TensorFromJSON(arrow::float32(),
+                                                        "[-3.14, 1.3, 5.65, "
+                                                        "37.1, 314.08]"))}},
             ObliviousGroupAggTestCase{
                 .op_type = ObliviousGroupAvg::kOpType,
                 .inputs = {test::NamedTensor(
@@ -342,4 +399,79 @@ INSTANTIATE_TEST_SUITE_P(
                     "out", TensorFromJSON(arrow::float32(), "[]"))}})),
     TestParamNameGenerator(ObliviousGroupAggTest));
 
+// =====================
+// TEST_SUITE: ObliviousGroupAgg
+// =====================
+
+INSTANTIATE_TEST_SUITE_P(
+    ObliviousGroupFusedAggTest, ObliviousGroupAggTest,
+    testing::Combine(
+        testing::Values(spu::ProtocolKind::CHEETAH, spu::ProtocolKind::SEMI2K),
+        testing::Values(
+            ObliviousGroupAggTestCase{
+                .op_type = ObliviousGroupAgg::kOpType,
+                .inputs =
+                    {test::NamedTensor("in_sum",
+                                       TensorFromJSON(arrow::int64(),
+                                                      "[1, 2, 3, 4, 5]")),
+                     test::NamedTensor("in_count",
+                                       TensorFromJSON(arrow::int64(),
+                                                      "[1, 2, 3, 4, 5]")),
+                     test::NamedTensor("in_avg",
+                                       TensorFromJSON(arrow::int64(),
+                                                      "[1, 2, 3, 4, 5]")),
+                     test::NamedTensor(
+                         "in_max", TensorFromJSON(
+                                       arrow::float32(),
+                                       "[-3.14, 1.3, 10, 100, 314.08]")),
+                     test::NamedTensor(
+                         "in_min", TensorFromJSON(
+                                       arrow::float32(),
+                                       "[-3.14, 1.3, 10, 100, 314.08]")),
+                     test::NamedTensor(
+                         "in_bool_sum",
+                         TensorFromJSON(arrow::boolean(),
+                                        "[true, false, true, true, false]"))},
+                .group = test::NamedTensor("group",
+                                           TensorFromJSON(arrow::boolean(),
+                                                          "[1, 0, 0, 1, 1]")),
+                .outputs =
+                    {test::NamedTensor("out_sum",
+                                       TensorFromJSON(arrow::int64(),
+                                                      "[1, 2, 5, 9, 5]")),
+                     test::NamedTensor("out_count",
+                                       TensorFromJSON(arrow::int64(),
+                                                      "[1, 1, 2, 3, 1]")),
+                     test::NamedTensor("out_avg",
+                                       TensorFromJSON(arrow::float32(),
+                                                      "[1, 2, 2.5, 3, 5]")),
+                     test::NamedTensor(
+                         "out_max", TensorFromJSON(
+                                        arrow::float32(),
+                                        "[-3.14, 1.3, 10, 100, 314.08]")),
+                     test::NamedTensor(
+                         "out_min", TensorFromJSON(
+                                        arrow::float32(),
+                                        "[-3.14, 1.3, 1.3, 1.3, 314.08]")),
+                     test::NamedTensor("out_bool_sum",
+                                       TensorFromJSON(arrow::int64(),
+                                                      "[1, 0, 1, 2, 0]"))},
+                .agg_funcs = {"sum", "count", "avg", "max", "min", "sum"}},
+            ObliviousGroupAggTestCase{
+                .op_type = ObliviousGroupAgg::kOpType,
+                .inputs = {test::NamedTensor(
+                               "in_a", TensorFromJSON(arrow::float32(), "[]")),
+                           test::NamedTensor(
+                               "in_b", TensorFromJSON(arrow::int64(), "[]"))},
+                .group = test::NamedTensor(
+                    "group", TensorFromJSON(arrow::boolean(), "[]")),
+                .outputs = {test::NamedTensor("out_a",
+                                              TensorFromJSON(arrow::float32(),
+                                                             "[]")),
+                            test::NamedTensor("out_b",
+                                              TensorFromJSON(arrow::int64(),
+                                                             "[]"))},
+                .agg_funcs = {"avg", "count"}})),
+    TestParamNameGenerator(ObliviousGroupAggTest));
+
 }  // namespace scql::engine::op
@@ -20,6 +20,7 @@
 #include "libspu/kernel/hlo/const.h"
 #include "libspu/kernel/hlo/geometrical.h"
 
+#include "engine/util/composite_key.h"
 #include "engine/util/spu_io.h"
 #include "engine/util/tensor_util.h"
 
@@ -72,33 +73,33 @@ spu::Value ObliviousGroupMark::GetFullGroupMark(ExecContext* ctx) {
   const auto& input_pbs = ctx->GetInput(kIn);
   auto symbols = ctx->GetSession()->GetDeviceSymbols();
   auto hctx = ctx->GetSession()->GetSpuHalContext();
-  auto first_value = symbols->getVar(
-      util::SpuVarNameEncoder::GetValueName(input_pbs[0].name()));
-  int64_t row_count = first_value.shape().size() > 0 ? first_value.shape()[0]
-                                                     : first_value.numel();
-  auto from_top =
-      spu::kernel::hal::slice(hctx, first_value, {0}, {row_count - 1}, {});
-  auto to_bottom =
-      spu::kernel::hal::slice(hctx, first_value, {1}, {row_count}, {});
-
-  auto result = spu::kernel::hlo::NotEqual(hctx, from_top, to_bottom);
-
-  for (int i = 1; i < input_pbs.size(); ++i) {
-    auto cur_value = symbols->getVar(
-        util::SpuVarNameEncoder::GetValueName(input_pbs[i].name()));
+  std::vector<spu::Value> keys;
+  for (const auto& input_pb : input_pbs) {
+    keys.push_back(symbols->getVar(
+        util::SpuVarNameEncoder::GetValueName(input_pb.name())));
+  }
+  int64_t row_count = keys[0].shape().size() > 0 ? keys[0].shape()[0]
+                                                 : keys[0].numel();
+  for (size_t i = 1; i < keys.size(); ++i) {
     int64_t cur_row_count =
-        cur_value.shape().size() > 0 ? cur_value.shape()[0] : cur_value.numel();
+        keys[i].shape().size() > 0 ? keys[i].shape()[0] : keys[i].numel();
     YACL_ENFORCE(cur_row_count == row_count,
-                 "intput tensor#{} row count not equal to the previous");
+                 "intput tensor#{} row count not equal to the previous", i);
+  }
+  // adjacent keys packed into one composite key need only one NotEqual.
+  keys = util::PackKeys(hctx, keys, GetKeyBits(ctx));
 
+  spu::Value result;
+  for (size_t i = 0; i < keys.size(); ++i) {
     auto from_top =
-        spu::kernel::hal::slice(hctx, cur_value, {0}, {row_count - 1}, {});
+        spu::kernel::hal::slice(hctx, keys[i], {0}, {row_count - 1}, {});
     auto to_bottom =
-        spu::kernel::hal::slice(hctx, cur_value, {1}, {row_count}, {});
+        spu::kernel::hal::slice(hctx, keys[i], {1}, {row_count}, {});
 
     auto cur_result = spu::kernel::hlo::NotEqual(hctx, from_top, to_bottom);
 
-    result = spu::kernel::hlo::Or(hctx, result, cur_result);
+    result =
+        i == 0 ? cur_result : spu::kernel::hlo::Or(hctx, result, cur_result);
   }
 
   auto tail =
@@ -108,4 +109,13 @@ spu::Value ObliviousGroupMark::GetFullGroupMark(ExecContext* ctx) {
   return full_result;
 }
 
+std::vector<int64_t> ObliviousGroupMark::GetKeyBits(ExecContext* ctx) {
+  try {
+    return ctx->GetInt64ValuesFromAttribute(kKeyBitsAttr);
+  } catch (const ::yacl::EnforceNotMet&) {
+    // attribute key_bits is optional, keys are compared one by one.
+    return {};
+  }
+}
+
 };  // namespace scql::engine::op
\ No newline at end of file
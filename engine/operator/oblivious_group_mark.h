@@ -24,6 +24,8 @@ class ObliviousGroupMark : public Operator {
 
   static constexpr char kIn[] = "Key";
   static constexpr char kOut[] = "Group";
+  // optional, bits of each key, used to pack keys into one
+  static constexpr char kKeyBitsAttr[] = "key_bits";
 
   const std::string& Type() const override;
 
@@ -33,6 +35,7 @@ class ObliviousGroupMark : public Operator {
 
  private:
   spu::Value GetFullGroupMark(ExecContext* ctx);
+  static std::vector<int64_t> GetKeyBits(ExecContext* ctx);
 };
 
 }  // namespace scql::engine::op
\ No newline at end of file
@@ -24,6 +24,7 @@ namespace scql::engine::op {
 struct ObliviousGroupMarkTestCase {
   std::vector<test::NamedTensor> inputs;
   test::NamedTensor output;
+  std::vector<int64_t> key_bits = {};
 };
 
 class ObliviousGroupMarkTest
@@ -55,6 +56,18 @@ INSTANTIATE_TEST_SUITE_P(
                 .output = test::NamedTensor(
                     "out",
                     TensorFromJSON(arrow::boolean(), "[1, 1, 1, 0, 0, 1]"))},
+            // testcase: keys packed into one composite key
+            ObliviousGroupMarkTestCase{
+                .inputs = {test::NamedTensor(
+                               "in_a", TensorFromJSON(arrow::int64(),
+                                                      "[0, 0, 1, 1, 1, 1]")),
+                           test::NamedTensor(
+                               "in_b", TensorFromJSON(arrow::int64(),
+                                                      "[0, 1, 1, 2, 2, 2]"))},
+                .output = test::NamedTensor(
+                    "out",
+                    TensorFromJSON(arrow::boolean(), "[1, 1, 1, 0, 0, 1]")),
+                .key_bits = {1, 2}},
             ObliviousGroupMarkTestCase{
                 .inputs = {test::NamedTensor(
                     "in", TensorFromJSON(arrow::int64(), "[1]"))},
@@ -125,6 +138,9 @@ pb::ExecNode ObliviousGroupMarkTest::MakeExecNode(
   pb::Tensor output =
       test::MakeSecretTensorReference(tc.output.name, tc.output.tensor->Type());
   builder.AddOutput(ObliviousGroupMark::kOut, {output});
+  if (!tc.key_bits.empty()) {
+    builder.AddInt64sAttr(ObliviousGroupMark::kKeyBitsAttr, tc.key_bits);
+  }
 
   return builder.Build();
 }
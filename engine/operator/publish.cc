@@ -49,6 +49,11 @@ void Publish::Execute(ExecContext* ctx) {
     auto from_tensor = GetPrivateOrPublicTensor(ctx, input_pb);
     YACL_ENFORCE(from_tensor, "get private or public tensor failed");
 
+    if (ctx->GetSession()->KeepsPublishTensors()) {
+      ctx->GetSession()->AddPublishTensor(output_name, from_tensor);
+      continue;
+    }
+
     auto proto_result = std::make_shared<pb::Tensor>();
     SetProtoMeta(from_tensor, output_name, proto_result);
 
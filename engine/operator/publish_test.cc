@@ -14,6 +14,9 @@
 
 #include "engine/operator/publish.h"
 
+#include "arrow/io/memory.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/table.h"
 #include "gtest/gtest.h"
 
 #include "engine/core/tensor_from_json.h"
@@ -30,7 +33,7 @@ struct PublishTestCase {
 
 class PublishTest : public ::testing::TestWithParam<
                         std::tuple<spu::ProtocolKind, PublishTestCase>> {
- protected:
+ public:
   static pb::ExecNode MakePublishExecNode(const PublishTestCase& tc);
 
   static void FeedInputs(const std::vector<ExecContext*>& ctxs,
@@ -148,6 +151,72 @@ TEST_P(PublishTest, Works) {
   }
 }
 
+TEST_P(PublishTest, WorksInArrowIpc) {
+  // Give
+  auto parm = GetParam();
+  auto tc = std::get<1>(parm);
+  pb::ExecNode node = MakePublishExecNode(tc);
+  std::vector<Session> sessions = test::Make2PCSession(std::get<0>(parm));
+  sessions[0].SetArrowIpcResult(true);
+
+  ExecContext alice_ctx(node, &sessions[0]);
+  ExecContext bob_ctx(node, &sessions[1]);
+
+  FeedInputs({&alice_ctx, &bob_ctx}, tc);
+
+  // When
+  Publish op;
+  ASSERT_NO_THROW({ op.Run(&alice_ctx); });
+  // Then
+  EXPECT_TRUE(sessions[0].GetPublishResults().empty());
+  auto buf =
+      arrow::Buffer::FromString(sessions[0].GetPublishResultsInArrowIpc());
+  auto reader = arrow::ipc::RecordBatchStreamReader::Open(
+      std::make_shared<arrow::io::BufferReader>(buf));
+  ASSERT_TRUE(reader.ok());
+  auto table = (*reader)->ToTable();
+  ASSERT_TRUE(table.ok());
+  ASSERT_EQ(tc.out_names.size(), (*table)->num_columns());
+  for (size_t i = 0; i < tc.out_names.size(); ++i) {
+    EXPECT_EQ(tc.out_names[i], (*table)->field(i)->name());
+    EXPECT_EQ(tc.inputs[i].tensor->Length(), (*table)->column(i)->length());
+  }
+}
+
+TEST(PublishJointStringTest, FillsPlaceholderForOthersStrings) {
+  // Given public strings hashed by alice only, as in joint publish
+  PublishTestCase tc{
+      .inputs = {test::NamedTensor(
+          "joint", TensorFromJSON(arrow::utf8(), R"json(["A","B"])json"))},
+      .in_status = {pb::TENSORSTATUS_PUBLIC},
+      .out_names = {"joint_out"}};
+  pb::ExecNode node = PublishTest::MakePublishExecNode(tc);
+  std::vector<Session> sessions =
+      test::Make2PCSession(spu::ProtocolKind::SEMI2K);
+  ExecContext alice_ctx(node, &sessions[0]);
+  ExecContext bob_ctx(node, &sessions[1]);
+  for (auto& session : sessions) {
+    session.SetStringRevealScope({"joint"});
+  }
+  PublishTest::FeedInputs({&alice_ctx, &bob_ctx}, tc);
+
+  // When
+  Publish op;
+  ASSERT_NO_THROW({ op.Run(&alice_ctx); });
+  ASSERT_NO_THROW({ op.Run(&bob_ctx); });
+
+  // Then alice publishes her strings and bob fills placeholders, which SCDB
+  // merges into one column.
+  auto alice_result = sessions[0].GetPublishResults();
+  auto bob_result = sessions[1].GetPublishResults();
+  ASSERT_EQ(alice_result.size(), 1);
+  ASSERT_EQ(bob_result.size(), 1);
+  EXPECT_EQ(alice_result[0]->ss().ss(0), "A");
+  EXPECT_EQ(alice_result[0]->ss().ss(1), "B");
+  EXPECT_EQ(bob_result[0]->ss().ss(0), "__null__");
+  EXPECT_EQ(bob_result[0]->ss().ss(1), "__null__");
+}
+
 /// ===========================
 /// PublishTest impl
 /// ===========================
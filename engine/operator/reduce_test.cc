@@ -28,6 +28,8 @@ struct ReduceTestCase {
   pb::TensorStatus status;
   test::NamedTensor input;
   test::NamedTensor output;
+  // tolerance of result, 0 means exact.
+  double atol = 0.001;
 };
 
 class ReduceTest : public ::testing::TestWithParam<
@@ -190,6 +192,45 @@ INSTANTIATE_TEST_SUITE_P(
                                         "[1.75, 2.34, 4.12, 1.99]")),
                 .output = test::NamedTensor(
                     "y", TensorFromJSON(arrow::float32(), "[1.75]"))},
+            // testcase: sum of shares is exact for odd and even lengths
+            ReduceTestCase{
+                .op_type = ReduceSum::kOpType,
+                .status = pb::TENSORSTATUS_SECRET,
+                .input = test::NamedTensor(
+                    "x", TensorFromJSON(arrow::float32(),
+                                        "[0.5, 1.25, -2.75, 8, 0.125, -0.25, "
+                                        "3.375]")),
+                .output = test::NamedTensor(
+                    "y", TensorFromJSON(arrow::float32(), "[10.25]")),
+                .atol = 0},
+            ReduceTestCase{
+                .op_type = ReduceSum::kOpType,
+                .status = pb::TENSORSTATUS_SECRET,
+                .input = test::NamedTensor(
+                    "x", TensorFromJSON(arrow::boolean(),
+                                        "[true, false, true, true, false, "
+                                        "true, true]")),
+                .output = test::NamedTensor(
+                    "y", TensorFromJSON(arrow::int64(), "[5]")),
+                .atol = 0},
+            ReduceTestCase{
+                .op_type = ReduceAvg::kOpType,
+                .status = pb::TENSORSTATUS_SECRET,
+                .input = test::NamedTensor(
+                    "x", TensorFromJSON(arrow::float32(),
+                                        "[0.5, 1.25, -2.75, 8]")),
+                .output = test::NamedTensor(
+                    "y", TensorFromJSON(arrow::float32(), "[1.75]")),
+                .atol = 1e-4},
+            ReduceTestCase{
+                .op_type = ReduceAvg::kOpType,
+                .status = pb::TENSORSTATUS_SECRET,
+                .input = test::NamedTensor(
+                    "x", TensorFromJSON(arrow::boolean(),
+                                        "[true, false, true, true]")),
+                .output = test::NamedTensor(
+                    "y", TensorFromJSON(arrow::float32(), "[0.75]")),
+                .atol = 1e-4},
             // testcase: empty inputs
             ReduceTestCase{.op_type = ReduceSum::kOpType,
                            .status = pb::TENSORSTATUS_SECRET,
@@ -266,7 +307,7 @@ TEST_P(ReduceTest, Works) {
   auto actual_arr = actual_output->ToArrowChunkedArray();
   auto expect_arr = tc.output.tensor->ToArrowChunkedArray();
   EXPECT_TRUE(actual_arr->ApproxEquals(
-      *expect_arr, arrow::EqualOptions::Defaults().atol(0.001)))
+      *expect_arr, arrow::EqualOptions::Defaults().atol(tc.atol)))
       << "expect type = " << expect_arr->type()->ToString()
       << ", got type = " << actual_arr->type()->ToString()
       << "\nexpect result = " << expect_arr->ToString()
@@ -14,16 +14,52 @@
 
 #include "engine/operator/run_sql.h"
 
+#include "gflags/gflags.h"
 #include "spdlog/spdlog.h"
 #include "yacl/base/exception.h"
 
+#include "engine/core/arrow_helper.h"
+
 namespace scql::engine::op {
 
+DEFINE_int64(run_sql_max_result_bytes, 0,
+             "max memory of the result of one RunSQL, the query fails once "
+             "its result exceeds it, no limit if <= 0");
+DEFINE_int64(run_sql_prefetch_max_bytes, 1LL << 30,
+             "max memory of all prefetched results of RunSQL nodes in one "
+             "session, prefetching queries beyond it give up and the nodes "
+             "query again when they run, no limit if <= 0");
+DEFINE_int64(run_sql_partitions, 4,
+             "number of partitions of RunSQL with attribute partition_column "
+             "but without partition_num");
+
 const std::string RunSQL::kOpType("RunSQL");
 
 const std::string& RunSQL::Type() const { return kOpType; }
 
 void RunSQL::Execute(ExecContext* ctx) {
+  std::vector<TensorPtr> results;
+  auto prefetched = ctx->GetSession()->TakePrefetchedResult(ctx->GetNodeName());
+  if (prefetched.has_value()) {
+    results = std::move(*prefetched);
+    SPDLOG_INFO("use prefetched result of node {}", ctx->GetNodeName());
+  } else {
+    results = Query(ctx);
+  }
+
+  const auto& outputs_pb = ctx->GetOutput(kOut);
+  YACL_ENFORCE(results.size() == static_cast<size_t>(outputs_pb.size()),
+               "the size of ExecQuery results mismatch with expected_outputs");
+  for (int i = 0; i < outputs_pb.size(); ++i) {
+    ctx->GetTensorTable()->AddTensor(outputs_pb[i].name(), results[i]);
+  }
+  SPDLOG_INFO("get result row={}, column={}, chunks={}", results[0]->Length(),
+              results.size(),
+              results[0]->ToArrowChunkedArray()->num_chunks());
+}
+
+std::vector<TensorPtr> RunSQL::Query(
+    ExecContext* ctx, const std::function<void(int64_t)>& on_chunk) {
   std::string select = ctx->GetStringValueFromAttribute(kSQLAttr);
 
   std::vector<std::string> table_refs =
@@ -61,15 +97,105 @@ void RunSQL::Execute(ExecContext* ctx) {
                                   outputs_pb[i].elem_type());
   }
 
-  auto results = adaptor->ExecQuery(select, expected_outputs);
+  auto* cache = ctx->GetDatasourceAdaptorMgr()->GetQueryResultCache();
+  std::vector<TensorPtr> results;
+  if (cache == nullptr) {
+    results = ExecQuery(ctx, adaptor.get(), select, expected_outputs,
+                        on_chunk);
+  } else {
+    const auto& datasource = datasource_specs[0];
+    auto key = QueryResultCache::MakeKey(datasource.id(), select,
+                                         expected_outputs);
+    auto version = ProbeVersion(adaptor.get(), datasource.version_query());
+    if (auto cached = cache->Get(key, version)) {
+      SPDLOG_INFO("reuse cached result of query on datasource {}",
+                  datasource.id());
+      results = std::move(*cached);
+    } else {
+      results = ExecQuery(ctx, adaptor.get(), select, expected_outputs,
+                          on_chunk);
+      cache->Put(key, version, results);
+    }
+  }
 
-  YACL_ENFORCE(results.size() == expected_outputs.size(),
-               "the size of ExecQuery results mismatch with expected_outputs");
-  for (size_t i = 0; i < expected_outputs.size(); ++i) {
-    ctx->GetTensorTable()->AddTensor(expected_outputs[i].name, results[i]);
+  return results;
+}
+
+PrefetchedResult RunSQL::Prefetch(ExecContext* ctx,
+                                  std::shared_ptr<PrefetchState> state) {
+  PrefetchedResult result;
+  bool gave_up = false;
+  try {
+    result.tensors = Query(ctx, [&](int64_t bytes) {
+      if (!state->Reserve(bytes, FLAGS_run_sql_prefetch_max_bytes)) {
+        gave_up = true;
+        YACL_THROW("prefetching query of node {} gave up", ctx->GetNodeName());
+      }
+      result.bytes += bytes;
+    });
+  } catch (const std::exception& e) {
+    state->Release(result.bytes);
+    if (!gave_up) {
+      throw;
+    }
+    SPDLOG_INFO("{}, cancelled={}, prefetched bytes={}", e.what(),
+                state->IsCancelled(), state->GetBytes());
+    return PrefetchedResult();
+  }
+  return result;
+}
+
+std::vector<TensorPtr> RunSQL::ExecQuery(
+    ExecContext* ctx, DatasourceAdaptor* adaptor, const std::string& select,
+    const std::vector<ColumnDesc>& expected_outputs,
+    const std::function<void(int64_t)>& on_chunk) {
+  // result is read chunk by chunk, so the memory cap is checked before the
+  // whole result is fetched.
+  std::unique_ptr<ChunkedResult> chunked_result;
+  auto partition_column = GetPartitionColumn(ctx);
+  if (partition_column.empty()) {
+    chunked_result = adaptor->ExecQueryChunked(select, expected_outputs);
+  } else {
+    auto partitions = GetPartitionNum(ctx);
+    SPDLOG_INFO("run query in {} partitions by column {}", partitions,
+                partition_column);
+    chunked_result = adaptor->ExecQueryPartitioned(
+        select, expected_outputs, partition_column, partitions);
+  }
+  return ReadAllChunks(chunked_result.get(), FLAGS_run_sql_max_result_bytes,
+                       on_chunk);
+}
+
+std::string RunSQL::ProbeVersion(DatasourceAdaptor* adaptor,
+                                 const std::string& version_query) {
+  if (version_query.empty()) {
+    return "";
+  }
+  auto results = adaptor->ExecQuery(
+      version_query, {ColumnDesc("version", pb::PrimitiveDataType::STRING)});
+  YACL_ENFORCE(results.size() == 1 && results[0]->Length() > 0,
+               "version query should return one value: {}", version_query);
+  std::shared_ptr<arrow::Scalar> version;
+  ASSIGN_OR_THROW_ARROW_STATUS(
+      version, results[0]->ToArrowChunkedArray()->GetScalar(0));
+  return version->ToString();
+}
+
+std::string RunSQL::GetPartitionColumn(ExecContext* ctx) {
+  try {
+    return ctx->GetStringValueFromAttribute(kPartitionColumnAttr);
+  } catch (const ::yacl::EnforceNotMet&) {
+    // attribute partition_column is optional, query is not partitioned.
+    return "";
+  }
+}
+
+int64_t RunSQL::GetPartitionNum(ExecContext* ctx) {
+  try {
+    return ctx->GetInt64ValueFromAttribute(kPartitionNumAttr);
+  } catch (const ::yacl::EnforceNotMet&) {
+    return FLAGS_run_sql_partitions;
   }
-  SPDLOG_INFO("get result row={}, column={}", results[0]->Length(),
-              results.size());
 }
 
-}  // namespace scql::engine::op
\ No newline at end of file
+}  // namespace scql::engine::op
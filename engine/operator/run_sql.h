@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include "engine/framework/operator.h"
 
 namespace scql::engine::op {
@@ -26,13 +29,43 @@ class RunSQL : public Operator {
   // attributes
   static constexpr char kSQLAttr[] = "sql";
   static constexpr char kTableRefsAttr[] = "table_refs";
+  // optional, integer output column to split the query by, the partitions
+  // run concurrently.
+  static constexpr char kPartitionColumnAttr[] = "partition_column";
+  // optional, number of partitions, run_sql_partitions by default.
+  static constexpr char kPartitionNumAttr[] = "partition_num";
 
   RunSQL() = default;
 
   const std::string& Type() const override;
 
+  /// @brief run query of RunSQL node in @param[in] ctx without adding results
+  /// to tensor table.
+  /// @param[in] on_chunk see ReadAllChunks.
+  static std::vector<TensorPtr> Query(
+      ExecContext* ctx,
+      const std::function<void(int64_t)>& on_chunk = nullptr);
+
+  /// @brief run query of RunSQL node in @param[in] ctx before the node in
+  /// background, see Session::AddPrefetchedResult. @param[in] ctx has no
+  /// session, the query gives up once @param[in] state is cancelled or
+  /// prefetched results of the session take more than
+  /// run_sql_prefetch_max_bytes, then the node queries again when it runs.
+  static PrefetchedResult Prefetch(ExecContext* ctx,
+                                   std::shared_ptr<PrefetchState> state);
+
  protected:
   void Execute(ExecContext* ctx) override;
+
+  static std::vector<TensorPtr> ExecQuery(
+      ExecContext* ctx, DatasourceAdaptor* adaptor, const std::string& select,
+      const std::vector<ColumnDesc>& expected_outputs,
+      const std::function<void(int64_t)>& on_chunk);
+  // @returns result of version query of datasource, "" if there is none.
+  static std::string ProbeVersion(DatasourceAdaptor* adaptor,
+                                  const std::string& version_query);
+  static std::string GetPartitionColumn(ExecContext* ctx);
+  static int64_t GetPartitionNum(ExecContext* ctx);
 };
 
 }  // namespace scql::engine::op
\ No newline at end of file
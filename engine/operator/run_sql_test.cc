@@ -14,6 +14,9 @@
 
 #include "engine/operator/run_sql.h"
 
+#include <filesystem>
+#include <future>
+
 #include "Poco/Data/SQLite/Connector.h"
 #include "Poco/Data/Session.h"
 #include "absl/debugging/failure_signal_handler.h"
@@ -25,6 +28,8 @@
 #include "engine/datasource/embed_router.h"
 #include "engine/operator/test_util.h"
 
+DECLARE_int64(run_sql_prefetch_max_bytes);
+
 namespace scql::engine::op {
 
 class RunSQLTest : public ::testing::Test {
@@ -106,6 +111,208 @@ TEST_F(RunSQLTest, normal) {
   EXPECT_EQ(out_tensor->GetNullCount(), 2);
 }
 
+TEST_F(RunSQLTest, partitioned) {
+  // Given
+  const std::string query = "SELECT name, age FROM person";
+  const std::string out_name = "person.name";
+  const std::string out_age = "person.age";
+
+  test::ExecNodeBuilder node_builder(RunSQL::kOpType);
+  node_builder.AddStringAttr(RunSQL::kSQLAttr, query);
+  node_builder.AddStringsAttr(RunSQL::kTableRefsAttr, {"db.person"});
+  node_builder.AddStringAttr(RunSQL::kPartitionColumnAttr, "age");
+  node_builder.AddInt64Attr(RunSQL::kPartitionNumAttr, 3);
+  auto out0 = test::MakeTensorReference(out_name, pb::PrimitiveDataType::STRING,
+                                        pb::TensorStatus::TENSORSTATUS_PRIVATE);
+  auto out1 = test::MakeTensorReference(out_age, pb::PrimitiveDataType::INT64,
+                                        pb::TensorStatus::TENSORSTATUS_PRIVATE);
+  node_builder.AddOutput(RunSQL::kOut, {out0, out1});
+  auto node = node_builder.Build();
+
+  std::unique_ptr<Router> router = EmbedRouter::FromJsonStr(embed_router_conf_);
+  DatasourceAdaptorMgr ds_mgr;
+  auto session = test::Make1PCSession(router.get(), &ds_mgr);
+  ExecContext ctx(node, &session);
+  // When
+  RunSQL op;
+  op.Run(&ctx);
+  // Then rows of all partitions are returned, null ages in the first one
+  auto out_tensor = ctx.GetTensorTable()->GetTensor(out_age);
+  ASSERT_NE(nullptr, out_tensor);
+  EXPECT_EQ(out_tensor->Length(), 4);
+  EXPECT_EQ(out_tensor->GetNullCount(), 2);
+  out_tensor = ctx.GetTensorTable()->GetTensor(out_name);
+  ASSERT_NE(nullptr, out_tensor);
+  EXPECT_EQ(out_tensor->Length(), 4);
+  EXPECT_EQ(out_tensor->GetNullCount(), 1);
+}
+
+TEST_F(RunSQLTest, cachedResult) {
+  // Given
+  gflags::FlagSaver saver;
+  FLAGS_query_result_cache_dir =
+      (std::filesystem::temp_directory_path() / "runsql_cache_test").string();
+  const std::string out_age = "person.age";
+  test::ExecNodeBuilder node_builder(RunSQL::kOpType);
+  node_builder.AddStringAttr(RunSQL::kSQLAttr, "SELECT age FROM person");
+  node_builder.AddStringsAttr(RunSQL::kTableRefsAttr, {"db.person"});
+  node_builder.AddOutput(
+      RunSQL::kOut,
+      {test::MakeTensorReference(out_age, pb::PrimitiveDataType::INT64,
+                                 pb::TensorStatus::TENSORSTATUS_PRIVATE)});
+  auto node = node_builder.Build();
+
+  std::unique_ptr<Router> router = EmbedRouter::FromJsonStr(embed_router_conf_);
+  DatasourceAdaptorMgr ds_mgr;
+  ASSERT_NE(ds_mgr.GetQueryResultCache(), nullptr);
+  auto session = test::Make1PCSession(router.get(), &ds_mgr);
+  {
+    ExecContext ctx(node, &session);
+    RunSQL op;
+    op.Run(&ctx);
+  }
+
+  // When
+  using Poco::Data::Keywords::now;
+  *session_ << "INSERT INTO person VALUES(\"dave\", 30)", now;
+  auto another_session = test::Make1PCSession(router.get(), &ds_mgr);
+  ExecContext ctx(node, &another_session);
+  RunSQL op;
+  op.Run(&ctx);
+
+  // Then the result cached by the former session is returned
+  auto out_tensor = ctx.GetTensorTable()->GetTensor(out_age);
+  ASSERT_NE(nullptr, out_tensor);
+  EXPECT_EQ(out_tensor->Length(), 4);
+  std::filesystem::remove_all(FLAGS_query_result_cache_dir);
+}
+
+TEST_F(RunSQLTest, prefetched) {
+  // Given
+  const std::string out_age = "person.age";
+  test::ExecNodeBuilder node_builder(RunSQL::kOpType);
+  node_builder.AddStringAttr(RunSQL::kSQLAttr, "SELECT age FROM person");
+  node_builder.AddStringsAttr(RunSQL::kTableRefsAttr, {"db.person"});
+  node_builder.AddOutput(
+      RunSQL::kOut,
+      {test::MakeTensorReference(out_age, pb::PrimitiveDataType::INT64,
+                                 pb::TensorStatus::TENSORSTATUS_PRIVATE)});
+  auto node = node_builder.Build();
+
+  std::unique_ptr<Router> router = EmbedRouter::FromJsonStr(embed_router_conf_);
+  DatasourceAdaptorMgr ds_mgr;
+  auto session = test::Make1PCSession(router.get(), &ds_mgr);
+  auto claim = std::make_shared<PrefetchClaim>();
+  ASSERT_TRUE(claim->TryClaim());
+  auto prefetched = std::async(
+      std::launch::async,
+      [&node, &router, &ds_mgr, state = session.GetPrefetchState()] {
+        ExecContext ctx(node, router.get(), &ds_mgr);
+        return RunSQL::Prefetch(&ctx, state);
+      });
+  auto shared = prefetched.share();
+  session.AddPrefetchedResult(node.node_name(), claim, shared);
+  shared.wait();
+  EXPECT_GT(session.GetPrefetchState()->GetBytes(), 0);
+
+  // When rows are changed after the prefetching query finished
+  using Poco::Data::Keywords::now;
+  *session_ << "INSERT INTO person VALUES(\"dave\", 30)", now;
+  ExecContext ctx(node, &session);
+  RunSQL op;
+  op.Run(&ctx);
+
+  // Then the node claims the prefetched result
+  EXPECT_FALSE(session.TakePrefetchedResult(node.node_name()).has_value());
+  EXPECT_EQ(session.GetPrefetchState()->GetBytes(), 0);
+  auto out_tensor = ctx.GetTensorTable()->GetTensor(out_age);
+  ASSERT_NE(nullptr, out_tensor);
+  EXPECT_EQ(out_tensor->Length(), 4);
+}
+
+TEST_F(RunSQLTest, prefetchNotStarted) {
+  // Given
+  const std::string out_age = "person.age";
+  test::ExecNodeBuilder node_builder(RunSQL::kOpType);
+  node_builder.AddStringAttr(RunSQL::kSQLAttr, "SELECT age FROM person");
+  node_builder.AddStringsAttr(RunSQL::kTableRefsAttr, {"db.person"});
+  node_builder.AddOutput(
+      RunSQL::kOut,
+      {test::MakeTensorReference(out_age, pb::PrimitiveDataType::INT64,
+                                 pb::TensorStatus::TENSORSTATUS_PRIVATE)});
+  auto node = node_builder.Build();
+
+  std::unique_ptr<Router> router = EmbedRouter::FromJsonStr(embed_router_conf_);
+  DatasourceAdaptorMgr ds_mgr;
+  auto session = test::Make1PCSession(router.get(), &ds_mgr);
+
+  // When the prefetching task is still queued as the node runs
+  auto claim = std::make_shared<PrefetchClaim>();
+  std::promise<PrefetchedResult> queued;
+  session.AddPrefetchedResult(node.node_name(), claim, queued.get_future());
+  ExecContext ctx(node, &session);
+  RunSQL op;
+  op.Run(&ctx);
+
+  // Then the node queries without waiting, and the task won't query
+  auto out_tensor = ctx.GetTensorTable()->GetTensor(out_age);
+  ASSERT_NE(nullptr, out_tensor);
+  EXPECT_EQ(out_tensor->Length(), 4);
+  EXPECT_FALSE(claim->TryClaim());
+}
+
+TEST_F(RunSQLTest, prefetchGaveUp) {
+  // Given
+  const std::string out_age = "person.age";
+  test::ExecNodeBuilder node_builder(RunSQL::kOpType);
+  node_builder.AddStringAttr(RunSQL::kSQLAttr, "SELECT age FROM person");
+  node_builder.AddStringsAttr(RunSQL::kTableRefsAttr, {"db.person"});
+  node_builder.AddOutput(
+      RunSQL::kOut,
+      {test::MakeTensorReference(out_age, pb::PrimitiveDataType::INT64,
+                                 pb::TensorStatus::TENSORSTATUS_PRIVATE)});
+  auto node = node_builder.Build();
+
+  std::unique_ptr<Router> router = EmbedRouter::FromJsonStr(embed_router_conf_);
+  DatasourceAdaptorMgr ds_mgr;
+  ExecContext prefetch_ctx(node, router.get(), &ds_mgr);
+
+  // When prefetched results of the session take too much memory
+  gflags::FlagSaver saver;
+  FLAGS_run_sql_prefetch_max_bytes = 1;
+  auto session = test::Make1PCSession(router.get(), &ds_mgr);
+  std::promise<PrefetchedResult> over_budget;
+  over_budget.set_value(
+      RunSQL::Prefetch(&prefetch_ctx, session.GetPrefetchState()));
+  auto claim = std::make_shared<PrefetchClaim>();
+  ASSERT_TRUE(claim->TryClaim());
+  session.AddPrefetchedResult(node.node_name(), claim,
+                              over_budget.get_future());
+  ExecContext ctx(node, &session);
+  RunSQL op;
+  op.Run(&ctx);
+
+  // Then the prefetching query gives up and the node queries again
+  EXPECT_EQ(session.GetPrefetchState()->GetBytes(), 0);
+  auto out_tensor = ctx.GetTensorTable()->GetTensor(out_age);
+  ASSERT_NE(nullptr, out_tensor);
+  EXPECT_EQ(out_tensor->Length(), 4);
+
+  // When the session is removed before prefetching query runs
+  FLAGS_run_sql_prefetch_max_bytes = 0;
+  std::shared_ptr<PrefetchState> state;
+  {
+    auto removed = test::Make1PCSession(router.get(), &ds_mgr);
+    state = removed.GetPrefetchState();
+  }
+
+  // Then the prefetching query is cancelled
+  EXPECT_TRUE(state->IsCancelled());
+  auto cancelled = RunSQL::Prefetch(&prefetch_ctx, state);
+  EXPECT_FALSE(cancelled.tensors.has_value());
+  EXPECT_EQ(state->GetBytes(), 0);
+}
+
 }  // namespace scql::engine::op
 
 int main(int argc, char* argv[]) {
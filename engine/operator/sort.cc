@@ -14,10 +14,15 @@
 
 #include "engine/operator/sort.h"
 
+#include "arrow/compute/api.h"
 #include "libspu/kernel/hlo/basic_binary.h"
 #include "libspu/kernel/hlo/const.h"
 #include "libspu/kernel/hlo/sort.h"
 
+#include "engine/core/arrow_helper.h"
+#include "engine/util/composite_key.h"
+#include "engine/util/dictionary_util.h"
+#include "engine/util/sort_kernels.h"
 #include "engine/util/spu_io.h"
 #include "engine/util/tensor_util.h"
 
@@ -55,7 +60,40 @@ void Sort::Execute(ExecContext* ctx) {
 }
 
 void Sort::SortInPlain(ExecContext* ctx) {
-  YACL_THROW("SortInPlain is unimplemented");
+  const auto& sort_key_pbs = ctx->GetInput(kInKey);
+  const auto& in_pbs = ctx->GetInput(kIn);
+  const auto& out_pbs = ctx->GetOutput(kOut);
+
+  bool reverse = ctx->GetBooleanValueFromAttribute(kReverseAttr);
+
+  std::vector<std::shared_ptr<arrow::ChunkedArray>> sort_keys;
+  for (const auto& sort_key_pb : sort_key_pbs) {
+    auto sort_key = ctx->GetTensorTable()->GetTensor(sort_key_pb.name());
+    YACL_ENFORCE(sort_key != nullptr, "get private tensor={} failed",
+                 sort_key_pb.name());
+    sort_keys.push_back(
+        util::DictionaryDecode(sort_key)->ToArrowChunkedArray());
+  }
+  auto indices = util::SortIndices(sort_keys, reverse);
+
+  for (int i = 0; i < in_pbs.size(); ++i) {
+    auto in = ctx->GetTensorTable()->GetTensor(in_pbs[i].name());
+    YACL_ENFORCE(in != nullptr, "get private tensor={} failed",
+                 in_pbs[i].name());
+    YACL_ENFORCE_EQ(in->Length(), indices->length(),
+                    "input={} and sort keys have different length",
+                    in_pbs[i].name());
+    auto chunked_arr = in->ToArrowChunkedArray();
+    if (in->IsDictionaryEncoded()) {
+      // take concatenates chunks, which requires one shared dictionary
+      chunked_arr = util::UnifyDictionaries(chunked_arr);
+    }
+    arrow::Datum result;
+    ASSIGN_OR_THROW_ARROW_STATUS(result,
+                                 arrow::compute::Take(chunked_arr, indices));
+    ctx->GetTensorTable()->AddTensor(
+        out_pbs[i].name(), std::make_shared<Tensor>(result.chunked_array()));
+  }
 }
 
 void Sort::SortInSecret(ExecContext* ctx) {
@@ -66,12 +104,16 @@ void Sort::SortInSecret(ExecContext* ctx) {
   bool reverse = ctx->GetBooleanValueFromAttribute(kReverseAttr);
 
   auto symbols = ctx->GetSession()->GetDeviceSymbols();
+  auto hctx = ctx->GetSession()->GetSpuHalContext();
   std::vector<spu::Value> inputs;
   for (const auto& sort_key_pb : sort_key_pbs) {
     auto value = symbols->getVar(
         util::SpuVarNameEncoder::GetValueName(sort_key_pb.name()));
     inputs.push_back(value);
   }
+  // adjacent keys packed into one composite key need only one comparison
+  // per compare-exchange instead of one Less and one Equal per key.
+  inputs = util::PackKeys(hctx, inputs, GetKeyBits(ctx));
 
   size_t sort_key_num = inputs.size();
 
@@ -81,7 +123,6 @@ void Sort::SortInSecret(ExecContext* ctx) {
     inputs.push_back(value);
   }
 
-  auto hctx = ctx->GetSession()->GetSpuHalContext();
   auto scalar_cmp = [reverse](spu::HalContext* hctx, const spu::Value& lhs,
                               const spu::Value& rhs) {
     if (reverse) {
@@ -119,4 +160,13 @@ void Sort::SortInSecret(ExecContext* ctx) {
   // TODO: sort validity too
 }
 
+std::vector<int64_t> Sort::GetKeyBits(ExecContext* ctx) {
+  try {
+    return ctx->GetInt64ValuesFromAttribute(kKeyBitsAttr);
+  } catch (const ::yacl::EnforceNotMet&) {
+    // attribute key_bits is optional, keys are compared one by one.
+    return {};
+  }
+}
+
 }  // namespace scql::engine::op
\ No newline at end of file
@@ -25,6 +25,8 @@ class Sort : public Operator {
   static constexpr char kIn[] = "In";
   static constexpr char kOut[] = "Out";
   static constexpr char kReverseAttr[] = "reverse";
+  // optional, bits of each sort key, used to pack secret keys into one
+  static constexpr char kKeyBitsAttr[] = "key_bits";
 
   const std::string& Type() const override;
 
@@ -34,6 +36,7 @@ class Sort : public Operator {
  private:
   void SortInPlain(ExecContext* ctx);
   void SortInSecret(ExecContext* ctx);
+  static std::vector<int64_t> GetKeyBits(ExecContext* ctx);
 };
 
 }  // namespace scql::engine::op
\ No newline at end of file
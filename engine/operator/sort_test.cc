@@ -28,6 +28,7 @@ struct SortTestCase {
   std::vector<test::NamedTensor> sort_keys;
   std::vector<test::NamedTensor> inputs;
   std::vector<test::NamedTensor> outputs;
+  std::vector<int64_t> key_bits = {};
 };
 
 class SortTest : public testing::TestWithParam<
@@ -73,9 +74,96 @@ INSTANTIATE_TEST_SUITE_P(
                     "x1", TensorFromJSON(arrow::int64(), "[10,11,12,13,14]"))},
                 .outputs = {test::NamedTensor(
                     "y1", TensorFromJSON(arrow::int64(), "[11,12,10,14,13]"))}},
+            // testcase: keys packed into one composite key
+            SortTestCase{
+                .reverse = false,
+                .input_status = pb::TENSORSTATUS_SECRET,
+                .sort_keys =
+                    {test::NamedTensor("k1", TensorFromJSON(arrow::int64(),
+                                                            "[2,1,2,4,3]")),
+                     test::NamedTensor("k2", TensorFromJSON(arrow::int64(),
+                                                            "[2,1,1,3,4]"))},
+                .inputs = {test::NamedTensor(
+                    "x1", TensorFromJSON(arrow::int64(), "[10,11,12,13,14]"))},
+                .outputs = {test::NamedTensor(
+                    "y1", TensorFromJSON(arrow::int64(), "[11,12,10,14,13]"))},
+                .key_bits = {3, 3}},
+            SortTestCase{
+                .reverse = true,
+                .input_status = pb::TENSORSTATUS_SECRET,
+                .sort_keys =
+                    {test::NamedTensor("k1", TensorFromJSON(arrow::int64(),
+                                                            "[2,1,2,4,3]")),
+                     test::NamedTensor("k2", TensorFromJSON(arrow::int64(),
+                                                            "[2,1,1,3,4]"))},
+                .inputs = {test::NamedTensor(
+                    "x1", TensorFromJSON(arrow::int64(), "[10,11,12,13,14]"))},
+                .outputs = {test::NamedTensor(
+                    "y1", TensorFromJSON(arrow::int64(), "[13,14,10,12,11]"))},
+                .key_bits = {3, 3}},
+            // testcase: only adjacent keys with known bits are packed
+            SortTestCase{
+                .reverse = false,
+                .input_status = pb::TENSORSTATUS_SECRET,
+                .sort_keys =
+                    {test::NamedTensor("k0", TensorFromJSON(arrow::int64(),
+                                                            "[9,9,9,7,9]")),
+                     test::NamedTensor("k1", TensorFromJSON(arrow::int64(),
+                                                            "[2,1,2,4,3]")),
+                     test::NamedTensor("k2", TensorFromJSON(arrow::int64(),
+                                                            "[2,1,1,3,4]"))},
+                .inputs = {test::NamedTensor(
+                    "x1", TensorFromJSON(arrow::int64(), "[10,11,12,13,14]"))},
+                .outputs = {test::NamedTensor(
+                    "y1", TensorFromJSON(arrow::int64(), "[13,11,12,10,14]"))},
+                .key_bits = {0, 3, 3}},
             // testcase: empty inputs
             SortTestCase{.reverse = false,
                          .input_status = pb::TENSORSTATUS_SECRET,
+                         .sort_keys = {test::NamedTensor(
+                             "k1", TensorFromJSON(arrow::int64(), "[]"))},
+                         .inputs = {test::NamedTensor(
+                             "x1", TensorFromJSON(arrow::int64(), "[]"))},
+                         .outputs = {test::NamedTensor(
+                             "y1", TensorFromJSON(arrow::int64(), "[]"))}},
+            SortTestCase{
+                .reverse = false,
+                .input_status = pb::TENSORSTATUS_PRIVATE,
+                .sort_keys =
+                    {test::NamedTensor("k1", TensorFromJSON(arrow::int64(),
+                                                            "[2,1,2,4,3]")),
+                     test::NamedTensor(
+                         "k2",
+                         TensorFromJSON(arrow::utf8(),
+                                        R"json(["b","a","a",null,"c"])json"))},
+                .inputs = {test::NamedTensor(
+                               "x1", TensorFromJSON(arrow::int64(),
+                                                    "[10,11,12,13,14]")),
+                           test::NamedTensor(
+                               "x2", TensorFromJSON(arrow::float64(),
+                                                    "[1.5,null,2.5,3.5,4.5]"))},
+                .outputs = {test::NamedTensor(
+                                "y1", TensorFromJSON(arrow::int64(),
+                                                     "[11,12,10,14,13]")),
+                            test::NamedTensor(
+                                "y2",
+                                TensorFromJSON(arrow::float64(),
+                                               "[null,2.5,1.5,4.5,3.5]"))}},
+            SortTestCase{
+                .reverse = true,
+                .input_status = pb::TENSORSTATUS_PRIVATE,
+                .sort_keys = {test::NamedTensor(
+                    "k1", TensorFromJSON(arrow::float64(),
+                                         "[-1.5,null,2,-3,2]"))},
+                .inputs = {test::NamedTensor(
+                    "x1", TensorFromJSON(arrow::utf8(),
+                                         R"json(["a","b","c","d","e"])json"))},
+                .outputs = {test::NamedTensor(
+                    "y1", TensorFromJSON(arrow::utf8(),
+                                         R"json(["c","e","a","d","b"])json"))}},
+            // testcase: empty private inputs
+            SortTestCase{.reverse = false,
+                         .input_status = pb::TENSORSTATUS_PRIVATE,
                          .sort_keys = {test::NamedTensor(
                              "k1", TensorFromJSON(arrow::int64(), "[]"))},
                          .inputs = {test::NamedTensor(
@@ -95,21 +183,31 @@ TEST_P(SortTest, Works) {
 
   FeedInputs({&alice_ctx, &bob_ctx}, tc);
 
-  test::OperatorTestRunner<Sort> alice;
-  test::OperatorTestRunner<Sort> bob;
+  if (tc.input_status == pb::TENSORSTATUS_PRIVATE) {
+    // private data is sorted by its owner alone
+    Sort op;
+    EXPECT_NO_THROW({ op.Run(&alice_ctx); });
+  } else {
+    test::OperatorTestRunner<Sort> alice;
+    test::OperatorTestRunner<Sort> bob;
 
-  alice.Start(&alice_ctx);
-  bob.Start(&bob_ctx);
+    alice.Start(&alice_ctx);
+    bob.Start(&bob_ctx);
 
-  EXPECT_NO_THROW({ alice.Wait(); });
-  EXPECT_NO_THROW({ bob.Wait(); });
+    EXPECT_NO_THROW({ alice.Wait(); });
+    EXPECT_NO_THROW({ bob.Wait(); });
+  }
 
   for (const auto& named_tensor : tc.outputs) {
     TensorPtr actual_output = nullptr;
-    EXPECT_NO_THROW({
-      actual_output =
-          test::RevealSecret({&alice_ctx, &bob_ctx}, named_tensor.name);
-    });
+    if (tc.input_status == pb::TENSORSTATUS_PRIVATE) {
+      actual_output = alice_ctx.GetTensorTable()->GetTensor(named_tensor.name);
+    } else {
+      EXPECT_NO_THROW({
+        actual_output =
+            test::RevealSecret({&alice_ctx, &bob_ctx}, named_tensor.name);
+      });
+    }
     ASSERT_TRUE(actual_output != nullptr);
     auto actual_arr = actual_output->ToArrowChunkedArray();
     auto expect_arr = named_tensor.tensor->ToArrowChunkedArray();
@@ -149,6 +247,9 @@ pb::ExecNode SortTest::MakeExecNode(const SortTestCase& tc) {
   builder.AddOutput(Sort::kOut, outputs);
 
   builder.AddBooleanAttr(Sort::kReverseAttr, tc.reverse);
+  if (!tc.key_bits.empty()) {
+    builder.AddInt64sAttr(Sort::kKeyBitsAttr, tc.key_bits);
+  }
 
   return builder.Build();
 }
@@ -217,9 +217,10 @@ void FeedInputAsShares(const std::vector<ExecContext*>& ctxs,
                        const test::NamedTensor& input, spu::Visibility vtype) {
   auto proc = [](ExecContext* ctx, const test::NamedTensor& input,
                  spu::Visibility vtype) {
-    spu::device::ColocatedIo cio(ctx->GetSession()->GetSpuHalContext());
+    auto* hctx = ctx->GetSession()->GetSpuHalContext();
+    spu::device::ColocatedIo cio(hctx);
 
-    util::SpuInfeedHelper infeed_helper(&cio);
+    util::SpuInfeedHelper infeed_helper(hctx, &cio);
     if (ctx->GetSession()->GetLink()->Rank() == 0) {
       TensorPtr in_t = input.tensor;
       if (in_t->Type() == pb::PrimitiveDataType::STRING) {
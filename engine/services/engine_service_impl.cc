@@ -14,15 +14,22 @@
 
 #include "engine/services/engine_service_impl.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "brpc/channel.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "brpc/closure_guard.h"
 #include "google/protobuf/util/json_util.h"
 
 #include "engine/framework/exec.h"
 #include "engine/framework/executor.h"
 #include "engine/operator/all_ops_register.h"
+#include "engine/operator/make_private.h"
+#include "engine/operator/make_public.h"
+#include "engine/operator/publish.h"
+#include "engine/operator/run_sql.h"
 #include "engine/util/tensor_util.h"
 
 #include "api/status_code.pb.h"
@@ -49,6 +56,83 @@ std::string MessageToJsonString(const google::protobuf::Message& message) {
   return result;
 }
 
+// @returns true if tensor @param[in] t carries string hash values, which
+// are converted back to strings by Session::HashToString.
+bool IsHashedStringTensor(const scql::pb::Tensor& t) {
+  if (t.elem_type() != scql::pb::PrimitiveDataType::STRING) {
+    return false;
+  }
+  auto status = scql::engine::util::GetTensorStatus(t);
+  return status == scql::pb::TENSORSTATUS_SECRET ||
+         status == scql::pb::TENSORSTATUS_PUBLIC;
+}
+
+// @returns true if node @param[in] node may reveal hash values of strings,
+// whose reverse dictionary is needed to convert them back to strings.
+bool IsStringRevealNode(const scql::pb::ExecNode& node) {
+  return node.op_type() == scql::engine::op::MakePrivate::kOpType ||
+         node.op_type() == scql::engine::op::MakePublic::kOpType ||
+         node.op_type() == scql::engine::op::Publish::kOpType;
+}
+
+// Find all tensors whose string hash values may be revealed in the plan,
+// which are upstream tensors of hashed string inputs of reveal nodes. Node
+// ids of the nodes which may convert hashes back to strings are returned in
+// @param[out] consumer_nodes, including plaintext ops reading public strings.
+absl::flat_hash_set<std::string> CollectStringRevealScope(
+    const scql::pb::RunExecutionPlanRequest& request,
+    absl::flat_hash_set<std::string>* consumer_nodes) {
+  // tensor name -> node which outputs the tensor
+  absl::flat_hash_map<std::string, const scql::pb::ExecNode*> producers;
+  for (const auto& [node_id, node] : request.nodes()) {
+    for (const auto& [_, tensor_list] : node.outputs()) {
+      for (const auto& t : tensor_list.tensors()) {
+        producers[t.name()] = &node;
+      }
+    }
+  }
+
+  std::vector<std::string> to_visit;
+  for (const auto& [node_id, node] : request.nodes()) {
+    bool reveal_node = IsStringRevealNode(node);
+    for (const auto& [_, tensor_list] : node.inputs()) {
+      for (const auto& t : tensor_list.tensors()) {
+        if (!IsHashedStringTensor(t)) {
+          continue;
+        }
+        if (reveal_node) {
+          consumer_nodes->insert(node_id);
+          to_visit.push_back(t.name());
+        } else if (scql::engine::util::GetTensorStatus(t) ==
+                   scql::pb::TENSORSTATUS_PUBLIC) {
+          // public strings made by MakePublic are converted back by ops
+          // computing in plaintext, e.g. binary ops.
+          consumer_nodes->insert(node_id);
+        }
+      }
+    }
+  }
+
+  absl::flat_hash_set<std::string> scope;
+  while (!to_visit.empty()) {
+    std::string name = std::move(to_visit.back());
+    to_visit.pop_back();
+    if (!scope.insert(name).second) {
+      continue;
+    }
+    auto iter = producers.find(name);
+    if (iter == producers.end()) {
+      continue;
+    }
+    for (const auto& [_, tensor_list] : iter->second->inputs()) {
+      for (const auto& t : tensor_list.tensors()) {
+        to_visit.push_back(t.name());
+      }
+    }
+  }
+  return scope;
+}
+
 }  // namespace
 
 namespace scql::engine {
@@ -59,6 +143,7 @@ EngineServiceImpl::EngineServiceImpl(
     ChannelManager* channel_manager)
     : service_options_(options),
       session_mgr_(std::move(session_mgr)),
+      prefetch_pool_(std::max(options.prefetch_threads, 1)),
       channel_manager_(channel_manager) {
   if (options.enable_authorization && options.credential.empty()) {
     YACL_THROW(
@@ -257,6 +342,15 @@ void EngineServiceImpl::RunExecutionPlan(
     return;
   }
 
+  if (request->result_cursor()) {
+    // session is removed after result fetched or expired.
+    session_mgr_->KeepSessionAlive(
+        session_id, std::chrono::seconds(service_options_.result_ttl_s));
+    SPDLOG_INFO("RunExecutionPlan success, keep result of session({}) for {}s",
+                session_id, service_options_.result_ttl_s);
+    return;
+  }
+
   // 3. remove session.
   try {
     session_mgr_->RemoveSession(session_id);
@@ -275,10 +369,94 @@ void EngineServiceImpl::RunExecutionPlan(
   return;
 }
 
+void EngineServiceImpl::FetchResult(::google::protobuf::RpcController* cntl,
+                                    const pb::FetchResultRequest* request,
+                                    pb::FetchResultResponse* response,
+                                    ::google::protobuf::Closure* done) {
+  brpc::ClosureGuard done_guard(done);
+  // check illegal request.
+  auto controller = static_cast<brpc::Controller*>(cntl);
+  if (!CheckSCDBCredential(controller->http_request())) {
+    std::string err_msg = "scdb authentication failed";
+    LOG_ERROR_AND_SET_RESPONSE(pb::Code::UNAUTHENTICATED, err_msg);
+    return;
+  }
+  const std::string& session_id = request->session_id();
+  if (session_id.empty()) {
+    std::string err_msg = "session_id in request is empty";
+    LOG_ERROR_AND_SET_RESPONSE(pb::Code::INVALID_ARGUMENT, err_msg);
+    return;
+  }
+  if (request->offset() < 0) {
+    std::string err_msg =
+        fmt::format("offset={} in request is negative", request->offset());
+    LOG_ERROR_AND_SET_RESPONSE(pb::Code::INVALID_ARGUMENT, err_msg);
+    return;
+  }
+  // mark session running first, so it won't be removed while fetching.
+  if (!session_mgr_->SetSessionState(session_id, SessionState::IDLE,
+                                     SessionState::RUNNING)) {
+    std::string err_msg = fmt::format(
+        "session({}) not exists or is running before FetchResult", session_id);
+    LOG_ERROR_AND_SET_RESPONSE(pb::Code::SESSION_NOT_FOUND, err_msg);
+    return;
+  }
+  try {
+    auto session = session_mgr_->GetSession(session_id);
+    YACL_ENFORCE(session, "get session({}) failed", session_id);
+    YACL_ENFORCE(session->IsResultCursor(),
+                 "session({}) does not keep result for fetching", session_id);
+    int64_t total_rows = session->GetPublishRowCount();
+    int64_t max_rows = request->max_rows();
+    if (max_rows <= 0 || max_rows > service_options_.fetch_result_max_rows) {
+      max_rows = service_options_.fetch_result_max_rows;
+    }
+    int64_t offset = std::min(request->offset(), total_rows);
+    int64_t num_rows = std::min(max_rows, total_rows - offset);
+    bool exhausted = offset + num_rows >= total_rows;
+
+    response->set_out_columns_arrow_ipc(
+        session->GetPublishResultsInArrowIpc(offset, num_rows));
+    response->set_num_rows(num_rows);
+    response->set_total_rows(total_rows);
+    response->set_exhausted(exhausted);
+    response->mutable_status()->set_code(pb::Code::OK);
+    response->mutable_status()->set_message("ok");
+  } catch (const std::exception& e) {
+    std::string err_msg =
+        fmt::format("FetchResult({}) failed, catch std::exception={} ",
+                    session_id, e.what());
+    LOG_ERROR_AND_SET_RESPONSE(pb::Code::UNKNOWN_ENGINE_ERROR, err_msg);
+    response->clear_out_columns_arrow_ipc();
+  }
+
+  if (!session_mgr_->SetSessionState(session_id, SessionState::RUNNING,
+                                     SessionState::IDLE)) {
+    SPDLOG_WARN("set session({}) state failed after fetching", session_id);
+  }
+
+  // only sessions created by RunExecutionPlan are kept alive for fetching,
+  // others are stopped by StopSession.
+  // NOTE: keep the session even if all rows are fetched, so that the last page
+  // could be fetched again if its response is lost. It is removed by
+  // StopSession or when ttl expires.
+  if (session_mgr_->IsSessionKeptAlive(session_id)) {
+    session_mgr_->KeepSessionAlive(
+        session_id, std::chrono::seconds(service_options_.result_ttl_s));
+  }
+}
+
 void EngineServiceImpl::RunDagWithSession(const pb::RunDagRequest request,
                                           Session* session) {
   pb::Status status;
   try {
+    session->SetArrowIpcResult(request.arrow_ipc_result());
+    session->SetResultCursor(request.result_cursor());
+    std::vector<const pb::ExecNode*> nodes;
+    for (const auto& node : request.nodes()) {
+      nodes.push_back(&node);
+    }
+    PrefetchRunSQL(nodes, session);
     // TODO(jingshi): support async run SubDag's nodes.
     for (int idx = 0; idx < request.nodes_size(); ++idx) {
       const auto& node = request.nodes(idx);
@@ -332,6 +510,10 @@ std::string EngineServiceImpl::ConstructReportInfo(
   for (int i = 0; i < request.nodes_size(); i++) {
     const auto& node = request.nodes(i);
     if (node.op_type() == "Publish") {
+      if (session->IsArrowIpcResult() && !session->IsResultCursor()) {
+        report.set_out_columns_arrow_ipc(
+            session->GetPublishResultsInArrowIpc());
+      }
       auto results = session->GetPublishResults();
       for (const auto& result : results) {
         pb::Tensor* out_column = report.add_out_columns();
@@ -340,6 +522,8 @@ std::string EngineServiceImpl::ConstructReportInfo(
     } else if (node.op_type() == "DumpFile") {
       auto affected_rows = session->GetAffectedRows();
       report.set_num_rows_affected(affected_rows);
+      report.set_num_bytes_written(session->GetWrittenBytes());
+      report.set_num_files_written(session->GetWrittenFiles());
     }
   }
 
@@ -391,9 +575,53 @@ void EngineServiceImpl::ReportToScdb(const pb::RunDagRequest& request,
   return;
 }
 
+void EngineServiceImpl::PrefetchRunSQL(
+    const std::vector<const pb::ExecNode*>& nodes, Session* session) {
+  if (!service_options_.prefetch_run_sql) {
+    return;
+  }
+  for (const auto* node_ptr : nodes) {
+    const pb::ExecNode& node = *node_ptr;
+    // RunSQL has no input, so it could run at any time.
+    if (node.op_type() != op::RunSQL::kOpType) {
+      continue;
+    }
+    SPDLOG_INFO("session({}) prefetch node({})", session->Id(),
+                node.node_name());
+    // session doesn't wait for prefetching queries, so they must not refer
+    // to it, router and adaptors outlive sessions and the pool.
+    auto claim = std::make_shared<PrefetchClaim>();
+    auto result = prefetch_pool_.Submit(
+        [node, claim, router = session->GetRouter(),
+         ds_mgr = session->GetDatasourceAdaptorMgr(),
+         state = session->GetPrefetchState()]() {
+          if (!claim->TryClaim()) {
+            // the node ran first and queried itself
+            return PrefetchedResult();
+          }
+          ExecContext context(node, router, ds_mgr);
+          return op::RunSQL::Prefetch(&context, state);
+        });
+    session->AddPrefetchedResult(node.node_name(), claim, result.share());
+  }
+}
+
 void EngineServiceImpl::RunPlan(const pb::RunExecutionPlanRequest& request,
                                 Session* session,
                                 pb::RunExecutionPlanResponse* response) {
+  // the whole plan is known here, so only keep reverse dictionary for strings
+  // which may be revealed, and free it after the last consumer finished.
+  absl::flat_hash_set<std::string> string_consumer_nodes;
+  session->SetStringRevealScope(
+      CollectStringRevealScope(request, &string_consumer_nodes));
+  session->SetArrowIpcResult(request.arrow_ipc_result());
+  session->SetResultCursor(request.result_cursor());
+  std::vector<const pb::ExecNode*> nodes;
+  for (const auto& [_, node] : request.nodes()) {
+    nodes.push_back(&node);
+  }
+  PrefetchRunSQL(nodes, session);
+
   const auto& policy = request.policy();
   for (const auto& subdag : policy.subdags()) {
     for (const auto& job : subdag.jobs()) {
@@ -418,6 +646,10 @@ void EngineServiceImpl::RunPlan(const pb::RunExecutionPlanRequest& request,
             std::chrono::duration_cast<std::chrono::milliseconds>(end - start)
                 .count());
         if (node.op_type() == "Publish") {
+          if (session->IsArrowIpcResult() && !session->IsResultCursor()) {
+            response->set_out_columns_arrow_ipc(
+                session->GetPublishResultsInArrowIpc());
+          }
           auto results = session->GetPublishResults();
           for (const auto& result : results) {
             pb::Tensor* out_column = response->add_out_columns();
@@ -426,6 +658,12 @@ void EngineServiceImpl::RunPlan(const pb::RunExecutionPlanRequest& request,
         } else if (node.op_type() == "DumpFile") {
           auto affected_rows = session->GetAffectedRows();
           response->set_num_rows_affected(affected_rows);
+          response->set_num_bytes_written(session->GetWrittenBytes());
+          response->set_num_files_written(session->GetWrittenFiles());
+        }
+        if (string_consumer_nodes.erase(node_id) > 0 &&
+            string_consumer_nodes.empty()) {
+          session->ReleaseStringDictionary();
         }
       }
     }
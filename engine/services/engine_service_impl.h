@@ -28,6 +28,16 @@ namespace scql::engine {
 struct EngineServiceOptions {
   bool enable_authorization = false;
   std::string credential;
+  // how long a session keeps its result for FetchResult since the plan
+  // finished or the last fetch.
+  int32_t result_ttl_s = 600;
+  // max number of rows returned by one FetchResult.
+  int64_t fetch_result_max_rows = 100000;
+  // whether to start queries of RunSQL nodes once the plan arrives, instead
+  // of when the nodes are reached.
+  bool prefetch_run_sql = true;
+  // threads to run prefetching queries of all sessions.
+  int32_t prefetch_threads = 8;
 };
 
 class EngineServiceImpl : public pb::SCQLEngineService {
@@ -59,6 +69,11 @@ class EngineServiceImpl : public pb::SCQLEngineService {
                         pb::RunExecutionPlanResponse* response,
                         ::google::protobuf::Closure* done) override;
 
+  void FetchResult(::google::protobuf::RpcController* cntl,
+                   const pb::FetchResultRequest* request,
+                   pb::FetchResultResponse* response,
+                   ::google::protobuf::Closure* done) override;
+
  private:
   void RunDagWithSession(const pb::RunDagRequest request, Session* session);
 
@@ -74,11 +89,18 @@ class EngineServiceImpl : public pb::SCQLEngineService {
 
   bool CheckSCDBCredential(const brpc::HttpHeader& http_header);
 
+  // start queries of RunSQL nodes in @param[in] nodes in background, the
+  // nodes claim the results from session when they run.
+  void PrefetchRunSQL(const std::vector<const pb::ExecNode*>& nodes,
+                      Session* session);
+
  private:
   const EngineServiceOptions service_options_;
   std::unique_ptr<SessionManager> session_mgr_;
   // thread pool to run RunDag tasks.
   yacl::ThreadPool worker_pool_;
+  // thread pool to run prefetching queries of RunSQL nodes.
+  yacl::ThreadPool prefetch_pool_;
 
   ChannelManager* channel_manager_;
 
@@ -16,6 +16,9 @@
 
 #include "Poco/Data/SQLite/Connector.h"
 #include "Poco/Data/Session.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/table.h"
 #include "brpc/server.h"
 #include "gtest/gtest.h"
 #include "spdlog/spdlog.h"
@@ -400,6 +403,101 @@ TEST_P(EngineServiceImpl2PartiesTest, RunExecutionPlan) {
   check_equal(response_bob.out_columns(0), test_case.inner_join_result);
 }
 
+TEST_P(EngineServiceImpl2PartiesTest, FetchResultInPages) {
+  // Given
+  auto test_case = GetParam();
+  auto session = PrepareTableInMemory(
+      test_case, "file:runsql_test?mode=memory&cache=shared");
+
+  // When
+  auto proc = [&](EngineServiceImpl* svc, pb::RunExecutionPlanRequest* request,
+                  pb::RunExecutionPlanResponse* response) {
+    request->set_result_cursor(true);
+    EXPECT_NO_THROW(
+        svc->RunExecutionPlan(&global_cntl, request, response, nullptr));
+    EXPECT_EQ(pb::Code::OK, response->status().code());
+  };
+
+  pb::RunExecutionPlanResponse response_alice;
+  pb::RunExecutionPlanRequest request_alice = ConstructRequestForAlice(servers);
+  auto future_alice =
+      std::async(proc, engine_svcs[0].get(), &request_alice, &response_alice);
+
+  pb::RunExecutionPlanResponse response_bob;
+  pb::RunExecutionPlanRequest request_bob = ConstructRequestForBob(servers);
+  auto future_bob =
+      std::async(proc, engine_svcs[1].get(), &request_bob, &response_bob);
+  EXPECT_NO_THROW(future_alice.wait());
+  EXPECT_NO_THROW(future_bob.wait());
+
+  // Then
+  EXPECT_EQ(response_alice.out_columns_size(), 0);
+  std::vector<std::string> fetched;
+  pb::FetchResultRequest fetch_request;
+  fetch_request.set_session_id(response_alice.session_id());
+  fetch_request.set_max_rows(1);
+  pb::FetchResultResponse fetch_response;
+  do {
+    fetch_response.Clear();
+    EXPECT_NO_THROW(engine_svcs[0]->FetchResult(
+        &global_cntl, &fetch_request, &fetch_response, nullptr));
+    ASSERT_EQ(pb::Code::OK, fetch_response.status().code());
+    EXPECT_LE(fetch_response.num_rows(), 1);
+
+    auto reader = arrow::ipc::RecordBatchStreamReader::Open(
+        std::make_shared<arrow::io::BufferReader>(arrow::Buffer::FromString(
+            fetch_response.out_columns_arrow_ipc())));
+    ASSERT_TRUE(reader.ok());
+    auto table = (*reader)->ToTable();
+    ASSERT_TRUE(table.ok());
+    ASSERT_EQ(1, (*table)->num_columns());
+    ASSERT_EQ(fetch_response.num_rows(), (*table)->num_rows());
+    for (const auto& chunk : (*table)->column(0)->chunks()) {
+      auto strs = std::static_pointer_cast<arrow::StringArray>(chunk);
+      for (int64_t i = 0; i < strs->length(); ++i) {
+        fetched.push_back(strs->GetString(i));
+      }
+    }
+    fetch_request.set_offset(fetch_request.offset() +
+                             fetch_response.num_rows());
+  } while (!fetch_response.exhausted());
+
+  std::sort(fetched.begin(), fetched.end());
+  std::sort(test_case.inner_join_result.begin(),
+            test_case.inner_join_result.end());
+  EXPECT_EQ(test_case.inner_join_result, fetched);
+  EXPECT_EQ(static_cast<int64_t>(test_case.inner_join_result.size()),
+            fetch_response.total_rows());
+
+  // last page could be fetched again, e.g. when its response is lost.
+  auto last_page = fetch_response.out_columns_arrow_ipc();
+  fetch_request.set_offset(fetch_request.offset() - fetch_response.num_rows());
+  fetch_response.Clear();
+  EXPECT_NO_THROW(engine_svcs[0]->FetchResult(&global_cntl, &fetch_request,
+                                              &fetch_response, nullptr));
+  EXPECT_EQ(pb::Code::OK, fetch_response.status().code());
+  EXPECT_TRUE(fetch_response.exhausted());
+  EXPECT_EQ(last_page, fetch_response.out_columns_arrow_ipc());
+
+  // session is removed by StopSession.
+  pb::StopSessionRequest stop_request;
+  stop_request.set_session_id(response_alice.session_id());
+  pb::StopSessionResponse stop_response;
+  EXPECT_NO_THROW(engine_svcs[0]->StopSession(&global_cntl, &stop_request,
+                                              &stop_response, nullptr));
+  EXPECT_EQ(pb::Code::OK, stop_response.status().code());
+  EXPECT_NO_THROW(engine_svcs[0]->FetchResult(&global_cntl, &fetch_request,
+                                              &fetch_response, nullptr));
+  EXPECT_EQ(pb::Code::SESSION_NOT_FOUND, fetch_response.status().code());
+
+  // bob's result is still kept since it is not fetched yet.
+  fetch_request.set_session_id(response_bob.session_id());
+  fetch_request.set_offset(0);
+  EXPECT_NO_THROW(engine_svcs[1]->FetchResult(&global_cntl, &fetch_request,
+                                              &fetch_response, nullptr));
+  EXPECT_EQ(pb::Code::OK, fetch_response.status().code());
+}
+
 /// ===========================
 /// Test for 2 Parties Implementation
 /// ===========================
@@ -0,0 +1,228 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "engine/util/bit_kernels.h"
+
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SCQL_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace scql::engine::util {
+
+namespace {
+
+// kByteToBools[v] holds 8 bytes, the i-th byte is the i-th bit of v.
+constexpr std::array<uint64_t, 256> MakeByteToBoolsTable() {
+  std::array<uint64_t, 256> table{};
+  for (uint64_t v = 0; v < 256; ++v) {
+    uint64_t expanded = 0;
+    for (int i = 0; i < 8; ++i) {
+      expanded |= ((v >> i) & 1) << (8 * i);
+    }
+    table[v] = expanded;
+  }
+  return table;
+}
+
+constexpr std::array<uint64_t, 256> kByteToBools = MakeByteToBoolsTable();
+
+inline bool GetBit(const uint8_t* bits, int64_t i) {
+  return (bits[i >> 3] >> (i & 7)) & 1;
+}
+
+// @returns packed byte for 8 bytes of 0/1 values
+inline uint8_t PackByte(const uint8_t* bytes) {
+  uint64_t word;
+  std::memcpy(&word, bytes, sizeof(word));
+  // normalize non-zero bytes to 1
+  word = ((word | ((word & 0x7F7F7F7F7F7F7F7FULL) + 0x7F7F7F7F7F7F7F7FULL)) >>
+          7) &
+         0x0101010101010101ULL;
+  return static_cast<uint8_t>((word * 0x0102040810204080ULL) >> 56);
+}
+
+// unpack whole bytes, bits is byte aligned here.
+void UnpackBytesScalar(const uint8_t* bits, int64_t nbytes, uint8_t* out) {
+  for (int64_t i = 0; i < nbytes; ++i) {
+    std::memcpy(out + i * 8, &kByteToBools[bits[i]], sizeof(uint64_t));
+  }
+}
+
+int64_t PackBytesScalar(const uint8_t* bytes, int64_t nbytes, uint8_t* bits) {
+  int64_t count = 0;
+  for (int64_t i = 0; i < nbytes; ++i) {
+    bits[i] = PackByte(bytes + i * 8);
+    count += __builtin_popcount(bits[i]);
+  }
+  return count;
+}
+
+#ifdef SCQL_X86_SIMD
+
+// unpack 32 bits per iteration
+__attribute__((target("avx2"))) int64_t UnpackBytesAvx2(const uint8_t* bits,
+                                                        int64_t nbytes,
+                                                        uint8_t* out) {
+  // after broadcasting 4 bytes to every 128-bit lane, byte k of the output
+  // should take input byte k / 8.
+  const __m256i shuffle = _mm256_setr_epi8(
+      0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+      3, 3, 3, 3, 3, 3, 3, 3);
+  const __m256i bit_mask = _mm256_set1_epi64x(0x8040201008040201LL);
+  const __m256i ones = _mm256_set1_epi8(1);
+
+  int64_t i = 0;
+  for (; i + 4 <= nbytes; i += 4) {
+    int32_t word;
+    std::memcpy(&word, bits + i, sizeof(word));
+    __m256i v = _mm256_shuffle_epi8(_mm256_set1_epi32(word), shuffle);
+    v = _mm256_cmpeq_epi8(_mm256_and_si256(v, bit_mask), bit_mask);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 8),
+                        _mm256_and_si256(v, ones));
+  }
+  return i;
+}
+
+// pack 32 bytes per iteration
+__attribute__((target("avx2,popcnt"))) int64_t PackBytesAvx2(
+    const uint8_t* bytes, int64_t nbytes, uint8_t* bits, int64_t* count) {
+  const __m256i zero = _mm256_setzero_si256();
+
+  int64_t i = 0;
+  for (; i + 4 <= nbytes; i += 4) {
+    __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i * 8));
+    uint32_t mask =
+        ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero)));
+    std::memcpy(bits + i, &mask, sizeof(mask));
+    *count += _mm_popcnt_u32(mask);
+  }
+  return i;
+}
+
+#endif  // SCQL_X86_SIMD
+
+template <int64_t kElemSize>
+void StridedGatherFixed(const uint8_t* src, int64_t stride_bytes,
+                        int64_t length, uint8_t* dst) {
+  for (int64_t i = 0; i < length; ++i) {
+    std::memcpy(dst + i * kElemSize, src + i * stride_bytes, kElemSize);
+  }
+}
+
+}  // namespace
+
+SimdLevel GetSimdLevel() {
+#ifdef SCQL_X86_SIMD
+  static const SimdLevel level = __builtin_cpu_supports("avx2")
+                                     ? SimdLevel::kAvx2
+                                     : SimdLevel::kNone;
+  return level;
+#else
+  return SimdLevel::kNone;
+#endif  // SCQL_X86_SIMD
+}
+
+void UnpackBits(const uint8_t* bits, int64_t bit_offset, int64_t length,
+                uint8_t* bytes, SimdLevel level) {
+  if (length <= 0) {
+    return;
+  }
+  bits += bit_offset / 8;
+  bit_offset %= 8;
+
+  // leading bits until byte aligned
+  int64_t i = 0;
+  if (bit_offset != 0) {
+    for (; i < length && bit_offset + i < 8; ++i) {
+      bytes[i] = GetBit(bits, bit_offset + i);
+    }
+    bits += 1;
+  }
+
+  const int64_t nbytes = (length - i) / 8;
+  int64_t done = 0;
+#ifdef SCQL_X86_SIMD
+  if (level == SimdLevel::kAvx2) {
+    done = UnpackBytesAvx2(bits, nbytes, bytes + i);
+  }
+#endif  // SCQL_X86_SIMD
+  UnpackBytesScalar(bits + done, nbytes - done, bytes + i + done * 8);
+
+  // trailing bits
+  for (int64_t j = nbytes * 8; i + j < length; ++j) {
+    bytes[i + j] = GetBit(bits, j);
+  }
+}
+
+int64_t PackBits(const uint8_t* bytes, int64_t length, uint8_t* bits,
+                 SimdLevel level) {
+  if (length <= 0) {
+    return 0;
+  }
+  const int64_t nbytes = length / 8;
+  int64_t count = 0;
+  int64_t done = 0;
+#ifdef SCQL_X86_SIMD
+  if (level == SimdLevel::kAvx2) {
+    done = PackBytesAvx2(bytes, nbytes, bits, &count);
+  }
+#endif  // SCQL_X86_SIMD
+  count += PackBytesScalar(bytes + done * 8, nbytes - done, bits + done);
+
+  // trailing bytes
+  if (nbytes * 8 < length) {
+    uint8_t last = 0;
+    for (int64_t j = nbytes * 8; j < length; ++j) {
+      if (bytes[j] != 0) {
+        last |= static_cast<uint8_t>(1 << (j & 7));
+        ++count;
+      }
+    }
+    bits[nbytes] = last;
+  }
+  return count;
+}
+
+void StridedGather(const uint8_t* src, int64_t stride_bytes, int64_t elsize,
+                   int64_t length, uint8_t* dst) {
+  if (stride_bytes == elsize) {
+    std::memcpy(dst, src, length * elsize);
+    return;
+  }
+  // specialize common element sizes so that memcpy is inlined as a single
+  // load/store.
+  switch (elsize) {
+    case 1:
+      return StridedGatherFixed<1>(src, stride_bytes, length, dst);
+    case 2:
+      return StridedGatherFixed<2>(src, stride_bytes, length, dst);
+    case 4:
+      return StridedGatherFixed<4>(src, stride_bytes, length, dst);
+    case 8:
+      return StridedGatherFixed<8>(src, stride_bytes, length, dst);
+    case 16:
+      return StridedGatherFixed<16>(src, stride_bytes, length, dst);
+    default:
+      for (int64_t i = 0; i < length; ++i) {
+        std::memcpy(dst + i * elsize, src + i * stride_bytes, elsize);
+      }
+  }
+}
+
+}  // namespace scql::engine::util
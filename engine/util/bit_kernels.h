@@ -0,0 +1,50 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+/// Kernels used to convert data between arrow layout and spu layout:
+///   - arrow stores bool values and validity as bitmap (LSB first);
+///   - spu stores bool values as one byte per element, and arrays may be
+///     strided.
+namespace scql::engine::util {
+
+enum class SimdLevel {
+  kNone = 0,
+  kAvx2 = 1,
+};
+
+/// @returns the best simd level supported by current cpu, detected at runtime.
+SimdLevel GetSimdLevel();
+
+/// @brief expand bits [bit_offset, bit_offset + length) of @param[in] bits to
+/// one byte per bit(0 or 1) in @param[out] bytes.
+void UnpackBits(const uint8_t* bits, int64_t bit_offset, int64_t length,
+                uint8_t* bytes, SimdLevel level = GetSimdLevel());
+
+/// @brief pack @param[in] bytes into bitmap @param[out] bits, any non-zero
+/// byte is treated as true. Trailing bits of the last byte are cleared.
+/// @returns the number of true values.
+int64_t PackBits(const uint8_t* bytes, int64_t length, uint8_t* bits,
+                 SimdLevel level = GetSimdLevel());
+
+/// @brief copy @param[in] length elements of size @param[in] elsize from
+/// @param[in] src, whose adjacent elements are @param[in] stride_bytes apart,
+/// to contiguous @param[out] dst.
+void StridedGather(const uint8_t* src, int64_t stride_bytes, int64_t elsize,
+                   int64_t length, uint8_t* dst);
+
+}  // namespace scql::engine::util
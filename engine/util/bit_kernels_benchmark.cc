@@ -0,0 +1,113 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "engine/util/bit_kernels.h"
+
+namespace scql::engine::util {
+namespace {
+
+std::vector<uint8_t> RandomBytes(int64_t len) {
+  std::mt19937 rng(2023);
+  std::vector<uint8_t> bytes(len);
+  for (auto& b : bytes) {
+    b = static_cast<uint8_t>(rng());
+  }
+  return bytes;
+}
+
+// baseline: bit by bit, which is what arrow BooleanArray::GetView does
+void BM_UnpackBitsNaive(benchmark::State& state) {
+  const int64_t length = state.range(0);
+  auto bits = RandomBytes((length + 7) / 8);
+  std::vector<uint8_t> bytes(length);
+  for (auto _ : state) {
+    for (int64_t i = 0; i < length; ++i) {
+      bytes[i] = (bits[i >> 3] >> (i & 7)) & 1;
+    }
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+void BM_UnpackBits(benchmark::State& state) {
+  const int64_t length = state.range(0);
+  const auto level = static_cast<SimdLevel>(state.range(1));
+  auto bits = RandomBytes((length + 7) / 8);
+  std::vector<uint8_t> bytes(length);
+  for (auto _ : state) {
+    UnpackBits(bits.data(), 0, length, bytes.data(), level);
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+void BM_PackBitsNaive(benchmark::State& state) {
+  const int64_t length = state.range(0);
+  auto bytes = RandomBytes(length);
+  std::vector<uint8_t> bits((length + 7) / 8);
+  for (auto _ : state) {
+    std::fill(bits.begin(), bits.end(), 0);
+    for (int64_t i = 0; i < length; ++i) {
+      bits[i >> 3] |= static_cast<uint8_t>((bytes[i] != 0) << (i & 7));
+    }
+    benchmark::DoNotOptimize(bits.data());
+  }
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+void BM_PackBits(benchmark::State& state) {
+  const int64_t length = state.range(0);
+  const auto level = static_cast<SimdLevel>(state.range(1));
+  auto bytes = RandomBytes(length);
+  std::vector<uint8_t> bits((length + 7) / 8);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(PackBits(bytes.data(), length, bits.data(), level));
+  }
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+void BM_StridedGather(benchmark::State& state) {
+  const int64_t length = state.range(0);
+  const int64_t stride = state.range(1);
+  auto src = RandomBytes(length * stride * sizeof(int64_t));
+  std::vector<uint8_t> dst(length * sizeof(int64_t));
+  for (auto _ : state) {
+    StridedGather(src.data(), stride * sizeof(int64_t), sizeof(int64_t),
+                  length, dst.data());
+    benchmark::DoNotOptimize(dst.data());
+  }
+  state.SetBytesProcessed(state.iterations() * length * sizeof(int64_t));
+}
+
+constexpr int64_t kLength = 1 << 20;
+
+BENCHMARK(BM_UnpackBitsNaive)->Arg(kLength);
+BENCHMARK(BM_UnpackBits)
+    ->Args({kLength, static_cast<int64_t>(SimdLevel::kNone)})
+    ->Args({kLength, static_cast<int64_t>(GetSimdLevel())});
+BENCHMARK(BM_PackBitsNaive)->Arg(kLength);
+BENCHMARK(BM_PackBits)
+    ->Args({kLength, static_cast<int64_t>(SimdLevel::kNone)})
+    ->Args({kLength, static_cast<int64_t>(GetSimdLevel())});
+BENCHMARK(BM_StridedGather)->Args({kLength, 1})->Args({kLength, 2});
+
+}  // namespace
+}  // namespace scql::engine::util
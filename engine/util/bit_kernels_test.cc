@@ -0,0 +1,110 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "engine/util/bit_kernels.h"
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace scql::engine::util {
+
+class BitKernelsTest : public ::testing::TestWithParam<SimdLevel> {
+ protected:
+  void SetUp() override {
+    if (GetParam() == SimdLevel::kAvx2 &&
+        GetSimdLevel() != SimdLevel::kAvx2) {
+      GTEST_SKIP() << "avx2 is not supported by current cpu";
+    }
+  }
+
+  std::mt19937 rng_{2023};
+};
+
+INSTANTIATE_TEST_SUITE_P(BitKernelsBatchTest, BitKernelsTest,
+                         testing::Values(SimdLevel::kNone, SimdLevel::kAvx2));
+
+TEST_P(BitKernelsTest, UnpackBits) {
+  for (int64_t length : {0, 1, 7, 8, 9, 31, 32, 33, 100, 257}) {
+    for (int64_t offset : {0, 1, 5, 8, 13}) {
+      std::vector<uint8_t> bits((offset + length + 7) / 8);
+      for (auto& b : bits) {
+        b = static_cast<uint8_t>(rng_());
+      }
+      // one more byte to detect overrun
+      std::vector<uint8_t> bytes(length + 1, 0xAA);
+
+      UnpackBits(bits.data(), offset, length, bytes.data(), GetParam());
+
+      for (int64_t i = 0; i < length; ++i) {
+        int64_t pos = offset + i;
+        EXPECT_EQ(bytes[i], (bits[pos / 8] >> (pos % 8)) & 1)
+            << "length=" << length << ", offset=" << offset << ", i=" << i;
+      }
+      EXPECT_EQ(bytes[length], 0xAA);
+    }
+  }
+}
+
+TEST_P(BitKernelsTest, PackBits) {
+  for (int64_t length : {0, 1, 7, 8, 9, 31, 32, 33, 100, 257}) {
+    std::vector<uint8_t> bytes(length);
+    int64_t expect_count = 0;
+    for (auto& b : bytes) {
+      // non-zero values other than 1 should be treated as true too
+      b = rng_() % 2 == 0 ? 0 : static_cast<uint8_t>(rng_() % 255 + 1);
+      expect_count += b != 0;
+    }
+    std::vector<uint8_t> bits((length + 7) / 8, 0xFF);
+
+    int64_t count = PackBits(bytes.data(), length, bits.data(), GetParam());
+
+    EXPECT_EQ(count, expect_count);
+    for (int64_t i = 0; i < length; ++i) {
+      EXPECT_EQ((bits[i / 8] >> (i % 8)) & 1, bytes[i] != 0)
+          << "length=" << length << ", i=" << i;
+    }
+    if (length % 8 != 0) {
+      // trailing bits should be cleared
+      EXPECT_EQ(bits.back() >> (length % 8), 0);
+    }
+  }
+}
+
+TEST(StridedGatherTest, works) {
+  std::vector<int64_t> src(100);
+  for (size_t i = 0; i < src.size(); ++i) {
+    src[i] = i;
+  }
+
+  std::vector<int64_t> dst(34);
+  StridedGather(reinterpret_cast<const uint8_t*>(src.data()),
+                3 * sizeof(int64_t), sizeof(int64_t), dst.size(),
+                reinterpret_cast<uint8_t*>(dst.data()));
+  for (size_t i = 0; i < dst.size(); ++i) {
+    EXPECT_EQ(dst[i], static_cast<int64_t>(3 * i));
+  }
+
+  // negative strides
+  StridedGather(reinterpret_cast<const uint8_t*>(src.data() + 99),
+                -static_cast<int64_t>(sizeof(int64_t)), sizeof(int64_t),
+                dst.size(), reinterpret_cast<uint8_t*>(dst.data()));
+  for (size_t i = 0; i < dst.size(); ++i) {
+    EXPECT_EQ(dst[i], static_cast<int64_t>(99 - i));
+  }
+}
+
+}  // namespace scql::engine::util
@@ -0,0 +1,90 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "engine/util/composite_key.h"
+
+#include <algorithm>
+
+#include "libspu/core/type_util.h"
+#include "libspu/kernel/hlo/basic_binary.h"
+#include "libspu/kernel/hlo/casting.h"
+#include "libspu/kernel/hlo/const.h"
+
+namespace scql::engine::util {
+
+namespace {
+
+// pack keys[begin, end) whose total bits is @param[in] total_bits.
+spu::Value PackRun(spu::HalContext* hctx, const std::vector<spu::Value>& keys,
+                   const std::vector<int64_t>& key_bits, size_t begin,
+                   size_t end, int64_t total_bits) {
+  spu::Value packed;
+  int64_t shift = total_bits;
+  for (size_t i = begin; i < end; ++i) {
+    shift -= key_bits[i];
+    auto key =
+        spu::kernel::hlo::Cast(hctx, keys[i], keys[i].vtype(), spu::DT_I64);
+    if (shift > 0) {
+      // multiplying by a public value is local to every party
+      key = spu::kernel::hlo::Mul(
+          hctx, key,
+          spu::kernel::hlo::Constant(hctx, static_cast<int64_t>(1) << shift,
+                                     key.shape()));
+    }
+    packed = i == begin ? key : spu::kernel::hlo::Add(hctx, packed, key);
+  }
+  return packed;
+}
+
+}  // namespace
+
+std::vector<spu::Value> PackKeys(spu::HalContext* hctx,
+                                 const std::vector<spu::Value>& keys,
+                                 const std::vector<int64_t>& key_bits) {
+  if (keys.size() < 2 || key_bits.size() != keys.size()) {
+    return keys;
+  }
+  // the highest bit is left as sign, so that Less/Greater of two composite
+  // values, which checks the sign of their difference, still works.
+  const int64_t max_bits =
+      std::min<int64_t>(spu::SizeOf(hctx->getField()) * 8 - 1, 63);
+  auto packable = [&](size_t i) {
+    return !keys[i].isFxp() && key_bits[i] > 0 && key_bits[i] <= max_bits;
+  };
+
+  std::vector<spu::Value> result;
+  size_t i = 0;
+  while (i < keys.size()) {
+    if (!packable(i)) {
+      result.push_back(keys[i++]);
+      continue;
+    }
+    // extend the run while bits still fit in the ring
+    size_t end = i + 1;
+    int64_t total_bits = key_bits[i];
+    while (end < keys.size() && packable(end) &&
+           total_bits + key_bits[end] <= max_bits) {
+      total_bits += key_bits[end++];
+    }
+    if (end - i == 1) {
+      result.push_back(keys[i]);
+    } else {
+      result.push_back(PackRun(hctx, keys, key_bits, i, end, total_bits));
+    }
+    i = end;
+  }
+  return result;
+}
+
+}  // namespace scql::engine::util
@@ -0,0 +1,46 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <vector>
+
+#include "libspu/kernel/context.h"
+#include "libspu/kernel/value.h"
+
+namespace scql::engine::util {
+
+/// @brief pack integer keys into composite values by local multiplies with
+/// public powers of two and adds, the first key of a run takes the highest
+/// bits. So comparing or checking equality of composite values is the same
+/// as doing it on the packed keys lexicographically, but costs only one
+/// secret comparison.
+///
+/// Every run of at least two adjacent keys with known bits is packed in
+/// place, so keys keep their lexicographic order. A run is split when its
+/// total bits exceed the ring (one bit is reserved for the sign of
+/// comparisons).
+///
+/// Requirements:
+/// values of keys[i] should be in [0, 2^key_bits[i]), which is not checked
+/// since keys are secret. key_bits[i] <= 0 means bits of keys[i] are unknown.
+///
+/// @returns keys with packed runs, @param[in] keys as is if
+/// @param[in] key_bits mismatches keys or nothing could be packed. Fixed-point
+/// keys are never packed.
+std::vector<spu::Value> PackKeys(spu::HalContext* hctx,
+                                 const std::vector<spu::Value>& keys,
+                                 const std::vector<int64_t>& key_bits);
+
+}  // namespace scql::engine::util
@@ -45,6 +45,27 @@ class CopyToProtoVistor {
     return arrow::Status::OK();
   }
 
+  // NOTE: dictionary-encoded strings are decoded, pb::Tensor has no
+  // dictionary representation.
+  arrow::Status Visit(const arrow::DictionaryArray& array) {
+    if (array.dictionary()->type_id() != arrow::Type::STRING) {
+      return arrow::Status::NotImplemented(fmt::format(
+          "dictionary of type {} is not implemented in CopyToProtoVistor",
+          array.dictionary()->type()->ToString()));
+    }
+    const auto& dict =
+        static_cast<const arrow::StringArray&>(*array.dictionary());
+    auto ss = to_proto_->mutable_ss();
+    for (int64_t i = 0; i < array.length(); i++) {
+      if (array.IsNull(i)) {
+        ss->add_ss("");
+      } else {
+        ss->add_ss(dict.GetString(array.GetValueIndex(i)));
+      }
+    }
+    return arrow::Status::OK();
+  }
+
   arrow::Status Visit(const arrow::BooleanArray& array) {
     auto bs = to_proto_->mutable_bs();
     for (int64_t i = 0; i < array.length(); i++) {
@@ -0,0 +1,65 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "engine/util/dictionary_util.h"
+
+#include "arrow/array/array_dict.h"
+#include "arrow/compute/api.h"
+
+#include "engine/core/arrow_helper.h"
+
+namespace scql::engine::util {
+
+TensorPtr DictionaryEncode(const TensorPtr& tensor) {
+  if (tensor->IsDictionaryEncoded()) {
+    return std::make_shared<Tensor>(
+        UnifyDictionaries(tensor->ToArrowChunkedArray()));
+  }
+  YACL_ENFORCE(tensor->Type() == pb::PrimitiveDataType::STRING,
+               "only string tensor could be dictionary-encoded, but got {}",
+               pb::PrimitiveDataType_Name(tensor->Type()));
+
+  arrow::Datum result;
+  ASSIGN_OR_THROW_ARROW_STATUS(
+      result, arrow::compute::DictionaryEncode(tensor->ToArrowChunkedArray()));
+  return std::make_shared<Tensor>(
+      UnifyDictionaries(result.chunked_array()));
+}
+
+TensorPtr DictionaryDecode(const TensorPtr& tensor) {
+  if (!tensor->IsDictionaryEncoded()) {
+    return tensor;
+  }
+  const auto& dict_type = static_cast<const arrow::DictionaryType&>(
+      *tensor->ToArrowChunkedArray()->type());
+
+  arrow::Datum result;
+  ASSIGN_OR_THROW_ARROW_STATUS(
+      result, arrow::compute::Cast(tensor->ToArrowChunkedArray(),
+                                   dict_type.value_type()));
+  return std::make_shared<Tensor>(result.chunked_array());
+}
+
+std::shared_ptr<arrow::ChunkedArray> UnifyDictionaries(
+    const std::shared_ptr<arrow::ChunkedArray>& chunked_arr) {
+  // NOTE: it returns chunked_arr itself if all chunks already share the same
+  // dictionary.
+  std::shared_ptr<arrow::ChunkedArray> result;
+  ASSIGN_OR_THROW_ARROW_STATUS(
+      result, arrow::DictionaryUnifier::UnifyChunkedArray(chunked_arr));
+  return result;
+}
+
+}  // namespace scql::engine::util
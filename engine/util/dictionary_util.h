@@ -0,0 +1,38 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "arrow/chunked_array.h"
+
+#include "engine/core/tensor.h"
+
+namespace scql::engine::util {
+
+/// @brief dictionary-encode a string tensor, all chunks of the result share
+/// one dictionary. Tensor which is already encoded only gets its chunks'
+/// dictionaries unified.
+TensorPtr DictionaryEncode(const TensorPtr& tensor);
+
+/// @returns plain tensor decoded from dictionary, or @param[in] tensor itself
+/// if it is not dictionary-encoded.
+TensorPtr DictionaryDecode(const TensorPtr& tensor);
+
+/// @brief make all chunks of dictionary-encoded @param[in] chunked_arr share
+/// the same dictionary, indices are remapped if needed.
+std::shared_ptr<arrow::ChunkedArray> UnifyDictionaries(
+    const std::shared_ptr<arrow::ChunkedArray>& chunked_arr);
+
+}  // namespace scql::engine::util
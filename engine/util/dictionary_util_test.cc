@@ -0,0 +1,64 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "engine/util/dictionary_util.h"
+
+#include "arrow/array/array_dict.h"
+#include "gtest/gtest.h"
+
+#include "engine/core/tensor_from_json.h"
+
+namespace scql::engine::util {
+
+TEST(DictionaryUtilTest, EncodeAndDecode) {
+  // Given
+  auto tensor = TensorFromJSON(
+      arrow::utf8(),
+      std::vector<std::string>{R"json(["a", "b", null, "a"])json",
+                               R"json(["c", "b"])json"});
+
+  // When
+  auto encoded = DictionaryEncode(tensor);
+
+  // Then
+  EXPECT_TRUE(encoded->IsDictionaryEncoded());
+  EXPECT_EQ(encoded->Type(), pb::PrimitiveDataType::STRING);
+  EXPECT_EQ(encoded->Length(), 6);
+  EXPECT_EQ(encoded->GetNullCount(), 1);
+  auto chunked_arr = encoded->ToArrowChunkedArray();
+  ASSERT_EQ(chunked_arr->num_chunks(), 2);
+  auto dict0 =
+      std::static_pointer_cast<arrow::DictionaryArray>(chunked_arr->chunk(0))
+          ->dictionary();
+  auto dict1 =
+      std::static_pointer_cast<arrow::DictionaryArray>(chunked_arr->chunk(1))
+          ->dictionary();
+  // all chunks share the unified dictionary
+  EXPECT_TRUE(dict0->Equals(dict1));
+  EXPECT_EQ(dict0->length(), 3);
+
+  auto decoded = DictionaryDecode(encoded);
+  EXPECT_FALSE(decoded->IsDictionaryEncoded());
+  EXPECT_TRUE(decoded->ToArrowChunkedArray()->Equals(
+      tensor->ToArrowChunkedArray()));
+}
+
+TEST(DictionaryUtilTest, DecodePlainTensor) {
+  auto tensor = TensorFromJSON(arrow::utf8(), R"json(["x", "y"])json");
+
+  EXPECT_EQ(DictionaryDecode(tensor), tensor);
+}
+
+}  // namespace scql::engine::util
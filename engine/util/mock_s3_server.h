@@ -0,0 +1,187 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include "brpc/server.h"
+#include "fmt/format.h"
+
+#include "engine/util/mock_s3_service.pb.h"
+
+namespace scql::engine::util {
+
+/// @brief MockS3Server is a in-memory S3-compatible server which only
+/// supports multipart upload, head object and list objects, used by tests
+/// instead of a real MinIO.
+class MockS3Server : public pb::MockS3Service {
+ public:
+  /// @returns listen address in form of "127.0.0.1:port"
+  std::string Start() {
+    if (server_.AddService(this, brpc::SERVER_DOESNT_OWN_SERVICE,
+                           "/* => Handle") != 0 ||
+        server_.Start("127.0.0.1:0", nullptr) != 0) {
+      return "";
+    }
+    return butil::endpoint2str(server_.listen_address()).c_str();
+  }
+
+  void Handle(::google::protobuf::RpcController* controller,
+              const pb::HttpRequest*, pb::HttpResponse*,
+              ::google::protobuf::Closure* done) override {
+    brpc::ClosureGuard done_guard(done);
+    auto* cntl = static_cast<brpc::Controller*>(controller);
+    const auto& uri = cntl->http_request().uri();
+    const auto* auth = cntl->http_request().GetHeader("Authorization");
+    if (auth == nullptr || auth->rfind("AWS4-HMAC-SHA256 Credential=", 0) != 0) {
+      cntl->http_response().set_status_code(brpc::HTTP_STATUS_FORBIDDEN);
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(mu_);
+    const auto method = cntl->http_request().method();
+    const auto* upload_id = uri.GetQuery("uploadId");
+    if (method == brpc::HTTP_METHOD_HEAD) {
+      if (objects_.count(uri.path()) == 0) {
+        cntl->http_response().set_status_code(brpc::HTTP_STATUS_NOT_FOUND);
+      }
+      return;
+    }
+    if (method == brpc::HTTP_METHOD_GET && uri.GetQuery("list-type")) {
+      const auto* prefix = uri.GetQuery("prefix");
+      ListObjects(uri.path(), prefix == nullptr ? "" : *prefix, cntl);
+      return;
+    }
+    if (method == brpc::HTTP_METHOD_POST && uri.GetQuery("uploads")) {
+      auto id = std::to_string(next_upload_id_++);
+      uploads_[id] = {uri.path(), {}};
+      cntl->response_attachment().append(fmt::format(
+          "<InitiateMultipartUploadResult><UploadId>{}</UploadId>"
+          "</InitiateMultipartUploadResult>",
+          id));
+      return;
+    }
+    if (upload_id == nullptr || uploads_.count(*upload_id) == 0) {
+      cntl->http_response().set_status_code(brpc::HTTP_STATUS_NOT_FOUND);
+      return;
+    }
+    auto& upload = uploads_[*upload_id];
+    if (method == brpc::HTTP_METHOD_PUT) {
+      int part_number = std::stoi(*uri.GetQuery("partNumber"));
+      upload.parts[part_number] = cntl->request_attachment().to_string();
+      ++num_parts_;
+      cntl->http_response().SetHeader("ETag",
+                                      fmt::format("\"etag-{}\"", part_number));
+    } else if (method == brpc::HTTP_METHOD_POST) {
+      // every uploaded part should be listed with its etag.
+      auto body = cntl->request_attachment().to_string();
+      std::string object;
+      for (const auto& [part_number, data] : upload.parts) {
+        if (body.find(fmt::format("<PartNumber>{}</PartNumber>",
+                                  part_number)) == std::string::npos ||
+            body.find(fmt::format("etag-{}", part_number)) ==
+                std::string::npos) {
+          cntl->response_attachment().append(
+              "<Error><Code>InvalidPart</Code></Error>");
+          return;
+        }
+        object.append(data);
+      }
+      objects_[upload.path] = std::move(object);
+      uploads_.erase(*upload_id);
+      cntl->response_attachment().append(
+          "<CompleteMultipartUploadResult></CompleteMultipartUploadResult>");
+    } else if (method == brpc::HTTP_METHOD_DELETE) {
+      uploads_.erase(*upload_id);
+      ++num_aborted_;
+      cntl->http_response().set_status_code(brpc::HTTP_STATUS_NO_CONTENT);
+    } else {
+      cntl->http_response().set_status_code(
+          brpc::HTTP_STATUS_METHOD_NOT_ALLOWED);
+    }
+  }
+
+  /// @brief put object with @param[in] content in @param[in] path
+  /// "/bucket/key" directly.
+  void PutObject(const std::string& path, const std::string& content) {
+    std::lock_guard<std::mutex> lock(mu_);
+    objects_[path] = content;
+  }
+
+  /// @returns content of completed object in @param[in] path "/bucket/key"
+  std::optional<std::string> GetObject(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto iter = objects_.find(path);
+    if (iter == objects_.end()) {
+      return std::nullopt;
+    }
+    return iter->second;
+  }
+
+  size_t NumObjects() {
+    std::lock_guard<std::mutex> lock(mu_);
+    return objects_.size();
+  }
+
+  size_t NumParts() {
+    std::lock_guard<std::mutex> lock(mu_);
+    return num_parts_;
+  }
+
+  size_t NumAborted() {
+    std::lock_guard<std::mutex> lock(mu_);
+    return num_aborted_;
+  }
+
+ private:
+  // list objects in @param[in] bucket_path "/bucket" whose keys start with
+  // @param[in] prefix, pagination is not supported.
+  void ListObjects(const std::string& bucket_path, const std::string& prefix,
+                   brpc::Controller* cntl) {
+    std::string contents;
+    size_t count = 0;
+    const std::string path_prefix = bucket_path + "/" + prefix;
+    for (const auto& [path, content] : objects_) {
+      if (path.rfind(path_prefix, 0) == 0) {
+        contents.append(
+            fmt::format("<Contents><Key>{}</Key><Size>{}</Size></Contents>",
+                        path.substr(bucket_path.size() + 1), content.size()));
+        ++count;
+      }
+    }
+    cntl->response_attachment().append(fmt::format(
+        "<ListBucketResult><Prefix>{}</Prefix><KeyCount>{}</KeyCount>"
+        "<IsTruncated>false</IsTruncated>{}</ListBucketResult>",
+        prefix, count, contents));
+  }
+
+  struct Upload {
+    std::string path;
+    std::map<int, std::string> parts;
+  };
+
+  brpc::Server server_;
+  std::mutex mu_;
+  int64_t next_upload_id_ = 1;
+  std::map<std::string, Upload> uploads_;
+  std::map<std::string, std::string> objects_;
+  size_t num_parts_ = 0;
+  size_t num_aborted_ = 0;
+};
+
+}  // namespace scql::engine::util
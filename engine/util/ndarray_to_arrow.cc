@@ -17,12 +17,11 @@
 #include "arrow/array/util.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
-#include "arrow/util/bitmap_generate.h"
 #include "arrow/visit_type_inline.h"
-#include "libspu/core/xt_helper.h"
 
 #include "engine/core/arrow_helper.h"
 #include "engine/core/type.h"
+#include "engine/util/bit_kernels.h"
 
 namespace scql::engine::util {
 
@@ -63,23 +62,24 @@ class NdArrayConverter {
   /// returns -1 if @param[in] validity is invalid
   static int64_t ValidityToBitmap(const spu::NdArrayRef* validity,
                                   int64_t length, uint8_t* bitmap) {
-    int64_t null_count = 0;
-    try {
-      auto xt_validity = spu::xt_adapt<uint8_t>(*validity);
-      for (int64_t i = 0; i < length; ++i) {
-        if (xt_validity[i]) {
-          arrow::bit_util::SetBit(bitmap, i);
-        } else {
-          ++null_count;
-          arrow::bit_util::ClearBit(bitmap, i);
-        }
-      }
-    } catch (...) {
+    if (validity->numel() != length || validity->elsize() != 1) {
       // invalid validity
       return -1;
     }
+    if (length == 0) {
+      return 0;
+    }
+
+    const auto* bytes = static_cast<const uint8_t*>(validity->data());
+    yacl::Buffer gathered;
+    if (length > 1 && validity->strides()[0] != 1) {
+      gathered = yacl::Buffer(length);
+      StridedGather(bytes, validity->strides()[0], 1, length,
+                    gathered.data<uint8_t>());
+      bytes = gathered.data<uint8_t>();
+    }
 
-    return null_count;
+    return length - PackBits(bytes, length, bitmap);
   }
 
   arrow::Status InitNullBitmap() {
@@ -94,28 +94,34 @@ class NdArrayConverter {
 
   template <typename ArrowType>
   arrow::Status ConvertData(std::shared_ptr<arrow::Buffer>* data) {
+    const auto* values = static_cast<const uint8_t*>(arr_.data());
+    const int64_t elsize = arr_.elsize();
+
+    std::shared_ptr<arrow::Buffer> gathered;
     // strides only make sense when numel > 1
     if (arr_.numel() > 1 && IsStrided()) {
-      return arrow::Status::NotImplemented(
-          "NdArrayConverter doesn't support strided arrays");
+      ARROW_ASSIGN_OR_RAISE(gathered,
+                            arrow::AllocateBuffer(length_ * elsize, pool_));
+      StridedGather(values, arr_.strides()[0] * elsize, elsize, length_,
+                    gathered->mutable_data());
+      values = gathered->data();
     }
 
     if (pt_type_ == spu::PT_BOOL) {
       int64_t nbytes = arrow::bit_util::BytesForBits(length_);
       ARROW_ASSIGN_OR_RAISE(auto buffer, arrow::AllocateBuffer(nbytes, pool_));
 
-      auto xt_values = spu::xt_adapt<bool>(arr_);
-      uint64_t i = 0;
-      const auto generator = [&xt_values, &i]() -> bool {
-        return xt_values[i++];
-      };
-      arrow::internal::GenerateBitsUnrolled(buffer->mutable_data(), 0, length_,
-                                            generator);
+      PackBits(values, length_, buffer->mutable_data());
 
       *data = std::move(buffer);
       return arrow::Status::OK();
     }
 
+    if (gathered != nullptr) {
+      *data = std::move(gathered);
+      return arrow::Status::OK();
+    }
+
     // zero-copy
     *data = std::make_shared<NdArrayRefBuffer>(arr_.buf());
     return arrow::Status::OK();
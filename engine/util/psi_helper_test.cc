@@ -102,6 +102,53 @@ TEST_F(BatchProviderTest, twoKeys) {
   EXPECT_EQ(empty_batch.size(), 0);
 }
 
+TEST_F(BatchProviderTest, dictionaryEncodedKey) {
+  const int64_t seq_len = 28;
+  const int64_t batch_size = 20;
+  StringDictionaryTensorBuilder builder;
+  for (int64_t i = 0; i < seq_len; ++i) {
+    builder.Append(std::string(1, 'a' + (i % 26)));
+  }
+  std::shared_ptr<Tensor> tensor;
+  builder.Finish(&tensor);
+
+  BatchProvider provider(std::vector<TensorPtr>{tensor});
+
+  auto batch1 = provider.ReadNextBatch(batch_size);
+  EXPECT_EQ(batch1.size(), 20);
+  EXPECT_EQ(batch1[0], "a");
+  EXPECT_EQ(batch1[19], "t");
+
+  auto batch2 = provider.ReadNextBatch(batch_size);
+  EXPECT_THAT(batch2, ::testing::ElementsAre("u", "v", "w", "x", "y", "z",
+                                             "a", "b"));
+
+  auto empty_batch = provider.ReadNextBatch(batch_size);
+  EXPECT_EQ(empty_batch.size(), 0);
+}
+
+TEST_F(BatchProviderTest, dictionaryEncodedNullKey) {
+  StringDictionaryTensorBuilder builder;
+  builder.Append("a");
+  builder.AppendNull();
+  builder.Append("b");
+  std::shared_ptr<Tensor> tensor;
+  builder.Finish(&tensor);
+  // all nulls, so the dictionary is empty
+  StringDictionaryTensorBuilder null_builder;
+  null_builder.AppendNull();
+  null_builder.AppendNull();
+  std::shared_ptr<Tensor> null_tensor;
+  null_builder.Finish(&null_tensor);
+
+  BatchProvider provider(std::vector<TensorPtr>{tensor});
+  EXPECT_THAT(provider.ReadNextBatch(10),
+              ::testing::ElementsAre("a", "", "b"));
+  BatchProvider null_provider(std::vector<TensorPtr>{null_tensor});
+  EXPECT_THAT(null_provider.ReadNextBatch(10),
+              ::testing::ElementsAre("", ""));
+}
+
 /// ======================================
 /// Test for JoinCipherStore
 /// ======================================
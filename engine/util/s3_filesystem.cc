@@ -0,0 +1,77 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "engine/util/s3_filesystem.h"
+
+#include <cstdlib>
+#include <mutex>
+
+#include "arrow/filesystem/s3fs.h"
+
+namespace scql::engine::util {
+
+namespace {
+
+constexpr char kS3UriPrefix[] = "s3://";
+
+arrow::Status EnsureS3Initialized() {
+  static std::once_flag flag;
+  static arrow::Status status;
+  std::call_once(flag, [] {
+    arrow::fs::S3GlobalOptions options;
+    options.log_level = arrow::fs::S3LogLevel::Error;
+    status = arrow::fs::InitializeS3(options);
+    if (status.ok()) {
+      // aws sdk should be shut down before static destruction.
+      std::atexit([] { (void)arrow::fs::FinalizeS3(); });
+    }
+  });
+  return status;
+}
+
+}  // namespace
+
+bool ParseS3Uri(const std::string& uri, std::string* bucket,
+                std::string* key) {
+  const std::string prefix(kS3UriPrefix);
+  if (uri.compare(0, prefix.size(), prefix) != 0) {
+    return false;
+  }
+  auto pos = uri.find('/', prefix.size());
+  if (pos == std::string::npos || pos == prefix.size() ||
+      pos + 1 == uri.size()) {
+    return false;
+  }
+  *bucket = uri.substr(prefix.size(), pos - prefix.size());
+  *key = uri.substr(pos + 1);
+  return true;
+}
+
+arrow::Result<std::shared_ptr<arrow::fs::FileSystem>> MakeS3FileSystem(
+    const S3Options& options) {
+  ARROW_RETURN_NOT_OK(EnsureS3Initialized());
+  // requests are signed and retried by aws sdk, whose default strategy only
+  // retries errors known to be retryable.
+  auto s3_options = arrow::fs::S3Options::FromAccessKey(options.access_key,
+                                                        options.secret_key);
+  s3_options.region = options.region;
+  s3_options.endpoint_override = options.endpoint;
+  s3_options.scheme = options.use_ssl ? "https" : "http";
+  // upload parts while the caller is writing the next one.
+  s3_options.background_writes = true;
+  ARROW_ASSIGN_OR_RAISE(auto fs, arrow::fs::S3FileSystem::Make(s3_options));
+  return fs;
+}
+
+}  // namespace scql::engine::util
@@ -0,0 +1,46 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/result.h"
+
+namespace scql::engine::util {
+
+struct S3Options {
+  // host[:port] of the S3-compatible service, e.g. "127.0.0.1:9000"
+  std::string endpoint;
+  std::string access_key;
+  std::string secret_key;
+  std::string region = "us-east-1";
+  bool use_ssl = true;
+};
+
+/// @brief parse @param[in] uri in form of "s3://bucket/key".
+/// @returns false if uri is not a s3 uri.
+bool ParseS3Uri(const std::string& uri, std::string* bucket, std::string* key);
+
+/// @brief make arrow s3 filesystem, whose paths are in form of "bucket/key".
+/// Its output streams write objects by multipart upload, parts are uploaded
+/// in background while caller continues writing.
+/// NOTE: output stream destroyed without Close completes the upload as
+/// arrow's other streams do, call Abort to discard it.
+arrow::Result<std::shared_ptr<arrow::fs::FileSystem>> MakeS3FileSystem(
+    const S3Options& options);
+
+}  // namespace scql::engine::util
@@ -0,0 +1,88 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "engine/util/s3_filesystem.h"
+
+#include "gtest/gtest.h"
+
+#include "engine/util/mock_s3_server.h"
+
+namespace scql::engine::util {
+
+TEST(S3FileSystemTest, ParseS3Uri) {
+  std::string bucket;
+  std::string key;
+  EXPECT_TRUE(ParseS3Uri("s3://bucket/dir/file.csv", &bucket, &key));
+  EXPECT_EQ(bucket, "bucket");
+  EXPECT_EQ(key, "dir/file.csv");
+
+  EXPECT_FALSE(ParseS3Uri("dir/file.csv", &bucket, &key));
+  EXPECT_FALSE(ParseS3Uri("s3://bucket", &bucket, &key));
+  EXPECT_FALSE(ParseS3Uri("s3://bucket/", &bucket, &key));
+  EXPECT_FALSE(ParseS3Uri("s3:///file.csv", &bucket, &key));
+}
+
+class S3FileSystemWriteTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    S3Options options;
+    options.endpoint = server_.Start();
+    ASSERT_FALSE(options.endpoint.empty());
+    options.access_key = "access_key";
+    options.secret_key = "secret_key";
+    options.use_ssl = false;
+    auto fs = MakeS3FileSystem(options);
+    ASSERT_TRUE(fs.ok()) << fs.status().ToString();
+    fs_ = *fs;
+  }
+
+  MockS3Server server_;
+  std::shared_ptr<arrow::fs::FileSystem> fs_;
+};
+
+TEST_F(S3FileSystemWriteTest, Works) {
+  // Given
+  std::string data(4500, 'x');
+  auto stream = fs_->OpenOutputStream("bucket/dir/obj");
+  ASSERT_TRUE(stream.ok()) << stream.status().ToString();
+
+  // When
+  ASSERT_TRUE((*stream)->Write(data.data(), data.size()).ok());
+  ASSERT_TRUE((*stream)->Close().ok());
+
+  // Then
+  EXPECT_EQ(server_.GetObject("/bucket/dir/obj"), data);
+  auto info = fs_->GetFileInfo("bucket/dir/obj");
+  ASSERT_TRUE(info.ok()) << info.status().ToString();
+  EXPECT_EQ(info->type(), arrow::fs::FileType::File);
+}
+
+TEST_F(S3FileSystemWriteTest, NotFound) {
+  auto info = fs_->GetFileInfo("bucket/dir/not_exist");
+  ASSERT_TRUE(info.ok()) << info.status().ToString();
+  EXPECT_EQ(info->type(), arrow::fs::FileType::NotFound);
+}
+
+TEST_F(S3FileSystemWriteTest, Abort) {
+  auto stream = fs_->OpenOutputStream("bucket/obj");
+  ASSERT_TRUE(stream.ok()) << stream.status().ToString();
+  std::string data(2500, 'x');
+  ASSERT_TRUE((*stream)->Write(data.data(), data.size()).ok());
+  ASSERT_TRUE((*stream)->Abort().ok());
+
+  EXPECT_EQ(server_.NumAborted(), 1);
+  EXPECT_EQ(server_.NumObjects(), 0);
+}
+
+}  // namespace scql::engine::util
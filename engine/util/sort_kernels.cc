@@ -0,0 +1,288 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "engine/util/sort_kernels.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#include "arrow/array/concatenate.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/api.h"
+#include "arrow/type_traits.h"
+#include "yacl/base/exception.h"
+#include "yacl/utils/parallel.h"
+
+#include "engine/core/arrow_helper.h"
+
+namespace scql::engine::util {
+
+namespace {
+
+constexpr int64_t kEncodeGrainSize = 1 << 14;
+// runs shorter than it are not worth a thread.
+constexpr int64_t kMinRunLength = 1 << 14;
+
+std::shared_ptr<arrow::Array> Concatenate(const arrow::ChunkedArray& keys) {
+  if (keys.num_chunks() == 1) {
+    return keys.chunk(0);
+  }
+  std::shared_ptr<arrow::Array> arr;
+  if (keys.num_chunks() == 0) {
+    ASSIGN_OR_THROW_ARROW_STATUS(arr, arrow::MakeEmptyArray(keys.type()));
+  } else {
+    ASSIGN_OR_THROW_ARROW_STATUS(arr, arrow::Concatenate(keys.chunks()));
+  }
+  return arr;
+}
+
+// stores @param[in] v most significant byte first, so that memcmp compares it
+// as an unsigned integer.
+template <typename U>
+void StoreBigEndian(U v, uint8_t* out) {
+  for (size_t i = 0; i < sizeof(U); ++i) {
+    out[i] = static_cast<uint8_t>(v >> (8 * (sizeof(U) - 1 - i)));
+  }
+}
+
+// encodes one key column at @param[in] offset of every row, its values are
+// produced by @param[in] encode_value(i, out).
+template <typename EncodeFn>
+void EncodeColumn(const arrow::Array& arr, int64_t value_width, int64_t offset,
+                  NormalizedKeys* keys, EncodeFn&& encode_value) {
+  yacl::parallel_for(
+      0, arr.length(), kEncodeGrainSize, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          uint8_t* out = keys->data.data() + i * keys->width + offset;
+          if (arr.IsNull(i)) {
+            std::memset(out, 0, value_width + 1);
+            continue;
+          }
+          out[0] = 1;
+          encode_value(i, out + 1);
+        }
+      });
+}
+
+template <typename CType>
+void EncodeInteger(const arrow::Array& arr, int64_t offset,
+                   NormalizedKeys* keys) {
+  using UType = std::make_unsigned_t<CType>;
+  const auto* values = arr.data()->GetValues<CType>(1);
+  EncodeColumn(arr, sizeof(CType), offset, keys,
+               [values](int64_t i, uint8_t* out) {
+                 auto u = static_cast<UType>(values[i]);
+                 if constexpr (std::is_signed_v<CType>) {
+                   u ^= UType(1) << (sizeof(CType) * 8 - 1);
+                 }
+                 StoreBigEndian(u, out);
+               });
+}
+
+template <typename CType, typename UType>
+void EncodeFloating(const arrow::Array& arr, int64_t offset,
+                    NormalizedKeys* keys) {
+  static_assert(sizeof(CType) == sizeof(UType));
+  constexpr UType kSignBit = UType(1) << (sizeof(UType) * 8 - 1);
+  const auto* values = arr.data()->GetValues<CType>(1);
+  EncodeColumn(arr, sizeof(CType), offset, keys,
+               [values](int64_t i, uint8_t* out) {
+                 UType u;
+                 std::memcpy(&u, &values[i], sizeof(u));
+                 // negatives are ordered reversely in IEEE 754
+                 u = (u & kSignBit) ? ~u : (u | kSignBit);
+                 StoreBigEndian(u, out);
+               });
+}
+
+void EncodeBoolean(const arrow::Array& arr, int64_t offset,
+                   NormalizedKeys* keys) {
+  const auto& bools = static_cast<const arrow::BooleanArray&>(arr);
+  EncodeColumn(arr, 1, offset, keys, [&bools](int64_t i, uint8_t* out) {
+    out[0] = bools.Value(i) ? 1 : 0;
+  });
+}
+
+// strings have no fixed width, so they are replaced by dense ranks among
+// distinct values of the column.
+template <typename ArrayType>
+void EncodeString(const arrow::Array& arr, int64_t offset,
+                  NormalizedKeys* keys) {
+  const auto& strs = static_cast<const ArrayType&>(arr);
+  std::shared_ptr<arrow::Array> order;
+  ASSIGN_OR_THROW_ARROW_STATUS(order, arrow::compute::SortIndices(arr));
+  const auto* sorted = order->data()->GetValues<uint64_t>(1);
+
+  std::vector<uint64_t> ranks(arr.length(), 0);
+  uint64_t rank = 0;
+  for (int64_t j = 0; j < order->length(); ++j) {
+    // nulls are placed at end
+    if (strs.IsNull(sorted[j])) {
+      break;
+    }
+    if (j > 0 && strs.GetView(sorted[j]) != strs.GetView(sorted[j - 1])) {
+      ++rank;
+    }
+    ranks[sorted[j]] = rank;
+  }
+  EncodeColumn(arr, sizeof(uint64_t), offset, keys,
+               [&ranks](int64_t i, uint8_t* out) {
+                 StoreBigEndian(ranks[i], out);
+               });
+}
+
+// @returns width of value of @param[in] type in normalized rows.
+int64_t ValueWidth(const arrow::DataType& type) {
+  switch (type.id()) {
+    case arrow::Type::BOOL:
+      return 1;
+    case arrow::Type::STRING:
+    case arrow::Type::LARGE_STRING:
+      return sizeof(uint64_t);
+    default:
+      break;
+  }
+  YACL_ENFORCE(arrow::is_integer(type.id()) || arrow::is_floating(type.id()) ||
+                   arrow::is_temporal(type.id()),
+               "unsupported sort key type: {}", type.ToString());
+  return static_cast<const arrow::FixedWidthType&>(type).bit_width() / 8;
+}
+
+void EncodeKey(const arrow::Array& arr, int64_t offset, NormalizedKeys* keys) {
+  switch (arr.type_id()) {
+    case arrow::Type::BOOL:
+      return EncodeBoolean(arr, offset, keys);
+    case arrow::Type::INT8:
+      return EncodeInteger<int8_t>(arr, offset, keys);
+    case arrow::Type::UINT8:
+      return EncodeInteger<uint8_t>(arr, offset, keys);
+    case arrow::Type::INT16:
+      return EncodeInteger<int16_t>(arr, offset, keys);
+    case arrow::Type::UINT16:
+      return EncodeInteger<uint16_t>(arr, offset, keys);
+    case arrow::Type::INT32:
+    case arrow::Type::DATE32:
+    case arrow::Type::TIME32:
+      return EncodeInteger<int32_t>(arr, offset, keys);
+    case arrow::Type::UINT32:
+      return EncodeInteger<uint32_t>(arr, offset, keys);
+    case arrow::Type::INT64:
+    case arrow::Type::DATE64:
+    case arrow::Type::TIME64:
+    case arrow::Type::TIMESTAMP:
+      return EncodeInteger<int64_t>(arr, offset, keys);
+    case arrow::Type::UINT64:
+      return EncodeInteger<uint64_t>(arr, offset, keys);
+    case arrow::Type::FLOAT:
+      return EncodeFloating<float, uint32_t>(arr, offset, keys);
+    case arrow::Type::DOUBLE:
+      return EncodeFloating<double, uint64_t>(arr, offset, keys);
+    case arrow::Type::STRING:
+      return EncodeString<arrow::StringArray>(arr, offset, keys);
+    case arrow::Type::LARGE_STRING:
+      return EncodeString<arrow::LargeStringArray>(arr, offset, keys);
+    default:
+      YACL_THROW("unsupported sort key type: {}", arr.type()->ToString());
+  }
+}
+
+}  // namespace
+
+NormalizedKeys NormalizeSortKeys(
+    const std::vector<std::shared_ptr<arrow::ChunkedArray>>& keys,
+    bool reverse) {
+  YACL_ENFORCE(!keys.empty(), "sort keys should not be empty");
+  NormalizedKeys result;
+  result.length = keys[0]->length();
+  for (const auto& key : keys) {
+    YACL_ENFORCE_EQ(key->length(), result.length,
+                    "sort keys should have the same length");
+    result.width += 1 + ValueWidth(*key->type());
+  }
+  result.data.resize(result.width * result.length);
+
+  int64_t offset = 0;
+  for (const auto& key : keys) {
+    EncodeKey(*Concatenate(*key), offset, &result);
+    offset += 1 + ValueWidth(*key->type());
+  }
+
+  if (reverse) {
+    yacl::parallel_for(0, static_cast<int64_t>(result.data.size()),
+                       kEncodeGrainSize, [&](int64_t begin, int64_t end) {
+                         for (int64_t i = begin; i < end; ++i) {
+                           result.data[i] = ~result.data[i];
+                         }
+                       });
+  }
+  return result;
+}
+
+std::shared_ptr<arrow::Array> SortIndices(
+    const std::vector<std::shared_ptr<arrow::ChunkedArray>>& keys,
+    bool reverse) {
+  const auto rows = NormalizeSortKeys(keys, reverse);
+  const int64_t length = rows.length;
+  const int64_t width = rows.width;
+  const uint8_t* data = rows.data.data();
+  auto less = [data, width](int64_t lhs, int64_t rhs) {
+    return std::memcmp(data + lhs * width, data + rhs * width, width) < 0;
+  };
+
+  std::shared_ptr<arrow::Buffer> buffer;
+  ASSIGN_OR_THROW_ARROW_STATUS(
+      buffer, arrow::AllocateBuffer(length * sizeof(int64_t)));
+  auto* indices = reinterpret_cast<int64_t*>(buffer->mutable_data());
+  for (int64_t i = 0; i < length; ++i) {
+    indices[i] = i;
+  }
+
+  // every thread sorts one run, then runs are merged pairwise in rounds.
+  const int64_t num_runs = std::max<int64_t>(
+      1, std::min<int64_t>(yacl::get_num_threads(), length / kMinRunLength));
+  std::vector<int64_t> bounds(num_runs + 1);
+  for (int64_t i = 0; i <= num_runs; ++i) {
+    bounds[i] = length * i / num_runs;
+  }
+  yacl::parallel_for(0, num_runs, 1, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      std::stable_sort(indices + bounds[i], indices + bounds[i + 1], less);
+    }
+  });
+
+  std::vector<int64_t> scratch(num_runs > 1 ? length : 0);
+  int64_t* src = indices;
+  int64_t* dst = scratch.data();
+  for (int64_t step = 1; step < num_runs; step *= 2) {
+    const int64_t num_merges = (num_runs + 2 * step - 1) / (2 * step);
+    yacl::parallel_for(0, num_merges, 1, [&](int64_t begin, int64_t end) {
+      for (int64_t m = begin; m < end; ++m) {
+        const int64_t lo = bounds[2 * m * step];
+        const int64_t mid = bounds[std::min(2 * m * step + step, num_runs)];
+        const int64_t hi = bounds[std::min(2 * m * step + 2 * step, num_runs)];
+        // std::merge takes from the first run on ties, which keeps it stable
+        std::merge(src + lo, src + mid, src + mid, src + hi, dst + lo, less);
+      }
+    });
+    std::swap(src, dst);
+  }
+  if (src != indices) {
+    std::memcpy(indices, src, length * sizeof(int64_t));
+  }
+
+  return std::make_shared<arrow::Int64Array>(length, std::move(buffer));
+}
+
+}  // namespace scql::engine::util
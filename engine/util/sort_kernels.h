@@ -0,0 +1,57 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/chunked_array.h"
+
+/// Kernels used to sort plaintext rows by multiple keys: keys of one row are
+/// normalized into a fixed-width byte string, so rows are compared by one
+/// memcmp instead of visiting every key column.
+namespace scql::engine::util {
+
+/// @brief rows normalized from sort keys, row i is
+/// data[i * width, (i + 1) * width).
+struct NormalizedKeys {
+  int64_t width = 0;
+  int64_t length = 0;
+  std::vector<uint8_t> data;
+};
+
+/// @brief normalize rows of @param[in] keys so that memcmp order of rows is
+/// the lexicographic order of keys, nulls go first. Each key takes one null
+/// byte followed by its value: integers and floats are stored big-endian with
+/// sign bits fixed, strings are replaced by their dense ranks. All bytes are
+/// flipped if @param[in] reverse, which sorts rows in descending order and
+/// nulls last.
+///
+/// Requirements:
+/// @param[in] keys should not be empty and have the same length, dictionary
+/// keys should be decoded first.
+NormalizedKeys NormalizeSortKeys(
+    const std::vector<std::shared_ptr<arrow::ChunkedArray>>& keys,
+    bool reverse);
+
+/// @returns indices(int64) of rows stably sorted by @param[in] keys, sorted
+/// in parallel by merge sort over normalized rows, see NormalizeSortKeys.
+std::shared_ptr<arrow::Array> SortIndices(
+    const std::vector<std::shared_ptr<arrow::ChunkedArray>>& keys,
+    bool reverse);
+
+}  // namespace scql::engine::util
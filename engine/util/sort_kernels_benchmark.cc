@@ -0,0 +1,108 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <random>
+#include <vector>
+
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api.h"
+#include "arrow/table.h"
+#include "benchmark/benchmark.h"
+
+#include "engine/util/sort_kernels.h"
+
+namespace scql::engine::util {
+namespace {
+
+// keys: (int64 with many duplicates, string, double), payload: int64
+struct SortInput {
+  std::vector<std::shared_ptr<arrow::ChunkedArray>> keys;
+  std::shared_ptr<arrow::ChunkedArray> payload;
+  std::shared_ptr<arrow::Table> key_table;
+};
+
+SortInput MakeInput(int64_t length, int64_t num_keys) {
+  std::mt19937 rng(2023);
+  arrow::Int64Builder k1;
+  arrow::StringBuilder k2;
+  arrow::DoubleBuilder k3;
+  arrow::Int64Builder payload;
+  for (int64_t i = 0; i < length; ++i) {
+    (void)k1.Append(rng() % 1000);
+    (void)k2.Append("str_" + std::to_string(rng() % 10000));
+    (void)k3.Append(static_cast<double>(rng()) / rng.max());
+    (void)payload.Append(i);
+  }
+  std::vector<std::shared_ptr<arrow::ChunkedArray>> all_keys = {
+      std::make_shared<arrow::ChunkedArray>(k1.Finish().ValueOrDie()),
+      std::make_shared<arrow::ChunkedArray>(k2.Finish().ValueOrDie()),
+      std::make_shared<arrow::ChunkedArray>(k3.Finish().ValueOrDie())};
+
+  SortInput input;
+  arrow::FieldVector fields;
+  for (int64_t i = 0; i < num_keys; ++i) {
+    input.keys.push_back(all_keys[i]);
+    fields.push_back(
+        arrow::field("k" + std::to_string(i), all_keys[i]->type()));
+  }
+  input.payload =
+      std::make_shared<arrow::ChunkedArray>(payload.Finish().ValueOrDie());
+  input.key_table = arrow::Table::Make(arrow::schema(fields), input.keys);
+  return input;
+}
+
+// baseline: arrow's multi-key sort, then take
+void BM_ArrowSortIndicesAndTake(benchmark::State& state) {
+  auto input = MakeInput(state.range(0), state.range(1));
+  std::vector<arrow::compute::SortKey> sort_keys;
+  for (const auto& field : input.key_table->schema()->fields()) {
+    sort_keys.emplace_back(field->name());
+  }
+  arrow::compute::SortOptions options(sort_keys);
+  for (auto _ : state) {
+    auto indices = arrow::compute::SortIndices(arrow::Datum(input.key_table),
+                                               options)
+                       .ValueOrDie();
+    auto result = arrow::compute::Take(input.payload, indices).ValueOrDie();
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_NormalizedSortIndicesAndTake(benchmark::State& state) {
+  auto input = MakeInput(state.range(0), state.range(1));
+  for (auto _ : state) {
+    auto indices = SortIndices(input.keys, false);
+    auto result = arrow::compute::Take(input.payload, indices).ValueOrDie();
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+constexpr int64_t kLength = 1 << 20;
+
+BENCHMARK(BM_ArrowSortIndicesAndTake)
+    ->Args({kLength, 1})
+    ->Args({kLength, 2})
+    ->Args({kLength, 3})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_NormalizedSortIndicesAndTake)
+    ->Args({kLength, 1})
+    ->Args({kLength, 2})
+    ->Args({kLength, 3})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace scql::engine::util
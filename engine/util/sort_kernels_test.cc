@@ -0,0 +1,123 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "engine/util/sort_kernels.h"
+
+#include <random>
+
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api.h"
+#include "arrow/table.h"
+#include "gtest/gtest.h"
+
+#include "engine/core/tensor_from_json.h"
+
+namespace scql::engine::util {
+
+namespace {
+
+std::shared_ptr<arrow::ChunkedArray> ChunkedFromJSON(
+    const std::shared_ptr<arrow::DataType>& type,
+    const std::vector<std::string>& json) {
+  return TensorFromJSON(type, json)->ToArrowChunkedArray();
+}
+
+std::shared_ptr<arrow::Array> IndicesFromJSON(const std::string& json) {
+  return ChunkedFromJSON(arrow::int64(), {json})->chunk(0);
+}
+
+}  // namespace
+
+TEST(SortKernelsTest, SingleKey) {
+  // Given
+  auto key = ChunkedFromJSON(arrow::int64(), {"[5, -1, 2]", "[-4, 3]"});
+
+  // When
+  auto ascending = SortIndices({key}, false);
+  auto descending = SortIndices({key}, true);
+
+  // Then
+  EXPECT_TRUE(ascending->Equals(*IndicesFromJSON("[3, 1, 2, 4, 0]")))
+      << ascending->ToString();
+  EXPECT_TRUE(descending->Equals(*IndicesFromJSON("[0, 4, 2, 1, 3]")))
+      << descending->ToString();
+}
+
+TEST(SortKernelsTest, MultipleKeysOfMixedTypes) {
+  // Given
+  auto k1 = ChunkedFromJSON(arrow::utf8(),
+                            {R"json(["b", "a", "b", null, "a", "b"])json"});
+  auto k2 = ChunkedFromJSON(arrow::float64(),
+                            {"[1.5, -0.5, -2.5, 1.0, -0.5, 1.5]"});
+  auto k3 = ChunkedFromJSON(arrow::boolean(),
+                            {"[true, true, false, false, false, false]"});
+
+  // When
+  auto indices = SortIndices({k1, k2, k3}, false);
+  auto reversed = SortIndices({k1, k2, k3}, true);
+
+  // Then
+  // nulls go first, ties of all keys keep their input order
+  EXPECT_TRUE(indices->Equals(*IndicesFromJSON("[3, 4, 1, 2, 5, 0]")))
+      << indices->ToString();
+  EXPECT_TRUE(reversed->Equals(*IndicesFromJSON("[0, 5, 2, 1, 4, 3]")))
+      << reversed->ToString();
+}
+
+TEST(SortKernelsTest, EmptyKey) {
+  auto key = ChunkedFromJSON(arrow::int64(), {"[]"});
+
+  auto indices = SortIndices({key}, false);
+
+  EXPECT_EQ(indices->length(), 0);
+}
+
+TEST(SortKernelsTest, SameAsArrowSortIndices) {
+  // Given
+  // long enough to be sorted in several runs and merged
+  constexpr int64_t kLength = 100000;
+  std::mt19937 rng(2023);
+  arrow::Int32Builder k1_builder;
+  arrow::DoubleBuilder k2_builder;
+  for (int64_t i = 0; i < kLength; ++i) {
+    ASSERT_TRUE(
+        k1_builder.Append(static_cast<int32_t>(rng() % 100) - 50).ok());
+    ASSERT_TRUE(
+        k2_builder.Append(static_cast<double>(rng()) / rng.max()).ok());
+  }
+  auto k1 =
+      std::make_shared<arrow::ChunkedArray>(k1_builder.Finish().ValueOrDie());
+  auto k2 =
+      std::make_shared<arrow::ChunkedArray>(k2_builder.Finish().ValueOrDie());
+  auto table = arrow::Table::Make(
+      arrow::schema({arrow::field("k1", arrow::int32()),
+                     arrow::field("k2", arrow::float64())}),
+      {k1, k2});
+
+  for (bool reverse : {false, true}) {
+    // When
+    auto indices = SortIndices({k1, k2}, reverse);
+
+    // Then
+    auto order = reverse ? arrow::compute::SortOrder::Descending
+                         : arrow::compute::SortOrder::Ascending;
+    arrow::compute::SortOptions options({{"k1", order}, {"k2", order}});
+    auto expected =
+        arrow::compute::SortIndices(arrow::Datum(table), options).ValueOrDie();
+    auto actual = arrow::compute::Cast(*indices, arrow::uint64()).ValueOrDie();
+    EXPECT_TRUE(actual->Equals(*expected)) << "reverse=" << reverse;
+  }
+}
+
+}  // namespace scql::engine::util
@@ -14,20 +14,29 @@
 
 #include "engine/util/spu_io.h"
 
+#include <cstring>
+#include <map>
+
 #include "arrow/array/util.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "libspu/device/io.h"
 #include "libspu/kernel/hal/constants.h"
 #include "libspu/kernel/hal/public_helper.h"
 #include "libspu/kernel/hlo/casting.h"
+#include "libspu/kernel/hlo/geometrical.h"
 
 #include "engine/core/arrow_helper.h"
 #include "engine/core/type.h"
+#include "engine/util/bit_kernels.h"
 #include "engine/util/ndarray_to_arrow.h"
 
 namespace scql::engine::util {
 
 namespace {
 
+constexpr char kChunkSuffix[] = ".chunk.";
+
 struct SpuPtBufferViewConverter {
   void const* data_ptr = nullptr;
 
@@ -60,9 +69,8 @@ struct SpuPtBufferViewConverter {
     owned_data_ = yacl::Buffer(array.length());
     has_owned_data_ = true;
 
-    for (int64_t i = 0; i < array.length(); ++i) {
-      owned_data_.data<bool>()[i] = array.GetView(i);
-    }
+    UnpackBits(array.values()->data(), array.offset(), array.length(),
+               owned_data_.data<uint8_t>());
     data_ptr = owned_data_.data();
     return arrow::Status::OK();
   }
@@ -72,6 +80,22 @@ struct SpuPtBufferViewConverter {
   yacl::Buffer owned_data_;
 };
 
+// Parse gathered shares one by one, the serialized buffer of each share is
+// released right after parsing, so that serialized and parsed shares of the
+// whole tensor are never held at the same time.
+std::vector<spu::Value> ParseShares(std::vector<yacl::Buffer>* buffers) {
+  std::vector<spu::Value> shares;
+  shares.reserve(buffers->size());
+  for (auto& buffer : *buffers) {
+    spu::ValueProto value_proto;
+    YACL_ENFORCE(value_proto.ParseFromArray(buffer.data(), buffer.size()));
+    buffer = yacl::Buffer();
+    shares.push_back(spu::Value::fromProto(value_proto));
+  }
+  buffers->clear();
+  return shares;
+}
+
 }  // namespace
 
 std::shared_ptr<arrow::Array> ConcatenateChunkedArray(
@@ -99,6 +123,11 @@ std::string SpuVarNameEncoder::GetValidityName(const std::string& name) {
   return name + ".validity";
 }
 
+std::string SpuVarNameEncoder::GetChunkName(const std::string& name,
+                                           size_t index) {
+  return fmt::format("{}{}{}", name, kChunkSuffix, index);
+}
+
 SpuInfeedHelper::PtView SpuInfeedHelper::ConvertArrowArrayToPtView(
     const std::shared_ptr<arrow::Array>& array) {
   spu::PtType pt = ArrowDataTypeToSpuPtType(array->type());
@@ -132,30 +161,99 @@ SpuInfeedHelper::PtView SpuInfeedHelper::ConvertArrowArrayToPtView(
   return PtView(value);
 }
 
+#ifdef SCQL_WITH_NULL
+spu::PtBufferView SpuInfeedHelper::ConvertValidityToPtView(
+    const arrow::ChunkedArray& chunked_arr) {
+  const int64_t length = chunked_arr.length();
+  yacl::Buffer bitmap(arrow::bit_util::BytesForBits(length));
+  int64_t offset = 0;
+  for (const auto& chunk : chunked_arr.chunks()) {
+    if (chunk->null_bitmap_data() == nullptr) {
+      arrow::bit_util::SetBitsTo(bitmap.data<uint8_t>(), offset,
+                                 chunk->length(), true);
+    } else {
+      arrow::internal::CopyBitmap(chunk->null_bitmap_data(), chunk->offset(),
+                                  chunk->length(), bitmap.data<uint8_t>(),
+                                  offset);
+    }
+    offset += chunk->length();
+  }
+  auto validity = spu::PtBufferView(bitmap.data(), spu::PT_U8,
+                                    {bitmap.size()}, {1});
+  buffers_.push_back(std::move(bitmap));
+  return validity;
+}
+#endif  // SCQL_WITH_NULL
+
 void SpuInfeedHelper::Sync() {
   cio_->sync();
   // release array refs
   array_refs_.clear();
   // release buffers
   buffers_.clear();
+
+  JoinChunks();
+}
+
+void SpuInfeedHelper::JoinChunks() {
+  auto& symbols = cio_->deviceSymbols();
+  // chunks of every var ordered by index, so all parties join them alike
+  std::map<std::string, std::map<size_t, spu::Value>> chunks;
+  spu::device::SymbolTable joined;
+  for (const auto& kv : symbols) {
+    const auto pos = kv.first.rfind(kChunkSuffix);
+    if (pos == std::string::npos) {
+      joined.setVar(kv.first, kv.second);
+      continue;
+    }
+    const auto index =
+        std::stoull(kv.first.substr(pos + std::strlen(kChunkSuffix)));
+    chunks[kv.first.substr(0, pos)].emplace(index, kv.second);
+  }
+  if (chunks.empty()) {
+    return;
+  }
+
+  for (auto& [name, indexed] : chunks) {
+    std::vector<spu::Value> values;
+    values.reserve(indexed.size());
+    for (auto& kv : indexed) {
+      values.push_back(std::move(kv.second));
+    }
+    // concatenating shares is local, no communication is needed
+    joined.setVar(name, spu::kernel::hlo::Concatenate(hctx_, values, 0));
+  }
+  symbols = std::move(joined);
 }
 
 void SpuInfeedHelper::InfeedTensor(const std::string& name,
                                    const Tensor& tensor,
                                    spu::Visibility vtype) {
-  // FIXME(shunde.csd): rewrite if spu provides streaming io
-  // interface.
-  auto array = ConcatenateChunkedArray(tensor.ToArrowChunkedArray());
-
-  PtView pt_view = ConvertArrowArrayToPtView(array);
-
+  auto chunked_arr = tensor.ToArrowChunkedArray();
   const auto val_name = SpuVarNameEncoder::GetValueName(name);
-  cio_->hostSetVar(val_name, pt_view.value, vtype);
+
+  arrow::ArrayVector chunks;
+  for (const auto& chunk : chunked_arr->chunks()) {
+    if (chunk->length() > 0) {
+      chunks.push_back(chunk);
+    }
+  }
+  if (chunks.size() <= 1) {
+    // zero-copy for numeric types
+    PtView pt_view = ConvertArrowArrayToPtView(
+        chunks.empty() ? ConcatenateChunkedArray(chunked_arr) : chunks[0]);
+    cio_->hostSetVar(val_name, pt_view.value, vtype);
+  } else {
+    // infeed chunk by chunk and join them on the device in Sync, so the
+    // plaintext column is never copied into one contiguous host buffer.
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      cio_->hostSetVar(SpuVarNameEncoder::GetChunkName(val_name, i),
+                       ConvertArrowArrayToPtView(chunks[i]).value, vtype);
+    }
+  }
 #ifdef SCQL_WITH_NULL
   const auto validity_name = SpuVarNameEncoder::GetValidityName(name);
-  // FIXME(shunde.csd): if pt_view.validity.ptr == nullptr, we should allocate
-  // memory for null bitmap and set it with all valid.
-  cio_->hostSetVar(validity_name, pt_view.validity, vtype);
+  cio_->hostSetVar(validity_name, ConvertValidityToPtView(*chunked_arr), vtype);
 #endif  // SCQL_WITH_NULL
 }
 
@@ -185,6 +283,8 @@ TensorPtr SpuOutfeedHelper::RevealTo(const std::string& name, size_t rank) {
   value.toProto().SerializeToString(&value_content);
   auto value_buffers = yacl::link::Gather(
       lctx, yacl::ByteContainerView(value_content), rank, "reveal_value");
+  // release serialized share as soon as it was sent
+  std::string().swap(value_content);
 
 #ifdef SCQL_WITH_NULL
   auto validity_val =
@@ -199,21 +299,9 @@ TensorPtr SpuOutfeedHelper::RevealTo(const std::string& name, size_t rank) {
     return nullptr;
   }
 
-  std::vector<spu::Value> value_shares;
-  for (const auto& buffer : value_buffers) {
-    spu::ValueProto value_proto;
-    YACL_ENFORCE(value_proto.ParseFromArray(buffer.data(), buffer.size()));
-    value_shares.push_back(spu::Value::fromProto(value_proto));
-  }
-  auto arr = io.combineShares(value_shares);
+  auto arr = io.combineShares(ParseShares(&value_buffers));
 #ifdef SCQL_WITH_NULL
-  std::vector<spu::Value> validity_shares;
-  for (const auto& buffer : validity_buffers) {
-    spu::ValueProto value_proto;
-    YACL_ENFORCE(value_proto.ParseFromArray(buffer.data(), buffer.size()));
-    validity_shares.push_back(spu::Value::fromProto(value_proto));
-  }
-  auto validity = io.combineShares(validity_shares);
+  auto validity = io.combineShares(ParseShares(&validity_buffers));
   return std::make_shared<Tensor>(NdArrayToArrow(arr, &validity));
 #else
   return std::make_shared<Tensor>(NdArrayToArrow(arr, nullptr));
@@ -29,12 +29,17 @@ class SpuVarNameEncoder {
  public:
   static std::string GetValueName(const std::string& name);
   static std::string GetValidityName(const std::string& name);
+  /// @brief name of the @param[in] index th chunk of var @param[in] name,
+  /// chunks are infed one by one and joined into var @param[in] name on the
+  /// device.
+  static std::string GetChunkName(const std::string& name, size_t index);
 };
 
 /// @brief helper class for infeeding tensor to SPU device
 class SpuInfeedHelper {
  public:
-  SpuInfeedHelper(spu::device::ColocatedIo* cio) : cio_(cio) {}
+  SpuInfeedHelper(spu::HalContext* hctx, spu::device::ColocatedIo* cio)
+      : hctx_(hctx), cio_(cio) {}
 
   void InfeedTensorAsPublic(const std::string& name, const Tensor& tensor) {
     return InfeedTensor(name, tensor, spu::VIS_PUBLIC);
@@ -44,6 +49,8 @@ class SpuInfeedHelper {
     return InfeedTensor(name, tensor, spu::VIS_SECRET);
   }
 
+  /// @brief sync infed tensors to all parties, tensors of more than one chunk
+  /// are joined on the device after that.
   void Sync();
 
  private:
@@ -67,10 +74,23 @@ class SpuInfeedHelper {
   /// @param[in] array is alive.
   PtView ConvertArrowArrayToPtView(const std::shared_ptr<arrow::Array>& array);
 
+#ifdef SCQL_WITH_NULL
+  /// @brief copy null bitmaps of all chunks into one buffer, bitmaps can't be
+  /// joined on the device since chunks may not end on byte boundaries.
+  spu::PtBufferView ConvertValidityToPtView(
+      const arrow::ChunkedArray& chunked_arr);
+#endif  // SCQL_WITH_NULL
+
+  /// @brief concatenate chunk vars of every tensor in device symbols, it runs
+  /// on all parties since only the owner of a tensor knows how many chunks it
+  /// has before sync.
+  void JoinChunks();
+
   void InfeedTensor(const std::string& name, const Tensor& tensor,
                     spu::Visibility vtype);
 
  private:
+  spu::HalContext* hctx_;
   spu::device::ColocatedIo* cio_;
   // hold a copy of array's shared_ptr to make sure spu::PtBufferView valid
   // until sync() is called.
@@ -59,6 +59,29 @@ class StringifyVisitor {
     return arrow::Status::OK();
   }
 
+  // dictionary is stringified only once and shared by all its slices
+  arrow::Status Visit(const arrow::DictionaryArray& array) {
+    if (array.data()->dictionary != dictionary_) {
+      // reuse strs_ to stringify dictionary values
+      std::vector<std::string> strs;
+      strs.swap(strs_);
+      RETURN_NOT_OK(arrow::VisitArrayInline(*array.dictionary(), this));
+      dictionary_strs_ = std::move(strs_);
+      strs_ = std::move(strs);
+      dictionary_ = array.data()->dictionary;
+    }
+    for (int64_t i = 0; i < array.length(); i++) {
+      // index in null slot is arbitrary and may be out of the dictionary,
+      // emit "" as StringArray does, so a null never matches a real key.
+      if (array.IsNull(i)) {
+        strs_.emplace_back();
+      } else {
+        strs_.push_back(dictionary_strs_[array.GetValueIndex(i)]);
+      }
+    }
+    return arrow::Status::OK();
+  }
+
  private:
   void Stringify(const arrow::Array& array) {
     THROW_IF_ARROW_NOT_OK(arrow::VisitArrayInline(array, this));
@@ -76,6 +99,10 @@ class StringifyVisitor {
 
   // intermediate string representation for elements
   std::vector<std::string> strs_;
+
+  // string representation of current dictionary
+  std::shared_ptr<arrow::ArrayData> dictionary_;
+  std::vector<std::string> dictionary_strs_;
 };
 
 }  // namespace scql::engine::util
\ No newline at end of file
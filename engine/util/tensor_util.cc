@@ -14,11 +14,15 @@
 
 #include "engine/util/tensor_util.h"
 
+#include "arrow/io/memory.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/table.h"
 #include "arrow/visit_array_inline.h"
 #include "yacl/base/exception.h"
 
 #include "engine/core/arrow_helper.h"
 #include "engine/util/copy_to_proto_vistor.h"
+#include "engine/util/dictionary_util.h"
 
 namespace scql::engine::util {
 
@@ -54,6 +58,14 @@ int64_t GetInt64Value(const pb::Tensor& t) {
   return t.i64s().i64s(0);
 }
 
+std::vector<int64_t> GetInt64Values(const pb::Tensor& t) {
+  if (t.option() != pb::TensorOptions::VALUE ||
+      t.value_case() != pb::Tensor::ValueCase::kI64S) {
+    YACL_THROW("tensor does not have int64 values");
+  }
+  return {t.i64s().i64s().begin(), t.i64s().i64s().end()};
+}
+
 void SetStringValues(pb::Tensor* t, const std::vector<std::string>& values) {
   t->set_option(pb::TensorOptions::VALUE);
   t->set_elem_type(pb::PrimitiveDataType::STRING);
@@ -136,4 +148,32 @@ void CopyValuesToProto(const std::shared_ptr<Tensor>& from_tensor,
   }
 }
 
+std::string SerializeToArrowIpc(const std::vector<std::string>& names,
+                                const std::vector<TensorPtr>& tensors) {
+  YACL_ENFORCE(names.size() == tensors.size(),
+               "names size={} and tensors size={} not equal", names.size(),
+               tensors.size());
+  arrow::FieldVector fields;
+  std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    auto chunked_arr = DictionaryDecode(tensors[i])->ToArrowChunkedArray();
+    fields.push_back(arrow::field(names[i], chunked_arr->type()));
+    columns.push_back(std::move(chunked_arr));
+  }
+  auto table = arrow::Table::Make(arrow::schema(fields), columns);
+  THROW_IF_ARROW_NOT_OK(table->Validate());
+
+  std::shared_ptr<arrow::io::BufferOutputStream> sink;
+  ASSIGN_OR_THROW_ARROW_STATUS(sink, arrow::io::BufferOutputStream::Create());
+  std::shared_ptr<arrow::ipc::RecordBatchWriter> writer;
+  ASSIGN_OR_THROW_ARROW_STATUS(
+      writer, arrow::ipc::MakeStreamWriter(sink, table->schema()));
+  THROW_IF_ARROW_NOT_OK(writer->WriteTable(*table));
+  THROW_IF_ARROW_NOT_OK(writer->Close());
+
+  std::shared_ptr<arrow::Buffer> buf;
+  ASSIGN_OR_THROW_ARROW_STATUS(buf, sink->Finish());
+  return buf->ToString();
+}
+
 }  // namespace scql::engine::util
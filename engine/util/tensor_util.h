@@ -31,6 +31,8 @@ void SetStringValues(pb::Tensor* t, const std::vector<std::string>& values);
 
 int64_t GetInt64Value(const pb::Tensor& t);
 
+std::vector<int64_t> GetInt64Values(const pb::Tensor& t);
+
 void SetInt64Values(pb::Tensor* t, const std::vector<int64_t>& values);
 
 bool GetBooleanValue(const pb::Tensor& t);
@@ -58,4 +60,13 @@ bool AreTensorsStatusEqualAndOneOf(
 void CopyValuesToProto(const std::shared_ptr<Tensor>& from_tensor,
                        pb::Tensor* to_proto);
 
+/// @brief serialize tensors as columns of one uncompressed arrow ipc stream,
+/// dictionary-encoded tensors are decoded first.
+///
+/// Requirements:
+/// @param[in] names and @param[in] tensors should have the same size, and all
+/// tensors should have the same length
+std::string SerializeToArrowIpc(const std::vector<std::string>& names,
+                                const std::vector<TensorPtr>& tensors);
+
 }  // namespace scql::engine::util
\ No newline at end of file
@@ -0,0 +1,570 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package executor
+
+import (
+	"encoding/binary"
+	"fmt"
+	"math"
+
+	proto "github.com/secretflow/scql/pkg/proto-gen/scql"
+)
+
+// A minimal reader of the Arrow IPC streaming format, see
+// https://arrow.apache.org/docs/format/Columnar.html#serialization-and-interprocess-communication-ipc
+//
+// It only supports what engine publishes: uncompressed record batches of
+// bool, integer, floating point and utf8 columns without dictionary.
+
+const (
+	ipcContinuationMarker = 0xFFFFFFFF
+
+	// MessageHeader union type
+	ipcHeaderSchema      = 1
+	ipcHeaderRecordBatch = 3
+
+	// Type union type
+	arrowTypeInt           = 2
+	arrowTypeFloatingPoint = 3
+	arrowTypeUtf8          = 5
+	arrowTypeBool          = 6
+
+	arrowPrecisionSingle = 1
+	arrowPrecisionDouble = 2
+)
+
+// fbBuf is a flatbuffers buffer. Reads out of its range return zero and
+// record the first error in err, so a corrupt message fails with an error
+// instead of a panic. Callers check err after parsing a message.
+type fbBuf struct {
+	data []byte
+	err  error
+}
+
+func (b *fbBuf) inRange(off, size int) bool {
+	if b.err != nil {
+		return false
+	}
+	if off < 0 || size < 0 || off > len(b.data)-size {
+		b.err = fmt.Errorf("flatbuffer range [%d, %d) out of buffer size %d", off, off+size, len(b.data))
+		return false
+	}
+	return true
+}
+
+func (b *fbBuf) u8(off int) uint8 {
+	if !b.inRange(off, 1) {
+		return 0
+	}
+	return b.data[off]
+}
+
+func (b *fbBuf) u16(off int) uint16 {
+	if !b.inRange(off, 2) {
+		return 0
+	}
+	return le16(b.data, off)
+}
+
+func (b *fbBuf) u32(off int) uint32 {
+	if !b.inRange(off, 4) {
+		return 0
+	}
+	return le32(b.data, off)
+}
+
+func (b *fbBuf) u64(off int) uint64 {
+	if !b.inRange(off, 8) {
+		return 0
+	}
+	return le64(b.data, off)
+}
+
+// fbTable is a flatbuffers table located at pos of buf
+type fbTable struct {
+	buf *fbBuf
+	pos int
+}
+
+func le16(buf []byte, off int) uint16 { return binary.LittleEndian.Uint16(buf[off:]) }
+func le32(buf []byte, off int) uint32 { return binary.LittleEndian.Uint32(buf[off:]) }
+func le64(buf []byte, off int) uint64 { return binary.LittleEndian.Uint64(buf[off:]) }
+
+// fieldPos returns the position of field slot, or 0 if the field is absent
+func (t fbTable) fieldPos(slot int) int {
+	vtable := t.pos - int(int32(t.buf.u32(t.pos)))
+	entry := 4 + 2*slot
+	if entry >= int(t.buf.u16(vtable)) {
+		return 0
+	}
+	off := int(t.buf.u16(vtable + entry))
+	if off == 0 {
+		return 0
+	}
+	return t.pos + off
+}
+
+func (t fbTable) indirect(pos int) int {
+	return pos + int(t.buf.u32(pos))
+}
+
+func (t fbTable) tableField(slot int) (fbTable, bool) {
+	pos := t.fieldPos(slot)
+	if pos == 0 {
+		return fbTable{}, false
+	}
+	return fbTable{buf: t.buf, pos: t.indirect(pos)}, true
+}
+
+func (t fbTable) uint8Field(slot int) uint8 {
+	pos := t.fieldPos(slot)
+	if pos == 0 {
+		return 0
+	}
+	return t.buf.u8(pos)
+}
+
+func (t fbTable) int16Field(slot int) int16 {
+	pos := t.fieldPos(slot)
+	if pos == 0 {
+		return 0
+	}
+	return int16(t.buf.u16(pos))
+}
+
+func (t fbTable) int32Field(slot int) int32 {
+	pos := t.fieldPos(slot)
+	if pos == 0 {
+		return 0
+	}
+	return int32(t.buf.u32(pos))
+}
+
+func (t fbTable) int64Field(slot int) int64 {
+	pos := t.fieldPos(slot)
+	if pos == 0 {
+		return 0
+	}
+	return int64(t.buf.u64(pos))
+}
+
+func (t fbTable) stringField(slot int) string {
+	pos := t.fieldPos(slot)
+	if pos == 0 {
+		return ""
+	}
+	start := t.indirect(pos)
+	length := int(t.buf.u32(start))
+	if !t.buf.inRange(start+4, length) {
+		return ""
+	}
+	return string(t.buf.data[start+4 : start+4+length])
+}
+
+// vectorField returns the position of the first element and the number of
+// elements, elements of elemSize bytes are checked to be in the buffer
+func (t fbTable) vectorField(slot int, elemSize int) (int, int) {
+	pos := t.fieldPos(slot)
+	if pos == 0 {
+		return 0, 0
+	}
+	start := t.indirect(pos)
+	n := int(t.buf.u32(start))
+	if !t.buf.inRange(start+4, n*elemSize) {
+		return 0, 0
+	}
+	return start + 4, n
+}
+
+func (t fbTable) vectorTable(start int, i int) fbTable {
+	pos := start + 4*i
+	return fbTable{buf: t.buf, pos: t.indirect(pos)}
+}
+
+type arrowColumn struct {
+	name      string
+	typeID    uint8
+	bitWidth  int32
+	signed    bool
+	precision int16
+
+	length int64
+	ss     []string
+	bs     []bool
+	fs     []float32
+	is     []int32
+	i64s   []int64
+}
+
+func (c *arrowColumn) elemType() (proto.PrimitiveDataType, error) {
+	switch c.typeID {
+	case arrowTypeBool:
+		return proto.PrimitiveDataType_BOOL, nil
+	case arrowTypeUtf8:
+		return proto.PrimitiveDataType_STRING, nil
+	case arrowTypeFloatingPoint:
+		switch c.precision {
+		case arrowPrecisionSingle:
+			return proto.PrimitiveDataType_FLOAT, nil
+		case arrowPrecisionDouble:
+			return proto.PrimitiveDataType_DOUBLE, nil
+		}
+	case arrowTypeInt:
+		switch {
+		case c.bitWidth == 8 && c.signed:
+			return proto.PrimitiveDataType_INT8, nil
+		case c.bitWidth == 8:
+			return proto.PrimitiveDataType_UINT8, nil
+		case c.bitWidth == 16 && c.signed:
+			return proto.PrimitiveDataType_INT16, nil
+		case c.bitWidth == 16:
+			return proto.PrimitiveDataType_UINT16, nil
+		case c.bitWidth == 32 && c.signed:
+			return proto.PrimitiveDataType_INT32, nil
+		case c.bitWidth == 32:
+			return proto.PrimitiveDataType_UINT32, nil
+		case c.bitWidth == 64 && c.signed:
+			return proto.PrimitiveDataType_INT64, nil
+		case c.bitWidth == 64:
+			return proto.PrimitiveDataType_UINT64, nil
+		}
+	}
+	return proto.PrimitiveDataType_PrimitiveDataType_UNDEFINED, fmt.Errorf("column %s: unsupported arrow type %d", c.name, c.typeID)
+}
+
+// fitsInt32 keeps the same value layout as engine's tensor proto: int32 and
+// narrower integers are stored in Is, others in I64S.
+func (c *arrowColumn) fitsInt32() bool {
+	return c.bitWidth < 32 || (c.bitWidth == 32 && c.signed)
+}
+
+func (c *arrowColumn) readInt(values []byte, i int) int64 {
+	switch c.bitWidth {
+	case 8:
+		if c.signed {
+			return int64(int8(values[i]))
+		}
+		return int64(values[i])
+	case 16:
+		if c.signed {
+			return int64(int16(le16(values, 2*i)))
+		}
+		return int64(le16(values, 2*i))
+	case 32:
+		if c.signed {
+			return int64(int32(le32(values, 4*i)))
+		}
+		return int64(le32(values, 4*i))
+	default:
+		return int64(le64(values, 8*i))
+	}
+}
+
+func (c *arrowColumn) toTensor() (*proto.Tensor, error) {
+	elemType, err := c.elemType()
+	if err != nil {
+		return nil, err
+	}
+	t := &proto.Tensor{
+		Name: c.name,
+		Shape: &proto.TensorShape{
+			Dim: []*proto.TensorShape_Dimension{
+				{Value: &proto.TensorShape_Dimension_DimValue{DimValue: c.length}},
+				{Value: &proto.TensorShape_Dimension_DimValue{DimValue: 1}},
+			},
+		},
+		ElemType:   elemType,
+		Option:     proto.TensorOptions_VALUE,
+		Annotation: &proto.TensorAnnotation{Status: proto.TensorStatus_TENSORSTATUS_UNKNOWN},
+	}
+	switch c.typeID {
+	case arrowTypeBool:
+		t.Value = &proto.Tensor_Bs{Bs: &proto.Booleans{Bs: c.bs}}
+	case arrowTypeUtf8:
+		t.Value = &proto.Tensor_Ss{Ss: &proto.Strings{Ss: c.ss}}
+	case arrowTypeFloatingPoint:
+		t.Value = &proto.Tensor_Fs{Fs: &proto.Floats{Fs: c.fs}}
+	case arrowTypeInt:
+		if c.fitsInt32() {
+			t.Value = &proto.Tensor_Is{Is: &proto.Int32S{Is: c.is}}
+		} else {
+			t.Value = &proto.Tensor_I64S{I64S: &proto.Int64S{I64S: c.i64s}}
+		}
+	}
+	return t, nil
+}
+
+func parseArrowSchema(schema fbTable) ([]*arrowColumn, error) {
+	start, n := schema.vectorField(1, 4)
+	if schema.buf.err != nil {
+		return nil, schema.buf.err
+	}
+	columns := make([]*arrowColumn, n)
+	for i := 0; i < n; i++ {
+		field := schema.vectorTable(start, i)
+		col := &arrowColumn{
+			name:   field.stringField(0),
+			typeID: field.uint8Field(2),
+		}
+		if field.fieldPos(4) != 0 {
+			return nil, fmt.Errorf("column %s: dictionary-encoded arrow column is not supported", col.name)
+		}
+		typ, ok := field.tableField(3)
+		if !ok {
+			return nil, fmt.Errorf("column %s: arrow type missing", col.name)
+		}
+		switch col.typeID {
+		case arrowTypeInt:
+			col.bitWidth = typ.int32Field(0)
+			col.signed = typ.uint8Field(1) != 0
+		case arrowTypeFloatingPoint:
+			col.precision = typ.int16Field(0)
+		}
+		if schema.buf.err != nil {
+			return nil, schema.buf.err
+		}
+		if _, err := col.elemType(); err != nil {
+			return nil, err
+		}
+		columns[i] = col
+	}
+	return columns, nil
+}
+
+// valueBytes returns the size of the values buffer of length elements of col
+func (c *arrowColumn) valueBytes(length int) int {
+	switch c.typeID {
+	case arrowTypeBool:
+		return (length + 7) / 8
+	case arrowTypeInt:
+		return length * int(c.bitWidth) / 8
+	case arrowTypeFloatingPoint:
+		if c.precision == arrowPrecisionSingle {
+			return 4 * length
+		}
+		return 8 * length
+	default:
+		// offsets of utf8
+		return 4 * (length + 1)
+	}
+}
+
+func appendArrowRecordBatch(batch fbTable, body []byte, columns []*arrowColumn) error {
+	if _, ok := batch.tableField(3); ok {
+		return fmt.Errorf("compressed arrow record batch is not supported")
+	}
+	nodesStart, numNodes := batch.vectorField(1, 16)
+	buffersStart, numBuffers := batch.vectorField(2, 16)
+	if batch.buf.err != nil {
+		return batch.buf.err
+	}
+	if numNodes != len(columns) {
+		return fmt.Errorf("arrow record batch contains %d columns, but schema has %d", numNodes, len(columns))
+	}
+
+	bufferIdx := 0
+	nextBuffer := func() ([]byte, error) {
+		if bufferIdx >= numBuffers {
+			return nil, fmt.Errorf("arrow record batch buffers exhausted")
+		}
+		pos := buffersStart + 16*bufferIdx
+		offset := int64(batch.buf.u64(pos))
+		length := int64(batch.buf.u64(pos + 8))
+		bufferIdx++
+		if offset < 0 || length < 0 || offset > int64(len(body))-length {
+			return nil, fmt.Errorf("arrow buffer [%d, %d) out of body size %d", offset, offset+length, len(body))
+		}
+		return body[offset : offset+length], nil
+	}
+
+	for i, col := range columns {
+		length64 := int64(batch.buf.u64(nodesStart + 16*i))
+		// every column takes at least one bit per row of body
+		if length64 < 0 || length64 > 8*int64(len(body)) {
+			return fmt.Errorf("column %s: arrow record batch length %d out of body size %d", col.name, length64, len(body))
+		}
+		length := int(length64)
+		// skip validity bitmap, null slots keep zero values as tensor proto does
+		if _, err := nextBuffer(); err != nil {
+			return err
+		}
+		values, err := nextBuffer()
+		if err != nil {
+			return err
+		}
+		if len(values) < col.valueBytes(length) {
+			return fmt.Errorf("column %s: arrow values buffer of %d bytes is too short for %d rows", col.name, len(values), length)
+		}
+		switch col.typeID {
+		case arrowTypeBool:
+			for j := 0; j < length; j++ {
+				col.bs = append(col.bs, values[j/8]&(1<<(j%8)) != 0)
+			}
+		case arrowTypeInt:
+			for j := 0; j < length; j++ {
+				if col.fitsInt32() {
+					col.is = append(col.is, int32(col.readInt(values, j)))
+				} else {
+					col.i64s = append(col.i64s, col.readInt(values, j))
+				}
+			}
+		case arrowTypeFloatingPoint:
+			for j := 0; j < length; j++ {
+				if col.precision == arrowPrecisionSingle {
+					col.fs = append(col.fs, math.Float32frombits(le32(values, 4*j)))
+				} else {
+					col.fs = append(col.fs, float32(math.Float64frombits(le64(values, 8*j))))
+				}
+			}
+		case arrowTypeUtf8:
+			data, err := nextBuffer()
+			if err != nil {
+				return err
+			}
+			for j := 0; j < length; j++ {
+				begin, end := le32(values, 4*j), le32(values, 4*(j+1))
+				if begin > end || int64(end) > int64(len(data)) {
+					return fmt.Errorf("column %s: arrow string offsets [%d, %d) out of data size %d", col.name, begin, end, len(data))
+				}
+				col.ss = append(col.ss, string(data[begin:end]))
+			}
+		}
+		col.length += int64(length)
+	}
+	return batch.buf.err
+}
+
+// decodeArrowIPCColumns decodes columns from an arrow ipc stream, each column
+// is returned as a tensor in value option.
+func decodeArrowIPCColumns(data []byte) ([]*proto.Tensor, error) {
+	return decodeArrowIPCPages([][]byte{data})
+}
+
+// decodeArrowIPCPages decodes columns from arrow ipc streams of the same
+// schema, e.g. pages of engine FetchResult, rows of the streams are
+// concatenated in order.
+func decodeArrowIPCPages(pages [][]byte) (tensors []*proto.Tensor, err error) {
+	// offsets are checked while parsing, this only keeps a parser bug from
+	// crashing the caller
+	defer func() {
+		if r := recover(); r != nil {
+			err = fmt.Errorf("malformed arrow ipc stream: %v", r)
+		}
+	}()
+
+	var columns []*arrowColumn
+	for _, data := range pages {
+		columns, err = appendArrowIPCStream(data, columns)
+		if err != nil {
+			return nil, err
+		}
+	}
+
+	for _, col := range columns {
+		t, err := col.toTensor()
+		if err != nil {
+			return nil, err
+		}
+		tensors = append(tensors, t)
+	}
+	return tensors, nil
+}
+
+// appendArrowIPCStream appends record batches of data to columns, which are
+// parsed from the schema of data if they are nil.
+func appendArrowIPCStream(data []byte, columns []*arrowColumn) ([]*arrowColumn, error) {
+	schemaParsed := false
+	pos := 0
+	for pos+4 <= len(data) {
+		size := le32(data, pos)
+		pos += 4
+		if size == ipcContinuationMarker {
+			if pos+4 > len(data) {
+				return nil, fmt.Errorf("arrow ipc stream truncated after continuation marker")
+			}
+			size = le32(data, pos)
+			pos += 4
+		}
+		if size == 0 {
+			// end-of-stream marker
+			break
+		}
+		if int64(size) > int64(len(data)-pos) {
+			return nil, fmt.Errorf("arrow ipc metadata size %d out of stream size %d", size, len(data))
+		}
+		metadata := &fbBuf{data: data[pos : pos+int(size)]}
+		pos += int(size)
+
+		msg := fbTable{buf: metadata, pos: int(metadata.u32(0))}
+		bodyLength := msg.int64Field(3)
+		if metadata.err != nil {
+			return nil, fmt.Errorf("malformed arrow ipc message: %v", metadata.err)
+		}
+		if bodyLength < 0 || bodyLength > int64(len(data)-pos) {
+			return nil, fmt.Errorf("arrow ipc body length %d out of stream size %d", bodyLength, len(data))
+		}
+		body := data[pos : pos+int(bodyLength)]
+		pos += int(bodyLength)
+
+		header, ok := msg.tableField(2)
+		headerType := msg.uint8Field(1)
+		if metadata.err != nil {
+			return nil, fmt.Errorf("malformed arrow ipc message: %v", metadata.err)
+		}
+		if !ok {
+			return nil, fmt.Errorf("arrow ipc message without header")
+		}
+		var err error
+		switch headerType {
+		case ipcHeaderSchema:
+			schemaParsed = true
+			var schema []*arrowColumn
+			schema, err = parseArrowSchema(header)
+			if err == nil {
+				columns, err = mergeArrowSchema(columns, schema)
+			}
+		case ipcHeaderRecordBatch:
+			if !schemaParsed {
+				return nil, fmt.Errorf("arrow ipc record batch arrives before schema")
+			}
+			err = appendArrowRecordBatch(header, body, columns)
+		default:
+			err = fmt.Errorf("unsupported arrow ipc message type %d", headerType)
+		}
+		if err != nil {
+			return nil, err
+		}
+	}
+	return columns, nil
+}
+
+// mergeArrowSchema returns columns if schema matches them, schema if there
+// are no columns yet.
+func mergeArrowSchema(columns []*arrowColumn, schema []*arrowColumn) ([]*arrowColumn, error) {
+	if columns == nil {
+		return schema, nil
+	}
+	if len(columns) != len(schema) {
+		return nil, fmt.Errorf("arrow ipc streams have %d and %d columns", len(columns), len(schema))
+	}
+	for i, col := range columns {
+		other := schema[i]
+		if col.name != other.name || col.typeID != other.typeID || col.bitWidth != other.bitWidth ||
+			col.signed != other.signed || col.precision != other.precision {
+			return nil, fmt.Errorf("column %s of arrow ipc streams mismatches column %s", col.name, other.name)
+		}
+	}
+	return columns, nil
+}
@@ -0,0 +1,118 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package executor
+
+import (
+	"encoding/base64"
+	"strings"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+
+	proto "github.com/secretflow/scql/pkg/proto-gen/scql"
+)
+
+// arrow ipc stream of table {i: int64, s: utf8, b: bool, f: float64} with rows
+// [(1, "a", true, 1.5), (-2, "", false, -2.0), (null, null, true, 0.25)],
+// written in two record batches of at most 2 rows.
+var testArrowIPCStream = strings.Join([]string{
+	"/////wABAAAQAAAAAAAKAAwABgAFAAgACgAAAAABBAAMAAAACAAIAAAABAAIAAAABAAAAAQA",
+	"AACYAAAAXAAAADQAAAAEAAAAiP///wAAAQMQAAAAGAAAAAQAAAAAAAAAAQAAAGYABgAIAAYA",
+	"BgAAAAAAAgC0////AAABBhAAAAAUAAAABAAAAAAAAAABAAAAYgAAANz////Y////AAABBRAA",
+	"AAAYAAAABAAAAAAAAAABAAAAcwAAAAQABAAEAAAAEAAUAAgABgAHAAwAAAAQABAAAAAAAAEC",
+	"EAAAABwAAAAEAAAAAAAAAAEAAABpAAAACAAMAAgABwAIAAAAAAAAAUAAAAAAAAAA/////ygB",
+	"AAAUAAAAAAAAAAwAFgAGAAUACAAMAAwAAAAAAwQAGAAAAFAAAAAAAAAAAAAKABgADAAEAAgA",
+	"CgAAAKwAAAAQAAAAAgAAAAAAAAAAAAAACQAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABgA",
+	"AAAAAAAAGAAAAAAAAAAAAAAAAAAAABgAAAAAAAAADAAAAAAAAAAoAAAAAAAAAAEAAAAAAAAA",
+	"MAAAAAAAAAAAAAAAAAAAADAAAAAAAAAAAQAAAAAAAAA4AAAAAAAAAAAAAAAAAAAAOAAAAAAA",
+	"AAAYAAAAAAAAAAAAAAAEAAAAAgAAAAAAAAAAAAAAAAAAAAIAAAAAAAAAAAAAAAAAAAACAAAA",
+	"AAAAAAAAAAAAAAAAAgAAAAAAAAAAAAAAAAAAAAEAAAAAAAAA/v////////8AAAAAAAAAAAAA",
+	"AAABAAAAAQAAAAAAAABhAAAAAAAAAAUAAAAAAAAAAAAAAAAA+D8AAAAAAAAAwAAAAAAAANA/",
+	"/////ygBAAAUAAAAAAAAAAwAFgAGAAUACAAMAAwAAAAAAwQAGAAAADAAAAAAAAAAAAAKABgA",
+	"DAAEAAgACgAAAKwAAAAQAAAAAQAAAAAAAAAAAAAACQAAAAAAAAAAAAAAAQAAAAAAAAAIAAAA",
+	"AAAAAAgAAAAAAAAAEAAAAAAAAAABAAAAAAAAABgAAAAAAAAACAAAAAAAAAAgAAAAAAAAAAAA",
+	"AAAAAAAAIAAAAAAAAAAAAAAAAAAAACAAAAAAAAAAAQAAAAAAAAAoAAAAAAAAAAAAAAAAAAAA",
+	"KAAAAAAAAAAIAAAAAAAAAAAAAAAEAAAAAQAAAAAAAAABAAAAAAAAAAEAAAAAAAAAAQAAAAAA",
+	"AAABAAAAAAAAAAAAAAAAAAAAAQAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA",
+	"AAAAAAAAAAAAAAAAAQAAAAAAAAAAAAAAAADQP/////8AAAAA",
+}, "")
+
+func TestDecodeArrowIPCColumns(t *testing.T) {
+	r := require.New(t)
+	data, err := base64.StdEncoding.DecodeString(testArrowIPCStream)
+	r.NoError(err)
+
+	tensors, err := decodeArrowIPCColumns(data)
+	r.NoError(err)
+	r.Equal(4, len(tensors))
+
+	r.Equal("i", tensors[0].GetName())
+	r.Equal(proto.PrimitiveDataType_INT64, tensors[0].GetElemType())
+	r.Equal([]int64{1, -2, 0}, tensors[0].GetI64S().GetI64S())
+	r.Equal(int64(3), tensors[0].GetShape().GetDim()[0].GetDimValue())
+
+	r.Equal("s", tensors[1].GetName())
+	r.Equal(proto.PrimitiveDataType_STRING, tensors[1].GetElemType())
+	r.Equal([]string{"a", "", ""}, tensors[1].GetSs().GetSs())
+
+	r.Equal("b", tensors[2].GetName())
+	r.Equal(proto.PrimitiveDataType_BOOL, tensors[2].GetElemType())
+	r.Equal([]bool{true, false, true}, tensors[2].GetBs().GetBs())
+
+	r.Equal("f", tensors[3].GetName())
+	r.Equal(proto.PrimitiveDataType_DOUBLE, tensors[3].GetElemType())
+	r.Equal([]float32{1.5, -2.0, 0.25}, tensors[3].GetFs().GetFs())
+}
+
+func TestDecodeArrowIPCColumnsMalformed(t *testing.T) {
+	r := require.New(t)
+	data, err := base64.StdEncoding.DecodeString(testArrowIPCStream)
+	r.NoError(err)
+
+	_, err = decodeArrowIPCColumns(data[:len(data)/2])
+	r.Error(err)
+}
+
+func TestAppendArrowIPCStreamCorrupt(t *testing.T) {
+	r := require.New(t)
+	data, err := base64.StdEncoding.DecodeString(testArrowIPCStream)
+	r.NoError(err)
+
+	// call the parser without the recover of decodeArrowIPCPages, so an
+	// unchecked offset fails the test
+	for size := 0; size < len(data); size++ {
+		r.NotPanics(func() { appendArrowIPCStream(data[:size], nil) }, "truncated to %d bytes", size)
+	}
+	for i := range data {
+		for _, b := range []byte{0x00, 0x7F, 0x80, 0xFF} {
+			corrupt := append([]byte{}, data...)
+			corrupt[i] = b
+			r.NotPanics(func() { appendArrowIPCStream(corrupt, nil) }, "byte %d set to %#x", i, b)
+		}
+	}
+}
+
+func TestDecodeArrowIPCPages(t *testing.T) {
+	r := require.New(t)
+	data, err := base64.StdEncoding.DecodeString(testArrowIPCStream)
+	r.NoError(err)
+
+	tensors, err := decodeArrowIPCPages([][]byte{data, data})
+	r.NoError(err)
+	r.Equal(4, len(tensors))
+	r.Equal([]int64{1, -2, 0, 1, -2, 0}, tensors[0].GetI64S().GetI64S())
+	r.Equal(int64(6), tensors[0].GetShape().GetDim()[0].GetDimValue())
+	r.Equal([]string{"a", "", "", "a", "", ""}, tensors[1].GetSs().GetSs())
+}
@@ -138,7 +138,11 @@ func (e *AsyncExecutor) MergeQueryResults() (*enginePb.SCDBQueryResultResponse,
 				return nil, fmt.Errorf("affected rows not matched, received affectedRows=%v, req.NumRowsAffected=%v", affectedRows, req.GetNumRowsAffected())
 			}
 		}
-		for _, col := range req.GetOutColumns() {
+		cols, err := decodeOutColumns(req.GetOutColumns(), req.GetOutColumnsArrowIpc())
+		if err != nil {
+			return nil, err
+		}
+		for _, col := range cols {
 			if _, err := find(e.OutputNames, col.GetName()); err == nil {
 				outCols = append(outCols, col)
 			}
@@ -40,6 +40,7 @@ const (
 	endSessionPath       = "/SCQLEngineService/StopSession"
 	runDagPath           = "/SCQLEngineService/RunDag"
 	runExecutionPlanPath = "/SCQLEngineService/RunExecutionPlan"
+	fetchResultPath      = "/SCQLEngineService/FetchResult"
 )
 
 //go:generate mockgen -source engine_stub.go -destination engine_stub_mock.go -package executor
@@ -92,6 +93,10 @@ type EngineStub struct {
 	webClient       EngineClient
 	protocol        string
 	contentType     string
+	arrowIPCResult  bool
+	// rows of each page to fetch result of execution plan, result is returned
+	// by RunExecutionPlan if it is not positive.
+	resultPageRows int64
 }
 
 // NewEngineStub creates an engine stub instance
@@ -100,7 +105,9 @@ func NewEngineStub(sessionID string,
 	callBackUri string,
 	client EngineClient,
 	engineProtocol string,
-	contentType string) *EngineStub {
+	contentType string,
+	arrowIPCResult bool,
+	resultPageRows int64) *EngineStub {
 	scheme := strings.SplitN(engineProtocol, ":", 2)[0]
 	if scheme == "" {
 		scheme = "http"
@@ -112,6 +119,8 @@ func NewEngineStub(sessionID string,
 		webClient:       client,
 		protocol:        scheme,
 		contentType:     contentType,
+		arrowIPCResult:  arrowIPCResult,
+		resultPageRows:  resultPageRows,
 	}
 }
 
@@ -144,11 +153,12 @@ func (stub *EngineStub) runSubDAGCore(ctx context.Context, subDAG map[string]*op
 	var dagIDs []int
 	for code, partySubDAG := range subDAG {
 		pb := &enginePb.RunDagRequest{
-			Nodes:        make([]*enginePb.ExecNode, 0),
-			DagId:        int32(id),
-			SessionId:    stub.executionPlanID,
-			CallbackHost: stub.callBackHost,
-			CallbackUri:  stub.callBackUri,
+			Nodes:          make([]*enginePb.ExecNode, 0),
+			DagId:          int32(id),
+			SessionId:      stub.executionPlanID,
+			CallbackHost:   stub.callBackHost,
+			CallbackUri:    stub.callBackUri,
+			ArrowIpcResult: stub.arrowIPCResult,
 		}
 		for _, node := range partySubDAG.Nodes {
 			pb.Nodes = append(pb.Nodes, node.ToProto())
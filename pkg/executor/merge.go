@@ -62,3 +62,13 @@ func mergeStringTensorsToFirstTensor(tensors []*proto.Tensor) error {
 
 	return nil
 }
+
+// decodeOutColumns returns output columns of an engine response. If engine
+// encoded them as one arrow ipc stream, they are decoded from arrowIPC,
+// otherwise outColumns is returned as it is.
+func decodeOutColumns(outColumns []*proto.Tensor, arrowIPC []byte) ([]*proto.Tensor, error) {
+	if len(arrowIPC) == 0 {
+		return outColumns, nil
+	}
+	return decodeArrowIPCColumns(arrowIPC)
+}
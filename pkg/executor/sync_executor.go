@@ -43,6 +43,7 @@ type SyncExecutor struct {
 }
 
 type ResponseInfo struct {
+	PartyCode    string
 	ResponseBody string
 	Err          error
 }
@@ -109,6 +110,9 @@ func (executor *SyncExecutor) RunExecutionPlanCore(ctx context.Context) (string,
 	var partyCredentials []string
 	for partyCode, pb := range executor.ExecutionPlans {
 		partyCodes = append(partyCodes, partyCode)
+		pb.ArrowIpcResult = executor.EngineStub.arrowIPCResult
+		// engine keeps result in session until it is fetched in pages.
+		pb.ResultCursor = executor.EngineStub.resultPageRows > 0
 		m := protojson.MarshalOptions{UseProtoNames: true}
 		body, err := m.Marshal(pb)
 		if err != nil {
@@ -143,6 +147,7 @@ func (executor *SyncExecutor) RunExecutionPlanCore(ctx context.Context) (string,
 				logrus.Infof("%v|PartyCode:%v|Url:%v", logEntry, partyCode, url)
 			}
 			c <- ResponseInfo{
+				PartyCode:    partyCode,
 				ResponseBody: responseBody,
 				Err:          err,
 			}
@@ -169,7 +174,16 @@ func (executor *SyncExecutor) RunExecutionPlanCore(ctx context.Context) (string,
 			}
 			return constant.ReasonInvalidResponse, nil, status.Wrap(scql.Code_UNKNOWN_ENGINE_ERROR, fmt.Errorf(response.GetStatus().GetMessage()))
 		}
-		for _, col := range response.GetOutColumns() {
+		var cols []*scql.Tensor
+		if executor.EngineStub.resultPageRows > 0 {
+			cols, err = executor.fetchResult(ctx, responseInfo.PartyCode, response.GetSessionId())
+		} else {
+			cols, err = decodeOutColumns(response.GetOutColumns(), response.GetOutColumnsArrowIpc())
+		}
+		if err != nil {
+			return constant.ReasonInvalidResponse, nil, err
+		}
+		for _, col := range cols {
 			if _, err := find(executor.OutputNames, col.GetName()); err == nil {
 				outCols = append(outCols, col)
 			}
@@ -195,3 +209,68 @@ func (executor *SyncExecutor) RunExecutionPlanCore(ctx context.Context) (string,
 
 	return "", res, nil
 }
+
+// fetchResult pages through the result kept by engine of partyCode after
+// RunExecutionPlan, and stops the session once all rows are fetched.
+func (executor *SyncExecutor) fetchResult(ctx context.Context, partyCode string, sessionID string) ([]*scql.Tensor, error) {
+	url := url.URL{
+		Scheme: executor.EngineStub.protocol,
+		Host:   executor.PartyCodeToHost[partyCode],
+		Path:   fetchResultPath,
+	}
+	var pages [][]byte
+	var offset int64
+	for {
+		request := &scql.FetchResultRequest{
+			SessionId: sessionID,
+			Offset:    offset,
+			MaxRows:   executor.EngineStub.resultPageRows,
+		}
+		m := protojson.MarshalOptions{UseProtoNames: true}
+		body, err := m.Marshal(request)
+		if err != nil {
+			return nil, err
+		}
+		responseBody, err := executor.EngineStub.webClient.Post(ctx, url.String(), executor.partyCodeToCredential[partyCode],
+			executor.EngineStub.contentType, string(body))
+		if err != nil {
+			return nil, err
+		}
+		response := &scql.FetchResultResponse{}
+		if _, err := message.DeserializeFrom(io.NopCloser(strings.NewReader(responseBody)), response); err != nil {
+			return nil, err
+		}
+		if response.GetStatus().GetCode() != int32(scql.Code_OK) {
+			return nil, status.Wrap(scql.Code_UNKNOWN_ENGINE_ERROR, fmt.Errorf(response.GetStatus().GetMessage()))
+		}
+		pages = append(pages, response.GetOutColumnsArrowIpc())
+		if response.GetExhausted() {
+			break
+		}
+		if response.GetNumRows() <= 0 {
+			return nil, fmt.Errorf("fetch result of party %s: no rows at offset %d of %d", partyCode, offset, response.GetTotalRows())
+		}
+		offset += response.GetNumRows()
+	}
+	executor.stopSession(ctx, partyCode, sessionID)
+	return decodeArrowIPCPages(pages)
+}
+
+// stopSession releases the result kept by engine of partyCode, engine
+// removes the session when result ttl expires if it fails.
+func (executor *SyncExecutor) stopSession(ctx context.Context, partyCode string, sessionID string) {
+	url := url.URL{
+		Scheme: executor.EngineStub.protocol,
+		Host:   executor.PartyCodeToHost[partyCode],
+		Path:   endSessionPath,
+	}
+	m := protojson.MarshalOptions{UseProtoNames: true}
+	body, err := m.Marshal(&scql.StopSessionRequest{SessionId: sessionID})
+	if err == nil {
+		_, err = executor.EngineStub.webClient.Post(ctx, url.String(), executor.partyCodeToCredential[partyCode],
+			executor.EngineStub.contentType, string(body))
+	}
+	if err != nil {
+		logrus.Warnf("stop session %s of party %s after fetching result failed: %v", sessionID, partyCode, err)
+	}
+}
@@ -16,10 +16,13 @@ package executor
 
 import (
 	"context"
+	"encoding/base64"
 	"fmt"
+	"strings"
 	"testing"
 
 	"github.com/stretchr/testify/require"
+	"google.golang.org/protobuf/encoding/protojson"
 
 	"github.com/secretflow/scql/pkg/constant"
 	"github.com/secretflow/scql/pkg/interpreter/optimizer"
@@ -44,6 +47,93 @@ func (client mockWebClient) Post(ctx context.Context, url string, credential str
 	return message.SerializeTo(resp, message.EncodingTypeJson)
 }
 
+// mockPagedWebClient returns the same page of pageRows rows for every
+// FetchResult until all pages are fetched.
+type mockPagedWebClient struct {
+	sessionId string
+	page      []byte
+	pageRows  int64
+	pages     int64
+	// ids of stopped sessions
+	stopped *[]string
+}
+
+func (client mockPagedWebClient) Post(ctx context.Context, url string, credential string, content_type string, body string) (string, error) {
+	if strings.HasSuffix(url, runExecutionPlanPath) {
+		resp := &proto.RunExecutionPlanResponse{
+			Status:    &scql.Status{Code: int32(scql.Code_OK)},
+			SessionId: client.sessionId,
+		}
+		return message.SerializeTo(resp, message.EncodingTypeJson)
+	}
+	if strings.HasSuffix(url, endSessionPath) {
+		request := &proto.StopSessionRequest{}
+		if err := protojson.Unmarshal([]byte(body), request); err != nil {
+			return "", err
+		}
+		*client.stopped = append(*client.stopped, request.GetSessionId())
+		resp := &proto.StopSessionResponse{
+			Status: &scql.Status{Code: int32(scql.Code_OK)},
+		}
+		return message.SerializeTo(resp, message.EncodingTypeJson)
+	}
+	request := &proto.FetchResultRequest{}
+	if err := protojson.Unmarshal([]byte(body), request); err != nil {
+		return "", err
+	}
+	if request.GetSessionId() != client.sessionId || request.GetMaxRows() != client.pageRows {
+		return "", fmt.Errorf("unexpected request %v", request)
+	}
+	resp := &proto.FetchResultResponse{
+		Status:             &scql.Status{Code: int32(scql.Code_OK)},
+		OutColumnsArrowIpc: client.page,
+		NumRows:            client.pageRows,
+		TotalRows:          client.pageRows * client.pages,
+		Exhausted:          request.GetOffset()+client.pageRows >= client.pageRows*client.pages,
+	}
+	return message.SerializeTo(resp, message.EncodingTypeJson)
+}
+
+func TestSyncExecutorFetchResult(t *testing.T) {
+	a := require.New(t)
+	partyInfo, err := translator.NewPartyInfo([]string{"alice"}, []string{"alice.url"}, []string{"alice_credential"})
+	a.NoError(err)
+	page, err := base64.StdEncoding.DecodeString(testArrowIPCStream)
+	a.NoError(err)
+
+	sessionId := "mock"
+	plans := map[string]*scql.RunExecutionPlanRequest{
+		"alice": {
+			SessionParams: &scql.SessionStartParams{
+				SessionId: sessionId,
+				PartyCode: "alice",
+			},
+		},
+	}
+	stub := &EngineStub{
+		protocol:       "http",
+		resultPageRows: 3,
+	}
+	var stopped []string
+	stub.webClient = mockPagedWebClient{
+		sessionId: sessionId,
+		page:      page,
+		pageRows:  3,
+		pages:     2,
+		stopped:   &stopped,
+	}
+
+	executor, err := NewSyncExecutor(plans, []string{"i", "s"}, stub, sessionId, partyInfo)
+	a.NoError(err)
+	resp, err := executor.RunExecutionPlan(context.Background())
+	a.NoError(err)
+	a.True(plans["alice"].GetResultCursor())
+	a.Equal(2, len(resp.OutColumns))
+	a.Equal([]int64{1, -2, 0, 1, -2, 0}, resp.OutColumns[0].GetI64S().GetI64S())
+	a.Equal([]string{"a", "", "", "a", "", ""}, resp.OutColumns[1].GetSs().GetSs())
+	a.Equal([]string{sessionId}, stopped)
+}
+
 func TestSyncExecutor(t *testing.T) {
 	a := require.New(t)
 	partyInfo, err := translator.NewPartyInfo([]string{"alice", "bob"}, []string{"alice.url", "bob.url"}, []string{"alice_credential", "bob_credential"})
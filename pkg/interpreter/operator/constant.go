@@ -66,6 +66,8 @@ const (
 	OpNameObliviousGroupMax   string = "ObliviousGroupMax"
 	OpNameObliviousGroupMin   string = "ObliviousGroupMin"
 	OpNameObliviousGroupAvg   string = "ObliviousGroupAvg"
+	OpNameObliviousGroupAgg   string = "ObliviousGroupAgg"
+	OpNameGroupHeSum          string = "GroupHeSum"
 	OpNameShuffle             string = "Shuffle"
 	// union all
 	OpNameConcat string = "Concat"
@@ -87,8 +89,18 @@ const (
 	ToStatusAttr    = `to_status`
 	FilePathAttr    = `file_path`
 	DeliminatorAttr = `deliminator`
+	FormatAttr      = `format`
 	AxisAttr        = `axis`
 	ReverseAttr     = `reverse`
+
+	// PartitionColumnAttr, PartitionNumAttr used by RunSQL
+	PartitionColumnAttr = `partition_column`
+	PartitionNumAttr    = `partition_num`
+
+	// KeyBitsAttr used by Sort and ObliviousGroupMark
+	KeyBitsAttr = `key_bits`
+	// AggFuncsAttr used by ObliviousGroupAgg
+	AggFuncsAttr = `agg_funcs`
 )
 
 var ReduceAggOp = map[string]string{
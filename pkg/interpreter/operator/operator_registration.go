@@ -74,6 +74,8 @@ func registerAllOpDef() {
 		opDef.AddOutput("Out", "Result tensors of the SQL statement.", proto.FormalParameterOptions_FORMALPARAMETEROPTIONS_VARIADIC, T)
 		opDef.AddAttribute(SqlAttr, "SQL statement")
 		opDef.AddAttribute(TableRefsAttr, "tables referenced by query")
+		opDef.AddAttribute(PartitionColumnAttr, "String. Optional integer output column to split the query by, partitions run concurrently in separate datasource sessions and read no consistent snapshot. The translator doesn't set it, it is for plans built by hand")
+		opDef.AddAttribute(PartitionNumAttr, "Int64. Optional number of partitions when partition_column is set")
 		opDef.SetDefinition("Run a SQL statement and return a list of tensors in private status")
 		opDef.SetParamTypeConstraint(T, statusPrivate)
 		check(opDef.err)
@@ -269,8 +271,9 @@ Out = [{"a", "b", "c"}]
 		opDef.AddOutput("Out", "Tensors have been dumped.",
 			proto.FormalParameterOptions_FORMALPARAMETEROPTIONS_VARIADIC, T)
 		opDef.SetDefinition(`Definition: Dump the input tensor. Note: This op will change the affected rows in the session`)
-		opDef.AddAttribute(FilePathAttr, "String. Absolute file path to dump the tensors.")
+		opDef.AddAttribute(FilePathAttr, "String. Absolute file path to dump the tensors, or `s3://bucket/key` to upload to S3-compatible storage.")
 		opDef.AddAttribute(DeliminatorAttr, "String. Column deliminator, e.g. comma `,`")
+		opDef.AddAttribute(FormatAttr, "String. Optional file format: `csv`(default), `parquet` or `arrow`(Arrow IPC file)")
 		opDef.SetParamTypeConstraint(T, statusPrivate)
 		check(opDef.err)
 		AllOpDef = append(AllOpDef, opDef)
@@ -439,6 +442,7 @@ UniqueKey = {"a", "b", "d"}
 			proto.FormalParameterOptions_FORMALPARAMETEROPTIONS_VARIADIC, T)
 		opDef.AddAttribute(ReverseAttr, "Bool. If True, the sorted tensor in descending order.")
 		opDef.AddDefaultAttributeValue(ReverseAttr, CreateBoolAttribute(false))
+		opDef.AddAttribute(KeyBitsAttr, "Int64s. Optional bits of each key, values of Key[i] should be in [0, 2^key_bits[i]), 0 if unknown. Adjacent secret keys with known bits are packed into one composite key if their total bits fit in the ring")
 		opDef.SetDefinition("Definition: sort `In` using `Key`." + `
 Example:
 ` + "\n```python" + `
@@ -459,6 +463,7 @@ Out = [{1, 2, 3, 4}, {2, 3, 1, 4}, {8, 7, 9, 6}]
 		opDef.AddOutput("Group",
 			"End of group indicator(shape [M][1]). Element 1 means the row is the last element of the group, 0 is not.",
 			proto.FormalParameterOptions_FORMALPARAMETEROPTIONS_SINGLE, T)
+		opDef.AddAttribute(KeyBitsAttr, "Int64s. Optional bits of each key, values of Key[i] should be in [0, 2^key_bits[i]), 0 if unknown. Adjacent keys with known bits are packed into one composite key if their total bits fit in the ring")
 		opDef.SetDefinition("Definition: generate end of group indicator `Group` based on `Key`. The operator calculates Group[i] = not_eq(Key[i+1], Key[i])." + `
 Example:
 ` + "\n```python" + `
@@ -507,6 +512,58 @@ Out = %s
 		}
 	}
 
+	{
+		opDef := &OperatorDef{}
+		opDef.SetName(OpNameObliviousGroupAgg)
+		opDef.AddInput("Group",
+			"End of group indicator(shape [M][1]). Element 1 means the row is the last element of the group, 0 is not.",
+			proto.FormalParameterOptions_FORMALPARAMETEROPTIONS_SINGLE, T)
+		opDef.AddInput("In", "Values to be aggregated (shape [M][1]).",
+			proto.FormalParameterOptions_FORMALPARAMETEROPTIONS_VARIADIC, T)
+		opDef.AddOutput("Out", "Partially aggregated values (shape [M][1]).",
+			proto.FormalParameterOptions_FORMALPARAMETEROPTIONS_VARIADIC, T)
+		opDef.AddAttribute(AggFuncsAttr, "Strings. Aggregation function of each input, one of sum, count, avg, max and min")
+		opDef.SetDefinition("Definition: partially aggregate every `In` by its function in `agg_funcs` according to end of group indicator, all inputs share one oblivious scan." + `
+Example:
+` + "\n```python" + `
+Group = {1, 0, 0, 1, 1}
+In = [{1, 3, 2, 4, 0}, {9, 8, 7, 6, 5}, {9, 8, 7, 6, 5}]
+agg_funcs = ["sum", "max", "count"]
+Out = [{1, 3, 5, 9, 0}, {9, 8, 8, 8, 5}, {1, 1, 2, 3, 1}]
+` + "```\n")
+		opDef.SetParamTypeConstraint(T, statusSecret)
+		check(opDef.err)
+		AllOpDef = append(AllOpDef, opDef)
+	}
+
+	{
+		opDef := &OperatorDef{}
+		opDef.SetName(OpNameGroupHeSum)
+		opDef.AddInput("Key", "Group by keys (shape [M][1]), owned by the first party in `input_party_codes`.",
+			proto.FormalParameterOptions_FORMALPARAMETEROPTIONS_VARIADIC, T)
+		opDef.AddInput("In", "Values to be summed (shape [M][1]), owned by the second party in `input_party_codes`.",
+			proto.FormalParameterOptions_FORMALPARAMETEROPTIONS_VARIADIC, T)
+		opDef.AddOutput("Out", "Sum of each group (shape [G][1]), owned by the key party. Nulls are summed as 0, so a group of nulls sums to 0.",
+			proto.FormalParameterOptions_FORMALPARAMETEROPTIONS_VARIADIC, T)
+		opDef.AddOutput("OutKey", "Keys of each group (shape [G][1]), owned by the key party.",
+			proto.FormalParameterOptions_FORMALPARAMETEROPTIONS_VARIADIC, T)
+		opDef.AddOutput("OutCount", "Number of rows of each group (shape [G][1]), owned by the key party.",
+			proto.FormalParameterOptions_FORMALPARAMETEROPTIONS_SINGLE, T)
+		opDef.AddAttribute(InputPartyCodesAttr, "Strings. The key party and the value party")
+		opDef.SetDefinition("Definition: sum `In` grouped by `Key` with homomorphic encryption, the value party sends encrypted values and the key party adds them up by group, no oblivious sort is needed. Groups are ordered by their first appearance." + `
+Example:
+` + "\n```python" + `
+Key = [{"a", "b", "a", "c"}]
+In = [{1, 2, 3, 4}]
+Out = [{4, 2, 4}]
+OutKey = [{"a", "b", "c"}]
+OutCount = {2, 1, 1}
+` + "```\n")
+		opDef.SetParamTypeConstraint(T, statusPrivate)
+		check(opDef.err)
+		AllOpDef = append(AllOpDef, opDef)
+	}
+
 	{
 		opDef := &OperatorDef{}
 		opDef.SetName(OpNameShuffle)
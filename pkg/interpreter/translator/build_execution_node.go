@@ -17,6 +17,8 @@ package translator
 import (
 	"fmt"
 
+	"golang.org/x/exp/slices"
+
 	"github.com/secretflow/scql/pkg/expression"
 	"github.com/secretflow/scql/pkg/expression/aggregation"
 	"github.com/secretflow/scql/pkg/interpreter/ccl"
@@ -363,14 +365,18 @@ func (t *translator) buildSelection(ln *SelectionNode) (err error) {
 			return fmt.Errorf("unsupported tensor status for selection node: %+v", it)
 		}
 	}
-	if len(shareTensors) > 0 {
-		// convert filter to public here, so filter must be visible to all parties
-		publicFilter, err := t.ep.addTensorStatusConversion(filter, &publicPlacement{partyCodes: t.enginesInfo.partyInfo.GetParties()})
-		if err != nil {
-			return fmt.Errorf("buildSelection: %v", err)
+	// private tensors whose owner can't see the filter are filtered as shares
+	for _, p := range sliceutil.SortMapKeyForDeterminism(privateTensorsMap) {
+		if t.revealShuffledFilter && !filter.cc.IsVisibleFor(p) {
+			shareTensors = append(shareTensors, privateTensorsMap[p]...)
+			shareIds = append(shareIds, privateIdsMap[p]...)
+			delete(privateTensorsMap, p)
+			delete(privateIdsMap, p)
 		}
+	}
+	if len(shareTensors) > 0 {
 		// handling share tensors here
-		output, err := t.ep.AddFilterNode("apply_filter", shareTensors, publicFilter, t.enginesInfo.partyInfo.GetParties())
+		output, err := t.addShareFilterNode(filter, shareTensors)
 		if err != nil {
 			return fmt.Errorf("buildSelection: %v", err)
 		}
@@ -562,6 +568,22 @@ func (t *translator) buildAggregation(ln *AggregationNode) (err error) {
 	return nil
 }
 
+// obliviousGroupAggs collects aggregations of one group by, which are
+// fused into one ObliviousGroupAgg node.
+type obliviousGroupAggs struct {
+	funcNames       []string
+	ins             []*Tensor
+	colIds          []int64
+	skipDTypeChecks []bool
+}
+
+func (aggs *obliviousGroupAggs) add(funcName string, in *Tensor, colId int64, skipDTypeCheck bool) {
+	aggs.funcNames = append(aggs.funcNames, funcName)
+	aggs.ins = append(aggs.ins, in)
+	aggs.colIds = append(aggs.colIds, colId)
+	aggs.skipDTypeChecks = append(aggs.skipDTypeChecks, skipDTypeCheck)
+}
+
 func (t *translator) buildObliviousGroupAggregation(ln *AggregationNode) (err error) {
 	agg, ok := ln.lp.(*core.LogicalAggregation)
 	if !ok {
@@ -586,6 +608,9 @@ func (t *translator) buildObliviousGroupAggregation(ln *AggregationNode) (err er
 			t.flagJointPublishString = true
 		}
 	}
+	if keyParty, valueParty, ok := t.heGroupAggParties(ln, keyTs, childColIdToTensor); ok {
+		return t.buildHeGroupAggregation(ln, keyTs, childColIdToTensor, keyParty, valueParty)
+	}
 
 	in := []*Tensor{}
 	in = append(in, keyTs...)
@@ -607,6 +632,8 @@ func (t *translator) buildObliviousGroupAggregation(ln *AggregationNode) (err er
 	}
 	// add agg funcs
 	colIdToTensor := map[int64]*Tensor{}
+	// all oblivious aggregations are fused into one node sharing one scan
+	fusedAggs := obliviousGroupAggs{}
 	for i, aggFunc := range agg.AggFuncs {
 		if len(aggFunc.Args) != 1 {
 			return fmt.Errorf("buildObliviousGroupAggregation: unsupported aggregation function %v", aggFunc)
@@ -627,12 +654,7 @@ func (t *translator) buildObliviousGroupAggregation(ln *AggregationNode) (err er
 			if err != nil {
 				return fmt.Errorf("buildObliviousGroupAggregation: %v", err)
 			}
-			output, err := t.ep.AddObliviousGroupAggNode(aggFunc.Name, groupMark, colT)
-			if err != nil {
-				return fmt.Errorf("buildObliviousGroupAggregation: %v", err)
-			}
-			output.skipDTypeCheck = true
-			colIdToTensor[ln.Schema().Columns[i].UniqueID] = output
+			fusedAggs.add(aggFunc.Name, colT, ln.Schema().Columns[i].UniqueID, true)
 		case ast.AggFuncCount:
 			// NOTE(yang.y): There are two mode for count function.
 			// - The CompleteMode is the default mode in queries like `select count(*) from t`.
@@ -643,7 +665,7 @@ func (t *translator) buildObliviousGroupAggregation(ln *AggregationNode) (err er
 			//   In this mode, count function will be translated to ObliviousGroupSum.
 			// do complete count
 			// sum up partial count
-			var output *Tensor
+			colId := ln.Schema().Columns[i].UniqueID
 			switch aggFunc.Mode {
 			case aggregation.CompleteMode:
 				if aggFunc.HasDistinct {
@@ -667,35 +689,35 @@ func (t *translator) buildObliviousGroupAggregation(ln *AggregationNode) (err er
 					if err != nil {
 						return fmt.Errorf("buildObliviousGroupAggregation: %v", err)
 					}
-					output, err = t.ep.AddObliviousGroupAggNode(ast.AggFuncSum, groupMark, groupMarkDistinct)
-					if err != nil {
-						return fmt.Errorf("buildObliviousGroupAggregation: %v", err)
-					}
+					fusedAggs.add(ast.AggFuncSum, groupMarkDistinct, colId, false)
 				} else {
-					output, err = t.ep.AddObliviousGroupAggNode(ast.AggFuncCount, groupMark, groupMark)
-					if err != nil {
-						return fmt.Errorf("buildObliviousGroupAggregation: %v", err)
-					}
+					fusedAggs.add(ast.AggFuncCount, groupMark, colId, false)
 				}
 			case aggregation.FinalMode:
 				switch x := aggFunc.Args[0].(type) {
 				case *expression.Column:
 					colT := sortedChildColIdToTensor[x.UniqueID]
-					output, err = t.ep.AddObliviousGroupAggNode(ast.AggFuncSum, groupMark, colT)
-					if err != nil {
-						return fmt.Errorf("buildObliviousGroupAggregation: %v", err)
-					}
+					fusedAggs.add(ast.AggFuncSum, colT, colId, false)
 				default:
 					return fmt.Errorf("buildObliviousGroupAggregation: unsupported aggregation function %v", aggFunc)
 				}
 			default:
 				return fmt.Errorf("buildObliviousGroupAggregation: unrecognized count func mode %v", aggFunc.Mode)
 			}
-			colIdToTensor[ln.Schema().Columns[i].UniqueID] = output
 		default:
 			return fmt.Errorf("buildObliviousGroupAggregation: unsupported aggregation function %v", aggFunc)
 		}
 	}
+	if len(fusedAggs.ins) > 0 {
+		outputs, err := t.ep.AddObliviousGroupAggsNode(groupMark, fusedAggs.funcNames, fusedAggs.ins)
+		if err != nil {
+			return fmt.Errorf("buildObliviousGroupAggregation: %v", err)
+		}
+		for i, output := range outputs {
+			output.skipDTypeCheck = fusedAggs.skipDTypeChecks[i]
+			colIdToTensor[fusedAggs.colIds[i]] = output
+		}
+	}
 	rt, err := extractResultTable(ln, colIdToTensor)
 	if err != nil {
 		return fmt.Errorf("buildObliviousGroupAggregation: %v", err)
@@ -723,6 +745,88 @@ func (t *translator) buildObliviousGroupAggregation(ln *AggregationNode) (err er
 	return ln.SetResultTableWithDTypeCheck(rtFiltered)
 }
 
+// heGroupAggParties checks whether the aggregation could be done by GroupHeSum without secret sharing:
+// keys are private to one party, every sum sums a column private to another party, and
+// the key party is allowed to see all results in plaintext.
+func (t *translator) heGroupAggParties(ln *AggregationNode, keyTs []*Tensor, childColIdToTensor map[int64]*Tensor) (keyParty string, valueParty string, ok bool) {
+	agg := ln.lp.(*core.LogicalAggregation)
+	keyParty = keyTs[0].OwnerPartyCode
+	for _, keyT := range keyTs {
+		if keyT.Status != proto.TensorStatus_TENSORSTATUS_PRIVATE || keyT.OwnerPartyCode != keyParty {
+			return "", "", false
+		}
+	}
+	for i, aggFunc := range agg.AggFuncs {
+		if len(aggFunc.Args) != 1 || !ln.CCL()[ln.Schema().Columns[i].UniqueID].IsVisibleFor(keyParty) {
+			return "", "", false
+		}
+		switch aggFunc.Name {
+		case ast.AggFuncFirstRow:
+			col, isCol := aggFunc.Args[0].(*expression.Column)
+			if !isCol || !slices.Contains(keyTs, childColIdToTensor[col.UniqueID]) {
+				return "", "", false
+			}
+		case ast.AggFuncSum:
+			col, isCol := aggFunc.Args[0].(*expression.Column)
+			if !isCol || col.GetType().EvalType() == types.ETString {
+				return "", "", false
+			}
+			in := childColIdToTensor[col.UniqueID]
+			if in.Status != proto.TensorStatus_TENSORSTATUS_PRIVATE || in.OwnerPartyCode == keyParty ||
+				(valueParty != "" && in.OwnerPartyCode != valueParty) {
+				return "", "", false
+			}
+			valueParty = in.OwnerPartyCode
+		case ast.AggFuncCount:
+			if aggFunc.Mode != aggregation.CompleteMode || aggFunc.HasDistinct {
+				return "", "", false
+			}
+		default:
+			return "", "", false
+		}
+	}
+	return keyParty, valueParty, valueParty != ""
+}
+
+// buildHeGroupAggregation sums values of valueParty grouped by keys of keyParty with homomorphic
+// encryption, results are private to keyParty and no oblivious sort or shuffle is needed.
+func (t *translator) buildHeGroupAggregation(ln *AggregationNode, keyTs []*Tensor, childColIdToTensor map[int64]*Tensor, keyParty, valueParty string) error {
+	agg := ln.lp.(*core.LogicalAggregation)
+	var values []*Tensor
+	var valueColIds []int64
+	for i, aggFunc := range agg.AggFuncs {
+		if aggFunc.Name == ast.AggFuncSum {
+			col := aggFunc.Args[0].(*expression.Column)
+			values = append(values, childColIdToTensor[col.UniqueID])
+			valueColIds = append(valueColIds, ln.Schema().Columns[i].UniqueID)
+		}
+	}
+	outs, outKeys, outCount, err := t.ep.AddGroupHeSumNode("group_he_sum", keyTs, values, keyParty, valueParty)
+	if err != nil {
+		return fmt.Errorf("buildHeGroupAggregation: %v", err)
+	}
+	colIdToTensor := map[int64]*Tensor{}
+	for i, out := range outs {
+		out.skipDTypeCheck = true
+		colIdToTensor[valueColIds[i]] = out
+	}
+	for i, aggFunc := range agg.AggFuncs {
+		colId := ln.Schema().Columns[i].UniqueID
+		switch aggFunc.Name {
+		case ast.AggFuncFirstRow:
+			col := aggFunc.Args[0].(*expression.Column)
+			colIdToTensor[colId] = outKeys[slices.Index(keyTs, childColIdToTensor[col.UniqueID])]
+		case ast.AggFuncCount:
+			colIdToTensor[colId] = outCount
+		}
+	}
+	rt, err := extractResultTable(ln, colIdToTensor)
+	if err != nil {
+		return fmt.Errorf("buildHeGroupAggregation: %v", err)
+	}
+	return ln.SetResultTableWithDTypeCheck(rt)
+}
+
 func (t *translator) buildUnion(ln *UnionAllNode) (err error) {
 	union, ok := ln.lp.(*core.LogicalUnionAll)
 	if !ok {
@@ -16,6 +16,7 @@ package translator
 
 import (
 	"fmt"
+	"path"
 	"strings"
 
 	"golang.org/x/exp/slices"
@@ -291,6 +292,18 @@ func (plan *GraphBuilder) AddPublishNode(name string, input []*Tensor, output []
 	return err
 }
 
+// dumpFileFormat returns the DumpFile format implied by extension of the file
+// path, or empty for csv which is the default format.
+func dumpFileFormat(filepath string) string {
+	switch strings.ToLower(path.Ext(filepath)) {
+	case ".parquet":
+		return "parquet"
+	case ".arrow", ".feather":
+		return "arrow"
+	}
+	return ""
+}
+
 func (plan *GraphBuilder) AddDumpFileNode(name string, in []*Tensor, out []*Tensor, filepath, deliminator, partyCode string) error {
 	newIn := []*Tensor{}
 	for _, it := range in {
@@ -305,13 +318,19 @@ func (plan *GraphBuilder) AddDumpFileNode(name string, in []*Tensor, out []*Tens
 	fp.SetString(filepath)
 	del := &Attribute{}
 	del.SetString(deliminator)
+	attrs := map[string]*Attribute{
+		operator.FilePathAttr:    fp,
+		operator.DeliminatorAttr: del,
+	}
+	if format := dumpFileFormat(filepath); format != "" {
+		f := &Attribute{}
+		f.SetString(format)
+		attrs[operator.FormatAttr] = f
+	}
 	_, err := plan.AddExecutionNode(name, operator.OpNameDumpFile,
 		map[string][]*Tensor{"In": newIn},
 		map[string][]*Tensor{"Out": out},
-		map[string]*Attribute{
-			operator.FilePathAttr:    fp,
-			operator.DeliminatorAttr: del,
-		}, []string{partyCode})
+		attrs, []string{partyCode})
 	if err != nil {
 		return fmt.Errorf("addDumpFileNode: %v", err)
 	}
@@ -861,7 +880,7 @@ func (plan *GraphBuilder) AddSortNode(name string, key, in []*Tensor) ([]*Tensor
 	}
 	if _, err := plan.AddExecutionNode(name, operator.OpNameSort,
 		map[string][]*Tensor{"Key": keyA, "In": inA}, map[string][]*Tensor{"Out": outA},
-		map[string]*Attribute{}, partyCodes); err != nil {
+		keyBitsAttrs(keyA), partyCodes); err != nil {
 		return nil, fmt.Errorf("addSortNode: %v", err)
 	}
 
@@ -887,13 +906,48 @@ func (plan *GraphBuilder) AddObliviousGroupMarkNode(name string, key []*Tensor)
 
 	if _, err := plan.AddExecutionNode(name, operator.OpNameObliviousGroupMark,
 		map[string][]*Tensor{"Key": keyA}, map[string][]*Tensor{"Group": {out}},
-		map[string]*Attribute{}, plan.partyInfo.GetParties()); err != nil {
+		keyBitsAttrs(keyA), plan.partyInfo.GetParties()); err != nil {
 		return nil, fmt.Errorf("addObliviousGroupMarkNode: %v", err)
 	}
 
 	return out, nil
 }
 
+// keyBitsAttrs declares bits of keys which the planner can prove, so that
+// the engine could pack adjacent ones into composite keys and compare each
+// composite key only once. Bits of a key are 0 if unknown.
+//
+// Only bool keys have provable bits: integer columns carry no declared value
+// range, strings are hashed into 64-bit integers before being shared, and
+// dictionary codes are assigned by each party's engine at runtime, so they
+// are unknown to the planner.
+func keyBitsAttrs(keys []*Tensor) map[string]*Attribute {
+	attrs := map[string]*Attribute{}
+	bits := make([]int, len(keys))
+	packable := false
+	for i, key := range keys {
+		bits[i] = provableKeyBits(key)
+		if i > 0 && bits[i] > 0 && bits[i-1] > 0 {
+			packable = true
+		}
+	}
+	if !packable {
+		return attrs
+	}
+	attr := &Attribute{}
+	attr.SetInts(bits)
+	attrs[operator.KeyBitsAttr] = attr
+	return attrs
+}
+
+// provableKeyBits returns bits of values of key, 0 if unknown
+func provableKeyBits(key *Tensor) int {
+	if key.DType == proto.PrimitiveDataType_BOOL {
+		return 1
+	}
+	return 0
+}
+
 func (plan *GraphBuilder) AddBroadcastToNode(name string, ins []*Tensor, shapeRefTensor *Tensor) ([]*Tensor, error) {
 	partyCodes := plan.partyInfo.GetParties()
 	var outs []*Tensor
@@ -927,14 +981,7 @@ func (plan *GraphBuilder) AddObliviousGroupAggNode(funcName string, group *Tenso
 		return nil, fmt.Errorf("addObliviousGroupAggNode: %v", err)
 	}
 
-	outA := plan.AddTensorAs(inA)
-	if funcName == ast.AggFuncAvg {
-		outA.DType = proto.PrimitiveDataType_FLOAT
-	} else if funcName == ast.AggFuncCount {
-		outA.DType = proto.PrimitiveDataType_INT64
-	} else if funcName == ast.AggFuncSum && inA.DType == proto.PrimitiveDataType_BOOL {
-		outA.DType = proto.PrimitiveDataType_INT64
-	}
+	outA := plan.addObliviousGroupAggOutput(funcName, inA)
 	if _, err := plan.AddExecutionNode(funcName, opName,
 		map[string][]*Tensor{"Group": {group}, "In": {inA}}, map[string][]*Tensor{"Out": {outA}},
 		map[string]*Attribute{}, plan.partyInfo.GetParties()); err != nil {
@@ -944,6 +991,83 @@ func (plan *GraphBuilder) AddObliviousGroupAggNode(funcName string, group *Tenso
 	return outA, nil
 }
 
+// AddObliviousGroupAggsNode aggregates every input by its own function in one
+// ObliviousGroupAgg node, so that all of them share one oblivious scan.
+func (plan *GraphBuilder) AddObliviousGroupAggsNode(group *Tensor, funcNames []string, ins []*Tensor) ([]*Tensor, error) {
+	var inA, outA []*Tensor
+	for i, in := range ins {
+		if _, ok := operator.ObliviousGroupAggOp[funcNames[i]]; !ok {
+			return nil, fmt.Errorf("addObliviousGroupAggsNode: unsupported op %v", funcNames[i])
+		}
+		// convert inputs to share
+		out, err := plan.addTensorStatusConversion(
+			in, &sharePlacement{partyCodes: plan.partyInfo.GetParties()})
+		if err != nil {
+			return nil, fmt.Errorf("addObliviousGroupAggsNode: %v", err)
+		}
+		inA = append(inA, out)
+		outA = append(outA, plan.addObliviousGroupAggOutput(funcNames[i], out))
+	}
+
+	aggFuncsAttr := &Attribute{}
+	aggFuncsAttr.SetStrings(funcNames)
+	if _, err := plan.AddExecutionNode("oblivious_group_agg", operator.OpNameObliviousGroupAgg,
+		map[string][]*Tensor{"Group": {group}, "In": inA}, map[string][]*Tensor{"Out": outA},
+		map[string]*Attribute{operator.AggFuncsAttr: aggFuncsAttr}, plan.partyInfo.GetParties()); err != nil {
+		return nil, fmt.Errorf("addObliviousGroupAggsNode: %v", err)
+	}
+
+	return outA, nil
+}
+
+func (plan *GraphBuilder) addObliviousGroupAggOutput(funcName string, in *Tensor) *Tensor {
+	out := plan.AddTensorAs(in)
+	if funcName == ast.AggFuncAvg {
+		out.DType = proto.PrimitiveDataType_FLOAT
+	} else if funcName == ast.AggFuncCount {
+		out.DType = proto.PrimitiveDataType_INT64
+	} else if funcName == ast.AggFuncSum && in.DType == proto.PrimitiveDataType_BOOL {
+		out.DType = proto.PrimitiveDataType_INT64
+	}
+	return out
+}
+
+// AddGroupHeSumNode sums private values of valueParty grouped by private keys of keyParty,
+// outputs are sums, keys and row counts of groups, all private to keyParty.
+func (plan *GraphBuilder) AddGroupHeSumNode(name string, keys []*Tensor, values []*Tensor, keyParty, valueParty string) ([]*Tensor, []*Tensor, *Tensor, error) {
+	for _, k := range keys {
+		if k.Status != proto.TensorStatus_TENSORSTATUS_PRIVATE || k.OwnerPartyCode != keyParty {
+			return nil, nil, nil, fmt.Errorf("addGroupHeSumNode: key %v is not private in %s", k, keyParty)
+		}
+	}
+	var outs []*Tensor
+	for _, v := range values {
+		if v.Status != proto.TensorStatus_TENSORSTATUS_PRIVATE || v.OwnerPartyCode != valueParty {
+			return nil, nil, nil, fmt.Errorf("addGroupHeSumNode: value %v is not private in %s", v, valueParty)
+		}
+		out := plan.addObliviousGroupAggOutput(ast.AggFuncSum, v)
+		out.OwnerPartyCode = keyParty
+		outs = append(outs, out)
+	}
+	var outKeys []*Tensor
+	for _, k := range keys {
+		outKeys = append(outKeys, plan.AddTensorAs(k))
+	}
+	outCount := plan.AddTensorAs(keys[0])
+	outCount.Name = "group_count"
+	outCount.DType = proto.PrimitiveDataType_INT64
+
+	partyAttr := &Attribute{}
+	partyAttr.SetStrings([]string{keyParty, valueParty})
+	if _, err := plan.AddExecutionNode(name, operator.OpNameGroupHeSum,
+		map[string][]*Tensor{"Key": keys, "In": values},
+		map[string][]*Tensor{"Out": outs, "OutKey": outKeys, "OutCount": {outCount}},
+		map[string]*Attribute{operator.InputPartyCodesAttr: partyAttr}, []string{keyParty, valueParty}); err != nil {
+		return nil, nil, nil, fmt.Errorf("addGroupHeSumNode: %v", err)
+	}
+	return outs, outKeys, outCount, nil
+}
+
 func (plan *GraphBuilder) AddShuffleNode(name string, in []*Tensor) ([]*Tensor, error) {
 	var inA []*Tensor
 	// convert inputs to share
@@ -951,12 +1075,12 @@ func (plan *GraphBuilder) AddShuffleNode(name string, in []*Tensor) ([]*Tensor,
 		out, err := plan.addTensorStatusConversion(
 			in, &sharePlacement{partyCodes: plan.partyInfo.GetParties()})
 		if err != nil {
-			return nil, fmt.Errorf("addSortNode: %v", err)
+			return nil, fmt.Errorf("addShuffleNode: %v", err)
 		}
 		inA = append(inA, out)
 	}
 	outA := []*Tensor{}
-	for _, in := range in {
+	for _, in := range inA {
 		outA = append(outA, plan.AddTensorAs(in))
 	}
 	if _, err := plan.AddExecutionNode(name, operator.OpNameShuffle,
@@ -49,3 +49,47 @@ func TestGraphSimple(t *testing.T) {
 	// 2 runsql + 1 less + 2 make_share
 	assert.Equal(t, 5, len(nodes))
 }
+
+func TestKeyBitsAttrs(t *testing.T) {
+	a := assert.New(t)
+	partyInfo, err := NewPartyInfo([]string{"party1", "party2"}, []string{"party1.net", "party2.net"}, []string{"party1_credential", "party2_credential"})
+	a.Nil(err)
+	e1 := NewGraphBuilder(partyInfo)
+	addSecret := func(name string, dType proto.PrimitiveDataType) *Tensor {
+		t := e1.AddTensor(name)
+		t.Status = proto.TensorStatus_TENSORSTATUS_SECRET
+		t.DType = dType
+		return t
+	}
+	str := addSecret("str", proto.PrimitiveDataType_STRING)
+	b1 := addSecret("b1", proto.PrimitiveDataType_BOOL)
+	b2 := addSecret("b2", proto.PrimitiveDataType_BOOL)
+	i1 := addSecret("i1", proto.PrimitiveDataType_INT64)
+
+	lastNodeKeyBits := func() interface{} {
+		node := e1.ExecutionNodes[len(e1.ExecutionNodes)-1]
+		attr, ok := node.Attributes[operator.KeyBitsAttr]
+		if !ok {
+			return nil
+		}
+		return attr.GetAttrValue()
+	}
+
+	// adjacent bool keys are declared, other keys are unknown
+	_, err = e1.AddObliviousGroupMarkNode("group_mark", []*Tensor{str, b1, b2})
+	a.Nil(err)
+	a.Equal([]int64{0, 1, 1}, lastNodeKeyBits())
+
+	_, err = e1.AddSortNode("sort", []*Tensor{b1, b2, i1}, []*Tensor{str})
+	a.Nil(err)
+	a.Equal([]int64{1, 1, 0}, lastNodeKeyBits())
+
+	// no adjacent keys could be packed
+	_, err = e1.AddObliviousGroupMarkNode("group_mark", []*Tensor{b1, str, b2})
+	a.Nil(err)
+	a.Nil(lastNodeKeyBits())
+
+	_, err = e1.AddSortNode("sort", []*Tensor{b1}, []*Tensor{i1})
+	a.Nil(err)
+	a.Nil(lastNodeKeyBits())
+}
@@ -62,13 +62,17 @@ type translator struct {
 	flagJointPublishString bool
 	// if true, table in RunSQL string will skip database name
 	skipDbName bool
+	// if true, a filter not visible to all parties is shuffled with the filtered
+	// tensors and then revealed, which discloses the number of selected rows
+	revealShuffledFilter bool
 }
 
 func NewTranslator(
 	enginesInfo *EnginesInfo,
 	sc *proto.SecurityConfig,
 	issuerPartyCode string,
-	skipDbName bool) (
+	skipDbName bool,
+	revealShuffledFilter bool) (
 	*translator, error) {
 	if sc == nil {
 		return nil, fmt.Errorf("translate: empty CCL")
@@ -86,11 +90,12 @@ func NewTranslator(
 		}
 	}
 	return &translator{
-		ep:              NewGraphBuilder(enginesInfo.partyInfo),
-		issuerPartyCode: issuerPartyCode,
-		sc:              newSc,
-		enginesInfo:     enginesInfo,
-		skipDbName:      skipDbName,
+		ep:                   NewGraphBuilder(enginesInfo.partyInfo),
+		issuerPartyCode:      issuerPartyCode,
+		sc:                   newSc,
+		enginesInfo:          enginesInfo,
+		skipDbName:           skipDbName,
+		revealShuffledFilter: revealShuffledFilter,
 	}, nil
 }
 
@@ -571,6 +576,37 @@ func (t *translator) addBinaryNode(opName string, opType string, left *Tensor, r
 	return output, nil
 }
 
+// addShareFilterNode filters share tensors by filter. If the filter is not visible to all parties and revealShuffledFilter
+// is set, the filter and tensors are shuffled together before the filter is revealed, so revealing it only discloses the
+// number of selected rows. Otherwise such a filter fails the CCL check when it is made public.
+func (t *translator) addShareFilterNode(filter *Tensor, shareTensors []*Tensor) ([]*Tensor, error) {
+	parties := t.enginesInfo.partyInfo.GetParties()
+	visibleToAll := true
+	for _, p := range parties {
+		if !filter.cc.IsVisibleFor(p) {
+			visibleToAll = false
+			break
+		}
+	}
+	if !visibleToAll && t.revealShuffledFilter {
+		in := append(append([]*Tensor{}, shareTensors...), filter)
+		shuffled, err := t.ep.AddShuffleNode("shuffle", in)
+		if err != nil {
+			return nil, fmt.Errorf("addShareFilterNode: %v", err)
+		}
+		shareTensors, filter = shuffled[:len(in)-1], shuffled[len(in)-1]
+		// set ccl plain after filter shuffled
+		for _, p := range parties {
+			filter.cc.SetLevelForParty(p, ccl.Plain)
+		}
+	}
+	publicFilter, err := t.ep.addTensorStatusConversion(filter, &publicPlacement{partyCodes: parties})
+	if err != nil {
+		return nil, fmt.Errorf("addShareFilterNode: %v", err)
+	}
+	return t.ep.AddFilterNode("apply_filter", shareTensors, publicFilter, parties)
+}
+
 func (t *translator) addFilterNode(filter *Tensor, tensorToFilter map[int64]*Tensor) (map[int64]*Tensor, error) {
 	// private and share tensors filter have different tensor status
 	shareTensors := []*Tensor{}
@@ -592,14 +628,18 @@ func (t *translator) addFilterNode(filter *Tensor, tensorToFilter map[int64]*Ten
 		}
 	}
 	resultIdToTensor := make(map[int64]*Tensor)
-	if len(shareTensors) > 0 {
-		// convert filter to public here, so filter must be visible to all parties
-		publicFilter, err := t.ep.addTensorStatusConversion(filter, &publicPlacement{partyCodes: t.enginesInfo.partyInfo.GetParties()})
-		if err != nil {
-			return nil, fmt.Errorf("buildSelection: %v", err)
+	// private tensors whose owner can't see the filter are filtered as shares
+	for _, p := range sliceutil.SortMapKeyForDeterminism(privateTensorsMap) {
+		if t.revealShuffledFilter && !filter.cc.IsVisibleFor(p) {
+			shareTensors = append(shareTensors, privateTensorsMap[p]...)
+			shareIds = append(shareIds, privateIdsMap[p]...)
+			delete(privateTensorsMap, p)
+			delete(privateIdsMap, p)
 		}
+	}
+	if len(shareTensors) > 0 {
 		// handling share tensors here
-		output, err := t.ep.AddFilterNode("apply_filter", shareTensors, publicFilter, t.enginesInfo.partyInfo.GetParties())
+		output, err := t.addShareFilterNode(filter, shareTensors)
 		if err != nil {
 			return nil, fmt.Errorf("buildSelection: %v", err)
 		}
@@ -43,7 +43,7 @@ func (s *testTranslatorSuite) TestTranslateWithCCL(c *C) {
 
 		t, err := NewTranslator(
 			s.engineInfo, &scql.SecurityConfig{ColumnControlList: ccl},
-			s.issuerParty, true)
+			s.issuerParty, true, false)
 		c.Assert(err, IsNil)
 		ep, err := t.Translate(lp)
 		c.Assert(err, IsNil, Commentf("for %s", sql))
@@ -53,6 +53,139 @@ func (s *testTranslatorSuite) TestTranslateWithCCL(c *C) {
 	}
 }
 
+func (s *testTranslatorSuite) TestTranslateShuffledFilter(c *C) {
+	ccl, err := mock.MockAllCCL()
+	c.Assert(err, IsNil)
+	for _, ca := range translateShuffledFilterTestCases {
+		sql := ca.sql
+		dot := ca.dotGraph
+
+		comment := Commentf("for %s", sql)
+		for _, revealShuffledFilter := range []bool{false, true} {
+			stmt, err := s.ParseOneStmt(sql, "", "")
+			c.Assert(err, IsNil, comment)
+
+			err = core.Preprocess(s.ctx, stmt, s.is)
+			c.Assert(err, IsNil)
+
+			lp, _, err := core.BuildLogicalPlanWithOptimization(context.Background(), s.ctx, stmt, s.is)
+			c.Assert(err, IsNil)
+
+			t, err := NewTranslator(
+				s.engineInfo, &scql.SecurityConfig{ColumnControlList: ccl},
+				s.issuerParty, true, revealShuffledFilter)
+			c.Assert(err, IsNil)
+			ep, err := t.Translate(lp)
+			if !revealShuffledFilter {
+				// the filter is not visible to bob, so it is rejected by default
+				c.Assert(err, NotNil, comment)
+				continue
+			}
+			c.Assert(err, IsNil, comment)
+			c.Assert(ep.DumpGraphviz(), Equals, dot, comment)
+		}
+	}
+}
+
+var translateShuffledFilterTestCases = []sPair{
+	{`select ta.join_long_0 from alice.tbl_0 as ta join bob.tbl_0 as tb on ta.join_long_0 = tb.join_long_0 where ta.encrypt_long_0 > tb.compare_long_0`, `digraph G {
+0 [label="runsql:{in:[],out:[Out:{t_0,t_1,},],attr:[sql:select encrypt_long_0,join_long_0 from alice.tbl_0,table_refs:[alice.tbl_0],],url:[alice.com,]}"]
+1 [label="runsql:{in:[],out:[Out:{t_2,t_3,},],attr:[sql:select compare_long_0,join_long_0 from bob.tbl_0,table_refs:[bob.tbl_0],],url:[bob.com,]}"]
+2 [label="join:{in:[Left:{t_1,},Right:{t_3,},],out:[LeftJoinIndex:{t_4,},RightJoinIndex:{t_5,},],attr:[input_party_codes:[alice bob],join_type:0,],url:[alice.com,bob.com,]}"]
+3 [label="filter_by_index:{in:[Data:{t_0,t_1,},RowsIndexFilter:{t_4,},],out:[Out:{t_6,t_7,},],attr:[],url:[alice.com,]}"]
+4 [label="filter_by_index:{in:[Data:{t_2,t_3,},RowsIndexFilter:{t_5,},],out:[Out:{t_8,t_9,},],attr:[],url:[bob.com,]}"]
+5 [label="make_share:{in:[In:{t_6,},],out:[Out:{t_10,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+6 [label="make_share:{in:[In:{t_8,},],out:[Out:{t_11,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+7 [label="Greater:{in:[Left:{t_10,},Right:{t_11,},],out:[Out:{t_12,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+8 [label="make_share:{in:[In:{t_8,},],out:[Out:{t_13,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+9 [label="make_share:{in:[In:{t_9,},],out:[Out:{t_14,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+10 [label="shuffle:{in:[In:{t_13,t_14,t_12,},],out:[Out:{t_15,t_16,t_17,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+11 [label="make_public:{in:[In:{t_17,},],out:[Out:{t_18,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+12 [label="apply_filter:{in:[Filter:{t_18,},In:{t_15,t_16,},],out:[Out:{t_19,t_20,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+13 [label="make_private:{in:[In:{t_12,},],out:[Out:{t_21,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+14 [label="apply_filter:{in:[Filter:{t_21,},In:{t_6,t_7,},],out:[Out:{t_22,t_23,},],attr:[],url:[alice.com,]}"]
+15 [label="publish:{in:[In:{t_23,},],out:[Out:{t_24,},],attr:[],url:[alice.com,]}"]
+0 -> 2 [label = "t_1:{join_long_0:PRIVATE:INT64}"]
+0 -> 3 [label = "t_0:{encrypt_long_0:PRIVATE:INT64}"]
+0 -> 3 [label = "t_1:{join_long_0:PRIVATE:INT64}"]
+1 -> 2 [label = "t_3:{join_long_0:PRIVATE:INT64}"]
+1 -> 4 [label = "t_2:{compare_long_0:PRIVATE:INT64}"]
+1 -> 4 [label = "t_3:{join_long_0:PRIVATE:INT64}"]
+10 -> 11 [label = "t_17:{Greater_out:SECRET:BOOL}"]
+10 -> 12 [label = "t_15:{compare_long_0:SECRET:INT64}"]
+10 -> 12 [label = "t_16:{join_long_0:SECRET:INT64}"]
+11 -> 12 [label = "t_18:{Greater_out:PUBLIC:BOOL}"]
+13 -> 14 [label = "t_21:{Greater_out:PRIVATE:BOOL}"]
+14 -> 15 [label = "t_23:{join_long_0:PRIVATE:INT64}"]
+2 -> 3 [label = "t_4:{join_long_0:PRIVATE:INT64}"]
+2 -> 4 [label = "t_5:{join_long_0:PRIVATE:INT64}"]
+3 -> 14 [label = "t_6:{encrypt_long_0:PRIVATE:INT64}"]
+3 -> 14 [label = "t_7:{join_long_0:PRIVATE:INT64}"]
+3 -> 5 [label = "t_6:{encrypt_long_0:PRIVATE:INT64}"]
+4 -> 6 [label = "t_8:{compare_long_0:PRIVATE:INT64}"]
+4 -> 8 [label = "t_8:{compare_long_0:PRIVATE:INT64}"]
+4 -> 9 [label = "t_9:{join_long_0:PRIVATE:INT64}"]
+5 -> 7 [label = "t_10:{encrypt_long_0:SECRET:INT64}"]
+6 -> 7 [label = "t_11:{compare_long_0:SECRET:INT64}"]
+7 -> 10 [label = "t_12:{Greater_out:SECRET:BOOL}"]
+7 -> 13 [label = "t_12:{Greater_out:SECRET:BOOL}"]
+8 -> 10 [label = "t_13:{compare_long_0:SECRET:INT64}"]
+9 -> 10 [label = "t_14:{join_long_0:SECRET:INT64}"]
+}`},
+	{`select ta.join_long_0, tb.plain_long_0 from alice.tbl_0 as ta join bob.tbl_0 as tb on ta.join_long_0 = tb.join_long_0 where ta.encrypt_long_0 > tb.compare_long_0`, `digraph G {
+0 [label="runsql:{in:[],out:[Out:{t_0,t_1,},],attr:[sql:select encrypt_long_0,join_long_0 from alice.tbl_0,table_refs:[alice.tbl_0],],url:[alice.com,]}"]
+1 [label="runsql:{in:[],out:[Out:{t_2,t_3,t_4,},],attr:[sql:select compare_long_0,join_long_0,plain_long_0 from bob.tbl_0,table_refs:[bob.tbl_0],],url:[bob.com,]}"]
+2 [label="join:{in:[Left:{t_1,},Right:{t_3,},],out:[LeftJoinIndex:{t_5,},RightJoinIndex:{t_6,},],attr:[input_party_codes:[alice bob],join_type:0,],url:[alice.com,bob.com,]}"]
+3 [label="filter_by_index:{in:[Data:{t_0,t_1,},RowsIndexFilter:{t_5,},],out:[Out:{t_7,t_8,},],attr:[],url:[alice.com,]}"]
+4 [label="filter_by_index:{in:[Data:{t_2,t_3,t_4,},RowsIndexFilter:{t_6,},],out:[Out:{t_9,t_10,t_11,},],attr:[],url:[bob.com,]}"]
+5 [label="make_share:{in:[In:{t_7,},],out:[Out:{t_12,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+6 [label="make_share:{in:[In:{t_9,},],out:[Out:{t_13,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+7 [label="Greater:{in:[Left:{t_12,},Right:{t_13,},],out:[Out:{t_14,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+8 [label="make_share:{in:[In:{t_9,},],out:[Out:{t_15,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+9 [label="make_share:{in:[In:{t_10,},],out:[Out:{t_16,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+10 [label="make_share:{in:[In:{t_11,},],out:[Out:{t_17,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+11 [label="shuffle:{in:[In:{t_15,t_16,t_17,t_14,},],out:[Out:{t_18,t_19,t_20,t_21,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+12 [label="make_public:{in:[In:{t_21,},],out:[Out:{t_22,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+13 [label="apply_filter:{in:[Filter:{t_22,},In:{t_18,t_19,t_20,},],out:[Out:{t_23,t_24,t_25,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+14 [label="make_private:{in:[In:{t_14,},],out:[Out:{t_26,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+15 [label="apply_filter:{in:[Filter:{t_26,},In:{t_7,t_8,},],out:[Out:{t_27,t_28,},],attr:[],url:[alice.com,]}"]
+16 [label="make_private:{in:[In:{t_25,},],out:[Out:{t_30,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+17 [label="publish:{in:[In:{t_28,t_30,},],out:[Out:{t_29,t_31,},],attr:[],url:[alice.com,]}"]
+0 -> 2 [label = "t_1:{join_long_0:PRIVATE:INT64}"]
+0 -> 3 [label = "t_0:{encrypt_long_0:PRIVATE:INT64}"]
+0 -> 3 [label = "t_1:{join_long_0:PRIVATE:INT64}"]
+1 -> 2 [label = "t_3:{join_long_0:PRIVATE:INT64}"]
+1 -> 4 [label = "t_2:{compare_long_0:PRIVATE:INT64}"]
+1 -> 4 [label = "t_3:{join_long_0:PRIVATE:INT64}"]
+1 -> 4 [label = "t_4:{plain_long_0:PRIVATE:INT64}"]
+10 -> 11 [label = "t_17:{plain_long_0:SECRET:INT64}"]
+11 -> 12 [label = "t_21:{Greater_out:SECRET:BOOL}"]
+11 -> 13 [label = "t_18:{compare_long_0:SECRET:INT64}"]
+11 -> 13 [label = "t_19:{join_long_0:SECRET:INT64}"]
+11 -> 13 [label = "t_20:{plain_long_0:SECRET:INT64}"]
+12 -> 13 [label = "t_22:{Greater_out:PUBLIC:BOOL}"]
+13 -> 16 [label = "t_25:{plain_long_0:SECRET:INT64}"]
+14 -> 15 [label = "t_26:{Greater_out:PRIVATE:BOOL}"]
+15 -> 17 [label = "t_28:{join_long_0:PRIVATE:INT64}"]
+16 -> 17 [label = "t_30:{plain_long_0:PRIVATE:INT64}"]
+2 -> 3 [label = "t_5:{join_long_0:PRIVATE:INT64}"]
+2 -> 4 [label = "t_6:{join_long_0:PRIVATE:INT64}"]
+3 -> 15 [label = "t_7:{encrypt_long_0:PRIVATE:INT64}"]
+3 -> 15 [label = "t_8:{join_long_0:PRIVATE:INT64}"]
+3 -> 5 [label = "t_7:{encrypt_long_0:PRIVATE:INT64}"]
+4 -> 10 [label = "t_11:{plain_long_0:PRIVATE:INT64}"]
+4 -> 6 [label = "t_9:{compare_long_0:PRIVATE:INT64}"]
+4 -> 8 [label = "t_9:{compare_long_0:PRIVATE:INT64}"]
+4 -> 9 [label = "t_10:{join_long_0:PRIVATE:INT64}"]
+5 -> 7 [label = "t_12:{encrypt_long_0:SECRET:INT64}"]
+6 -> 7 [label = "t_13:{compare_long_0:SECRET:INT64}"]
+7 -> 11 [label = "t_14:{Greater_out:SECRET:BOOL}"]
+7 -> 14 [label = "t_14:{Greater_out:SECRET:BOOL}"]
+8 -> 11 [label = "t_15:{compare_long_0:SECRET:INT64}"]
+9 -> 11 [label = "t_16:{join_long_0:SECRET:INT64}"]
+}`},
+}
+
 var translateWithCCLTestCases = []sPair{
 	{`select count(*) as c, count(distinct bob.encrypt_long_0) as cd, sum(bob.aggregate_long_0) as sb, sum(carol.aggregate_long_0) as sc from alice.tbl_0 as alice, bob.tbl_0 as bob, carol.tbl_0 as carol where alice.join_long_0 = bob.join_long_0 and bob.join_long_0 = carol.join_long_0 group by alice.groupby_long_0 + bob.groupby_long_0, carol.groupby_long_0 + bob.groupby_long_0;`, `digraph G {
 0 [label="runsql:{in:[],out:[Out:{t_0,t_1,},],attr:[sql:select groupby_long_0,join_long_0 from alice.tbl_0,table_refs:[alice.tbl_0],],url:[alice.com,]}"]
@@ -83,25 +216,22 @@ var translateWithCCLTestCases = []sPair{
 25 [label="make_share:{in:[In:{t_28,},],out:[Out:{t_43,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
 26 [label="sort:{in:[In:{t_31,t_34,t_35,t_36,t_37,t_38,t_39,t_40,t_41,t_42,t_43,},Key:{t_31,t_34,},],out:[Out:{t_44,t_45,t_46,t_47,t_48,t_49,t_50,t_51,t_52,t_53,t_54,},],attr:[reverse:false,],url:[alice.com,bob.com,carol.com,]}"]
 27 [label="group_mark:{in:[Key:{t_44,t_45,},],out:[Group:{t_55,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-28 [label="count:{in:[Group:{t_55,},In:{t_55,},],out:[Out:{t_56,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-29 [label="sort:{in:[In:{t_49,},Key:{t_44,t_45,t_49,},],out:[Out:{t_57,},],attr:[reverse:false,],url:[alice.com,bob.com,carol.com,]}"]
-30 [label="group_mark:{in:[Key:{t_57,},],out:[Group:{t_58,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-31 [label="sum:{in:[Group:{t_55,},In:{t_58,},],out:[Out:{t_59,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-32 [label="sum:{in:[Group:{t_55,},In:{t_48,},],out:[Out:{t_60,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-33 [label="sum:{in:[Group:{t_55,},In:{t_52,},],out:[Out:{t_61,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-34 [label="shuffle:{in:[In:{t_56,t_59,t_60,t_61,t_55,},],out:[Out:{t_62,t_63,t_64,t_65,t_66,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-35 [label="make_public:{in:[In:{t_66,},],out:[Out:{t_67,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-36 [label="filter:{in:[Filter:{t_67,},In:{t_62,t_63,t_64,t_65,},],out:[Out:{t_68,t_69,t_70,t_71,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-37 [label="make_constant:{in:[],out:[Out:{t_72,},],attr:[scalar:4,to_status:1,],url:[alice.com,bob.com,carol.com,]}"]
-38 [label="broadcast:{in:[In:{t_72,},ShapeRefTensor:{t_68,},],out:[Out:{t_73,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-39 [label="GreaterEqual:{in:[Left:{t_68,},Right:{t_73,},],out:[Out:{t_74,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-40 [label="make_public:{in:[In:{t_74,},],out:[Out:{t_75,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-41 [label="apply_filter:{in:[Filter:{t_75,},In:{t_68,t_69,t_70,t_71,},],out:[Out:{t_76,t_77,t_78,t_79,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-42 [label="make_private:{in:[In:{t_76,},],out:[Out:{t_80,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-43 [label="make_private:{in:[In:{t_77,},],out:[Out:{t_82,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-44 [label="make_private:{in:[In:{t_78,},],out:[Out:{t_84,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-45 [label="make_private:{in:[In:{t_79,},],out:[Out:{t_86,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-46 [label="publish:{in:[In:{t_80,t_82,t_84,t_86,},],out:[Out:{t_81,t_83,t_85,t_87,},],attr:[],url:[alice.com,]}"]
+28 [label="sort:{in:[In:{t_49,},Key:{t_44,t_45,t_49,},],out:[Out:{t_56,},],attr:[reverse:false,],url:[alice.com,bob.com,carol.com,]}"]
+29 [label="group_mark:{in:[Key:{t_56,},],out:[Group:{t_57,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+30 [label="oblivious_group_agg:{in:[Group:{t_55,},In:{t_55,t_57,t_48,t_52,},],out:[Out:{t_58,t_59,t_60,t_61,},],attr:[agg_funcs:[count sum sum sum],],url:[alice.com,bob.com,carol.com,]}"]
+31 [label="shuffle:{in:[In:{t_58,t_59,t_60,t_61,t_55,},],out:[Out:{t_62,t_63,t_64,t_65,t_66,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+32 [label="make_public:{in:[In:{t_66,},],out:[Out:{t_67,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+33 [label="filter:{in:[Filter:{t_67,},In:{t_62,t_63,t_64,t_65,},],out:[Out:{t_68,t_69,t_70,t_71,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+34 [label="make_constant:{in:[],out:[Out:{t_72,},],attr:[scalar:4,to_status:1,],url:[alice.com,bob.com,carol.com,]}"]
+35 [label="broadcast:{in:[In:{t_72,},ShapeRefTensor:{t_68,},],out:[Out:{t_73,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+36 [label="GreaterEqual:{in:[Left:{t_68,},Right:{t_73,},],out:[Out:{t_74,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+37 [label="make_public:{in:[In:{t_74,},],out:[Out:{t_75,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+38 [label="apply_filter:{in:[Filter:{t_75,},In:{t_68,t_69,t_70,t_71,},],out:[Out:{t_76,t_77,t_78,t_79,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+39 [label="make_private:{in:[In:{t_76,},],out:[Out:{t_80,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+40 [label="make_private:{in:[In:{t_77,},],out:[Out:{t_82,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+41 [label="make_private:{in:[In:{t_78,},],out:[Out:{t_84,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+42 [label="make_private:{in:[In:{t_79,},],out:[Out:{t_86,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+43 [label="publish:{in:[In:{t_80,t_82,t_84,t_86,},],out:[Out:{t_81,t_83,t_85,t_87,},],attr:[],url:[alice.com,]}"]
 0 -> 2 [label = "t_1:{join_long_0:PRIVATE:INT64}"]
 0 -> 3 [label = "t_0:{groupby_long_0:PRIVATE:INT64}"]
 0 -> 3 [label = "t_1:{join_long_0:PRIVATE:INT64}"]
@@ -135,55 +265,52 @@ var translateWithCCLTestCases = []sPair{
 25 -> 26 [label = "t_43:{join_long_0:SECRET:INT64}"]
 26 -> 27 [label = "t_44:{Add_out:SECRET:INT64}"]
 26 -> 27 [label = "t_45:{Add_out:SECRET:INT64}"]
-26 -> 29 [label = "t_44:{Add_out:SECRET:INT64}"]
-26 -> 29 [label = "t_45:{Add_out:SECRET:INT64}"]
-26 -> 29 [label = "t_49:{encrypt_long_0:SECRET:INT64}"]
-26 -> 29 [label = "t_49:{encrypt_long_0:SECRET:INT64}"]
-26 -> 32 [label = "t_48:{aggregate_long_0:SECRET:INT64}"]
-26 -> 33 [label = "t_52:{aggregate_long_0:SECRET:INT64}"]
-27 -> 28 [label = "t_55:{group_mark:SECRET:BOOL}"]
-27 -> 28 [label = "t_55:{group_mark:SECRET:BOOL}"]
+26 -> 28 [label = "t_44:{Add_out:SECRET:INT64}"]
+26 -> 28 [label = "t_45:{Add_out:SECRET:INT64}"]
+26 -> 28 [label = "t_49:{encrypt_long_0:SECRET:INT64}"]
+26 -> 28 [label = "t_49:{encrypt_long_0:SECRET:INT64}"]
+26 -> 30 [label = "t_48:{aggregate_long_0:SECRET:INT64}"]
+26 -> 30 [label = "t_52:{aggregate_long_0:SECRET:INT64}"]
+27 -> 30 [label = "t_55:{group_mark:SECRET:BOOL}"]
+27 -> 30 [label = "t_55:{group_mark:SECRET:BOOL}"]
 27 -> 31 [label = "t_55:{group_mark:SECRET:BOOL}"]
-27 -> 32 [label = "t_55:{group_mark:SECRET:BOOL}"]
-27 -> 33 [label = "t_55:{group_mark:SECRET:BOOL}"]
-27 -> 34 [label = "t_55:{group_mark:SECRET:BOOL}"]
-28 -> 34 [label = "t_56:{group_mark:SECRET:INT64}"]
-29 -> 30 [label = "t_57:{encrypt_long_0:SECRET:INT64}"]
+28 -> 29 [label = "t_56:{encrypt_long_0:SECRET:INT64}"]
+29 -> 30 [label = "t_57:{group_mark:SECRET:BOOL}"]
 3 -> 8 [label = "t_8:{groupby_long_0:PRIVATE:INT64}"]
 3 -> 8 [label = "t_9:{join_long_0:PRIVATE:INT64}"]
-30 -> 31 [label = "t_58:{group_mark:SECRET:BOOL}"]
-31 -> 34 [label = "t_59:{group_mark:SECRET:INT64}"]
-32 -> 34 [label = "t_60:{aggregate_long_0:SECRET:INT64}"]
-33 -> 34 [label = "t_61:{aggregate_long_0:SECRET:INT64}"]
-34 -> 35 [label = "t_66:{group_mark:SECRET:BOOL}"]
-34 -> 36 [label = "t_62:{group_mark:SECRET:INT64}"]
-34 -> 36 [label = "t_63:{group_mark:SECRET:INT64}"]
-34 -> 36 [label = "t_64:{aggregate_long_0:SECRET:INT64}"]
-34 -> 36 [label = "t_65:{aggregate_long_0:SECRET:INT64}"]
-35 -> 36 [label = "t_67:{group_mark:PUBLIC:BOOL}"]
-36 -> 38 [label = "t_68:{group_mark:SECRET:INT64}"]
-36 -> 39 [label = "t_68:{group_mark:SECRET:INT64}"]
-36 -> 41 [label = "t_68:{group_mark:SECRET:INT64}"]
-36 -> 41 [label = "t_69:{group_mark:SECRET:INT64}"]
-36 -> 41 [label = "t_70:{aggregate_long_0:SECRET:INT64}"]
-36 -> 41 [label = "t_71:{aggregate_long_0:SECRET:INT64}"]
-37 -> 38 [label = "t_72:{constant_data:PUBLIC:INT64}"]
-38 -> 39 [label = "t_73:{constant_data:PUBLIC:INT64}"]
-39 -> 40 [label = "t_74:{GreaterEqual_out:SECRET:BOOL}"]
+30 -> 31 [label = "t_58:{group_mark:SECRET:INT64}"]
+30 -> 31 [label = "t_59:{group_mark:SECRET:INT64}"]
+30 -> 31 [label = "t_60:{aggregate_long_0:SECRET:INT64}"]
+30 -> 31 [label = "t_61:{aggregate_long_0:SECRET:INT64}"]
+31 -> 32 [label = "t_66:{group_mark:SECRET:BOOL}"]
+31 -> 33 [label = "t_62:{group_mark:SECRET:INT64}"]
+31 -> 33 [label = "t_63:{group_mark:SECRET:INT64}"]
+31 -> 33 [label = "t_64:{aggregate_long_0:SECRET:INT64}"]
+31 -> 33 [label = "t_65:{aggregate_long_0:SECRET:INT64}"]
+32 -> 33 [label = "t_67:{group_mark:PUBLIC:BOOL}"]
+33 -> 35 [label = "t_68:{group_mark:SECRET:INT64}"]
+33 -> 36 [label = "t_68:{group_mark:SECRET:INT64}"]
+33 -> 38 [label = "t_68:{group_mark:SECRET:INT64}"]
+33 -> 38 [label = "t_69:{group_mark:SECRET:INT64}"]
+33 -> 38 [label = "t_70:{aggregate_long_0:SECRET:INT64}"]
+33 -> 38 [label = "t_71:{aggregate_long_0:SECRET:INT64}"]
+34 -> 35 [label = "t_72:{constant_data:PUBLIC:INT64}"]
+35 -> 36 [label = "t_73:{constant_data:PUBLIC:INT64}"]
+36 -> 37 [label = "t_74:{GreaterEqual_out:SECRET:BOOL}"]
+37 -> 38 [label = "t_75:{GreaterEqual_out:PUBLIC:BOOL}"]
+38 -> 39 [label = "t_76:{group_mark:SECRET:INT64}"]
+38 -> 40 [label = "t_77:{group_mark:SECRET:INT64}"]
+38 -> 41 [label = "t_78:{aggregate_long_0:SECRET:INT64}"]
+38 -> 42 [label = "t_79:{aggregate_long_0:SECRET:INT64}"]
+39 -> 43 [label = "t_80:{group_mark:PRIVATE:INT64}"]
 4 -> 6 [label = "t_13:{join_long_0:PRIVATE:INT64}"]
 4 -> 9 [label = "t_10:{aggregate_long_0:PRIVATE:INT64}"]
 4 -> 9 [label = "t_11:{encrypt_long_0:PRIVATE:INT64}"]
 4 -> 9 [label = "t_12:{groupby_long_0:PRIVATE:INT64}"]
 4 -> 9 [label = "t_13:{join_long_0:PRIVATE:INT64}"]
-40 -> 41 [label = "t_75:{GreaterEqual_out:PUBLIC:BOOL}"]
-41 -> 42 [label = "t_76:{group_mark:SECRET:INT64}"]
-41 -> 43 [label = "t_77:{group_mark:SECRET:INT64}"]
-41 -> 44 [label = "t_78:{aggregate_long_0:SECRET:INT64}"]
-41 -> 45 [label = "t_79:{aggregate_long_0:SECRET:INT64}"]
-42 -> 46 [label = "t_80:{group_mark:PRIVATE:INT64}"]
-43 -> 46 [label = "t_82:{group_mark:PRIVATE:INT64}"]
-44 -> 46 [label = "t_84:{aggregate_long_0:PRIVATE:INT64}"]
-45 -> 46 [label = "t_86:{aggregate_long_0:PRIVATE:INT64}"]
+40 -> 43 [label = "t_82:{group_mark:PRIVATE:INT64}"]
+41 -> 43 [label = "t_84:{aggregate_long_0:PRIVATE:INT64}"]
+42 -> 43 [label = "t_86:{aggregate_long_0:PRIVATE:INT64}"]
 5 -> 10 [label = "t_14:{aggregate_long_0:PRIVATE:INT64}"]
 5 -> 10 [label = "t_15:{groupby_long_0:PRIVATE:INT64}"]
 5 -> 10 [label = "t_16:{join_long_0:PRIVATE:INT64}"]
@@ -244,25 +371,22 @@ var translateWithCCLTestCases = []sPair{
 28 [label="make_share:{in:[In:{t_30,},],out:[Out:{t_48,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
 29 [label="sort:{in:[In:{t_35,t_36,t_37,t_38,t_39,t_40,t_41,t_42,t_43,t_44,t_45,t_46,t_47,t_48,},Key:{t_31,t_32,t_33,t_34,},],out:[Out:{t_49,t_50,t_51,t_52,t_53,t_54,t_55,t_56,t_57,t_58,t_59,t_60,t_61,t_62,},],attr:[reverse:false,],url:[alice.com,bob.com,carol.com,]}"]
 30 [label="group_mark:{in:[Key:{t_49,t_50,t_51,t_52,},],out:[Group:{t_63,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-31 [label="count:{in:[Group:{t_63,},In:{t_63,},],out:[Out:{t_64,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-32 [label="sort:{in:[In:{t_56,},Key:{t_49,t_50,t_51,t_52,t_56,},],out:[Out:{t_65,},],attr:[reverse:false,],url:[alice.com,bob.com,carol.com,]}"]
-33 [label="group_mark:{in:[Key:{t_65,},],out:[Group:{t_66,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-34 [label="sum:{in:[Group:{t_63,},In:{t_66,},],out:[Out:{t_67,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-35 [label="sum:{in:[Group:{t_63,},In:{t_55,},],out:[Out:{t_68,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-36 [label="sum:{in:[Group:{t_63,},In:{t_59,},],out:[Out:{t_69,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-37 [label="shuffle:{in:[In:{t_64,t_67,t_68,t_69,t_63,},],out:[Out:{t_70,t_71,t_72,t_73,t_74,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-38 [label="make_public:{in:[In:{t_74,},],out:[Out:{t_75,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-39 [label="filter:{in:[Filter:{t_75,},In:{t_70,t_71,t_72,t_73,},],out:[Out:{t_76,t_77,t_78,t_79,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-40 [label="make_constant:{in:[],out:[Out:{t_80,},],attr:[scalar:4,to_status:1,],url:[alice.com,bob.com,carol.com,]}"]
-41 [label="broadcast:{in:[In:{t_80,},ShapeRefTensor:{t_76,},],out:[Out:{t_81,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-42 [label="GreaterEqual:{in:[Left:{t_76,},Right:{t_81,},],out:[Out:{t_82,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-43 [label="make_public:{in:[In:{t_82,},],out:[Out:{t_83,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-44 [label="apply_filter:{in:[Filter:{t_83,},In:{t_76,t_77,t_78,t_79,},],out:[Out:{t_84,t_85,t_86,t_87,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-45 [label="make_private:{in:[In:{t_84,},],out:[Out:{t_88,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-46 [label="make_private:{in:[In:{t_85,},],out:[Out:{t_90,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-47 [label="make_private:{in:[In:{t_86,},],out:[Out:{t_92,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-48 [label="make_private:{in:[In:{t_87,},],out:[Out:{t_94,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-49 [label="publish:{in:[In:{t_88,t_90,t_92,t_94,},],out:[Out:{t_89,t_91,t_93,t_95,},],attr:[],url:[alice.com,]}"]
+31 [label="sort:{in:[In:{t_56,},Key:{t_49,t_50,t_51,t_52,t_56,},],out:[Out:{t_64,},],attr:[reverse:false,],url:[alice.com,bob.com,carol.com,]}"]
+32 [label="group_mark:{in:[Key:{t_64,},],out:[Group:{t_65,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+33 [label="oblivious_group_agg:{in:[Group:{t_63,},In:{t_63,t_65,t_55,t_59,},],out:[Out:{t_66,t_67,t_68,t_69,},],attr:[agg_funcs:[count sum sum sum],],url:[alice.com,bob.com,carol.com,]}"]
+34 [label="shuffle:{in:[In:{t_66,t_67,t_68,t_69,t_63,},],out:[Out:{t_70,t_71,t_72,t_73,t_74,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+35 [label="make_public:{in:[In:{t_74,},],out:[Out:{t_75,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+36 [label="filter:{in:[Filter:{t_75,},In:{t_70,t_71,t_72,t_73,},],out:[Out:{t_76,t_77,t_78,t_79,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+37 [label="make_constant:{in:[],out:[Out:{t_80,},],attr:[scalar:4,to_status:1,],url:[alice.com,bob.com,carol.com,]}"]
+38 [label="broadcast:{in:[In:{t_80,},ShapeRefTensor:{t_76,},],out:[Out:{t_81,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+39 [label="GreaterEqual:{in:[Left:{t_76,},Right:{t_81,},],out:[Out:{t_82,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+40 [label="make_public:{in:[In:{t_82,},],out:[Out:{t_83,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+41 [label="apply_filter:{in:[Filter:{t_83,},In:{t_76,t_77,t_78,t_79,},],out:[Out:{t_84,t_85,t_86,t_87,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+42 [label="make_private:{in:[In:{t_84,},],out:[Out:{t_88,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+43 [label="make_private:{in:[In:{t_85,},],out:[Out:{t_90,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+44 [label="make_private:{in:[In:{t_86,},],out:[Out:{t_92,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+45 [label="make_private:{in:[In:{t_87,},],out:[Out:{t_94,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+46 [label="publish:{in:[In:{t_88,t_90,t_92,t_94,},],out:[Out:{t_89,t_91,t_93,t_95,},],attr:[],url:[alice.com,]}"]
 0 -> 2 [label = "t_1:{join_long_0:PRIVATE:INT64}"]
 0 -> 3 [label = "t_0:{groupby_long_0:PRIVATE:INT64}"]
 0 -> 3 [label = "t_1:{join_long_0:PRIVATE:INT64}"]
@@ -303,57 +427,54 @@ var translateWithCCLTestCases = []sPair{
 29 -> 30 [label = "t_50:{groupby_long_0:SECRET:INT64}"]
 29 -> 30 [label = "t_51:{groupby_long_0:SECRET:INT64}"]
 29 -> 30 [label = "t_52:{groupby_string_0:SECRET:STRING}"]
-29 -> 32 [label = "t_49:{groupby_long_0:SECRET:INT64}"]
-29 -> 32 [label = "t_50:{groupby_long_0:SECRET:INT64}"]
-29 -> 32 [label = "t_51:{groupby_long_0:SECRET:INT64}"]
-29 -> 32 [label = "t_52:{groupby_string_0:SECRET:STRING}"]
-29 -> 32 [label = "t_56:{encrypt_long_0:SECRET:INT64}"]
-29 -> 32 [label = "t_56:{encrypt_long_0:SECRET:INT64}"]
-29 -> 35 [label = "t_55:{aggregate_long_0:SECRET:INT64}"]
-29 -> 36 [label = "t_59:{aggregate_long_0:SECRET:INT64}"]
+29 -> 31 [label = "t_49:{groupby_long_0:SECRET:INT64}"]
+29 -> 31 [label = "t_50:{groupby_long_0:SECRET:INT64}"]
+29 -> 31 [label = "t_51:{groupby_long_0:SECRET:INT64}"]
+29 -> 31 [label = "t_52:{groupby_string_0:SECRET:STRING}"]
+29 -> 31 [label = "t_56:{encrypt_long_0:SECRET:INT64}"]
+29 -> 31 [label = "t_56:{encrypt_long_0:SECRET:INT64}"]
+29 -> 33 [label = "t_55:{aggregate_long_0:SECRET:INT64}"]
+29 -> 33 [label = "t_59:{aggregate_long_0:SECRET:INT64}"]
 3 -> 8 [label = "t_8:{groupby_long_0:PRIVATE:INT64}"]
 3 -> 8 [label = "t_9:{join_long_0:PRIVATE:INT64}"]
-30 -> 31 [label = "t_63:{group_mark:SECRET:BOOL}"]
-30 -> 31 [label = "t_63:{group_mark:SECRET:BOOL}"]
+30 -> 33 [label = "t_63:{group_mark:SECRET:BOOL}"]
+30 -> 33 [label = "t_63:{group_mark:SECRET:BOOL}"]
 30 -> 34 [label = "t_63:{group_mark:SECRET:BOOL}"]
-30 -> 35 [label = "t_63:{group_mark:SECRET:BOOL}"]
-30 -> 36 [label = "t_63:{group_mark:SECRET:BOOL}"]
-30 -> 37 [label = "t_63:{group_mark:SECRET:BOOL}"]
-31 -> 37 [label = "t_64:{group_mark:SECRET:INT64}"]
-32 -> 33 [label = "t_65:{encrypt_long_0:SECRET:INT64}"]
-33 -> 34 [label = "t_66:{group_mark:SECRET:BOOL}"]
-34 -> 37 [label = "t_67:{group_mark:SECRET:INT64}"]
-35 -> 37 [label = "t_68:{aggregate_long_0:SECRET:INT64}"]
-36 -> 37 [label = "t_69:{aggregate_long_0:SECRET:INT64}"]
-37 -> 38 [label = "t_74:{group_mark:SECRET:BOOL}"]
-37 -> 39 [label = "t_70:{group_mark:SECRET:INT64}"]
-37 -> 39 [label = "t_71:{group_mark:SECRET:INT64}"]
-37 -> 39 [label = "t_72:{aggregate_long_0:SECRET:INT64}"]
-37 -> 39 [label = "t_73:{aggregate_long_0:SECRET:INT64}"]
-38 -> 39 [label = "t_75:{group_mark:PUBLIC:BOOL}"]
-39 -> 41 [label = "t_76:{group_mark:SECRET:INT64}"]
-39 -> 42 [label = "t_76:{group_mark:SECRET:INT64}"]
-39 -> 44 [label = "t_76:{group_mark:SECRET:INT64}"]
-39 -> 44 [label = "t_77:{group_mark:SECRET:INT64}"]
-39 -> 44 [label = "t_78:{aggregate_long_0:SECRET:INT64}"]
-39 -> 44 [label = "t_79:{aggregate_long_0:SECRET:INT64}"]
+31 -> 32 [label = "t_64:{encrypt_long_0:SECRET:INT64}"]
+32 -> 33 [label = "t_65:{group_mark:SECRET:BOOL}"]
+33 -> 34 [label = "t_66:{group_mark:SECRET:INT64}"]
+33 -> 34 [label = "t_67:{group_mark:SECRET:INT64}"]
+33 -> 34 [label = "t_68:{aggregate_long_0:SECRET:INT64}"]
+33 -> 34 [label = "t_69:{aggregate_long_0:SECRET:INT64}"]
+34 -> 35 [label = "t_74:{group_mark:SECRET:BOOL}"]
+34 -> 36 [label = "t_70:{group_mark:SECRET:INT64}"]
+34 -> 36 [label = "t_71:{group_mark:SECRET:INT64}"]
+34 -> 36 [label = "t_72:{aggregate_long_0:SECRET:INT64}"]
+34 -> 36 [label = "t_73:{aggregate_long_0:SECRET:INT64}"]
+35 -> 36 [label = "t_75:{group_mark:PUBLIC:BOOL}"]
+36 -> 38 [label = "t_76:{group_mark:SECRET:INT64}"]
+36 -> 39 [label = "t_76:{group_mark:SECRET:INT64}"]
+36 -> 41 [label = "t_76:{group_mark:SECRET:INT64}"]
+36 -> 41 [label = "t_77:{group_mark:SECRET:INT64}"]
+36 -> 41 [label = "t_78:{aggregate_long_0:SECRET:INT64}"]
+36 -> 41 [label = "t_79:{aggregate_long_0:SECRET:INT64}"]
+37 -> 38 [label = "t_80:{constant_data:PUBLIC:INT64}"]
+38 -> 39 [label = "t_81:{constant_data:PUBLIC:INT64}"]
+39 -> 40 [label = "t_82:{GreaterEqual_out:SECRET:BOOL}"]
 4 -> 6 [label = "t_13:{join_long_0:PRIVATE:INT64}"]
 4 -> 9 [label = "t_10:{aggregate_long_0:PRIVATE:INT64}"]
 4 -> 9 [label = "t_11:{encrypt_long_0:PRIVATE:INT64}"]
 4 -> 9 [label = "t_12:{groupby_long_0:PRIVATE:INT64}"]
 4 -> 9 [label = "t_13:{join_long_0:PRIVATE:INT64}"]
-40 -> 41 [label = "t_80:{constant_data:PUBLIC:INT64}"]
-41 -> 42 [label = "t_81:{constant_data:PUBLIC:INT64}"]
-42 -> 43 [label = "t_82:{GreaterEqual_out:SECRET:BOOL}"]
-43 -> 44 [label = "t_83:{GreaterEqual_out:PUBLIC:BOOL}"]
-44 -> 45 [label = "t_84:{group_mark:SECRET:INT64}"]
-44 -> 46 [label = "t_85:{group_mark:SECRET:INT64}"]
-44 -> 47 [label = "t_86:{aggregate_long_0:SECRET:INT64}"]
-44 -> 48 [label = "t_87:{aggregate_long_0:SECRET:INT64}"]
-45 -> 49 [label = "t_88:{group_mark:PRIVATE:INT64}"]
-46 -> 49 [label = "t_90:{group_mark:PRIVATE:INT64}"]
-47 -> 49 [label = "t_92:{aggregate_long_0:PRIVATE:INT64}"]
-48 -> 49 [label = "t_94:{aggregate_long_0:PRIVATE:INT64}"]
+40 -> 41 [label = "t_83:{GreaterEqual_out:PUBLIC:BOOL}"]
+41 -> 42 [label = "t_84:{group_mark:SECRET:INT64}"]
+41 -> 43 [label = "t_85:{group_mark:SECRET:INT64}"]
+41 -> 44 [label = "t_86:{aggregate_long_0:SECRET:INT64}"]
+41 -> 45 [label = "t_87:{aggregate_long_0:SECRET:INT64}"]
+42 -> 46 [label = "t_88:{group_mark:PRIVATE:INT64}"]
+43 -> 46 [label = "t_90:{group_mark:PRIVATE:INT64}"]
+44 -> 46 [label = "t_92:{aggregate_long_0:PRIVATE:INT64}"]
+45 -> 46 [label = "t_94:{aggregate_long_0:PRIVATE:INT64}"]
 5 -> 10 [label = "t_14:{aggregate_long_0:PRIVATE:INT64}"]
 5 -> 10 [label = "t_15:{groupby_long_0:PRIVATE:INT64}"]
 5 -> 10 [label = "t_16:{groupby_string_0:PRIVATE:STRING}"]
@@ -397,25 +518,22 @@ var translateWithCCLTestCases = []sPair{
 19 [label="make_share:{in:[In:{t_23,},],out:[Out:{t_32,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
 20 [label="sort:{in:[In:{t_25,t_26,t_27,t_28,t_29,t_30,t_31,t_32,},Key:{t_24,},],out:[Out:{t_33,t_34,t_35,t_36,t_37,t_38,t_39,t_40,},],attr:[reverse:false,],url:[alice.com,bob.com,carol.com,]}"]
 21 [label="group_mark:{in:[Key:{t_33,},],out:[Group:{t_41,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-22 [label="count:{in:[Group:{t_41,},In:{t_41,},],out:[Out:{t_42,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-23 [label="sort:{in:[In:{t_37,},Key:{t_33,t_37,},],out:[Out:{t_43,},],attr:[reverse:false,],url:[alice.com,bob.com,carol.com,]}"]
-24 [label="group_mark:{in:[Key:{t_43,},],out:[Group:{t_44,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-25 [label="sum:{in:[Group:{t_41,},In:{t_44,},],out:[Out:{t_45,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-26 [label="sum:{in:[Group:{t_41,},In:{t_36,},],out:[Out:{t_46,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-27 [label="sum:{in:[Group:{t_41,},In:{t_39,},],out:[Out:{t_47,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-28 [label="shuffle:{in:[In:{t_42,t_45,t_46,t_47,t_41,},],out:[Out:{t_48,t_49,t_50,t_51,t_52,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-29 [label="make_public:{in:[In:{t_52,},],out:[Out:{t_53,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-30 [label="filter:{in:[Filter:{t_53,},In:{t_48,t_49,t_50,t_51,},],out:[Out:{t_54,t_55,t_56,t_57,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-31 [label="make_constant:{in:[],out:[Out:{t_58,},],attr:[scalar:4,to_status:1,],url:[alice.com,bob.com,carol.com,]}"]
-32 [label="broadcast:{in:[In:{t_58,},ShapeRefTensor:{t_54,},],out:[Out:{t_59,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-33 [label="GreaterEqual:{in:[Left:{t_54,},Right:{t_59,},],out:[Out:{t_60,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-34 [label="make_public:{in:[In:{t_60,},],out:[Out:{t_61,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-35 [label="apply_filter:{in:[Filter:{t_61,},In:{t_54,t_55,t_56,t_57,},],out:[Out:{t_62,t_63,t_64,t_65,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-36 [label="make_private:{in:[In:{t_62,},],out:[Out:{t_66,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-37 [label="make_private:{in:[In:{t_63,},],out:[Out:{t_68,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-38 [label="make_private:{in:[In:{t_64,},],out:[Out:{t_70,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-39 [label="make_private:{in:[In:{t_65,},],out:[Out:{t_72,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-40 [label="publish:{in:[In:{t_66,t_68,t_70,t_72,},],out:[Out:{t_67,t_69,t_71,t_73,},],attr:[],url:[alice.com,]}"]
+22 [label="sort:{in:[In:{t_37,},Key:{t_33,t_37,},],out:[Out:{t_42,},],attr:[reverse:false,],url:[alice.com,bob.com,carol.com,]}"]
+23 [label="group_mark:{in:[Key:{t_42,},],out:[Group:{t_43,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+24 [label="oblivious_group_agg:{in:[Group:{t_41,},In:{t_41,t_43,t_36,t_39,},],out:[Out:{t_44,t_45,t_46,t_47,},],attr:[agg_funcs:[count sum sum sum],],url:[alice.com,bob.com,carol.com,]}"]
+25 [label="shuffle:{in:[In:{t_44,t_45,t_46,t_47,t_41,},],out:[Out:{t_48,t_49,t_50,t_51,t_52,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+26 [label="make_public:{in:[In:{t_52,},],out:[Out:{t_53,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+27 [label="filter:{in:[Filter:{t_53,},In:{t_48,t_49,t_50,t_51,},],out:[Out:{t_54,t_55,t_56,t_57,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+28 [label="make_constant:{in:[],out:[Out:{t_58,},],attr:[scalar:4,to_status:1,],url:[alice.com,bob.com,carol.com,]}"]
+29 [label="broadcast:{in:[In:{t_58,},ShapeRefTensor:{t_54,},],out:[Out:{t_59,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+30 [label="GreaterEqual:{in:[Left:{t_54,},Right:{t_59,},],out:[Out:{t_60,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+31 [label="make_public:{in:[In:{t_60,},],out:[Out:{t_61,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+32 [label="apply_filter:{in:[Filter:{t_61,},In:{t_54,t_55,t_56,t_57,},],out:[Out:{t_62,t_63,t_64,t_65,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+33 [label="make_private:{in:[In:{t_62,},],out:[Out:{t_66,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+34 [label="make_private:{in:[In:{t_63,},],out:[Out:{t_68,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+35 [label="make_private:{in:[In:{t_64,},],out:[Out:{t_70,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+36 [label="make_private:{in:[In:{t_65,},],out:[Out:{t_72,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+37 [label="publish:{in:[In:{t_66,t_68,t_70,t_72,},],out:[Out:{t_67,t_69,t_71,t_73,},],attr:[],url:[alice.com,]}"]
 0 -> 2 [label = "t_1:{join_long_0:PRIVATE:INT64}"]
 0 -> 3 [label = "t_0:{groupby_long_0:PRIVATE:INT64}"]
 0 -> 3 [label = "t_1:{join_long_0:PRIVATE:INT64}"]
@@ -437,49 +555,46 @@ var translateWithCCLTestCases = []sPair{
 2 -> 3 [label = "t_5:{join_long_0:PRIVATE:INT64}"]
 2 -> 4 [label = "t_6:{join_long_0:PRIVATE:INT64}"]
 20 -> 21 [label = "t_33:{groupby_long_0:SECRET:INT64}"]
-20 -> 23 [label = "t_33:{groupby_long_0:SECRET:INT64}"]
-20 -> 23 [label = "t_37:{encrypt_long_0:SECRET:INT64}"]
-20 -> 23 [label = "t_37:{encrypt_long_0:SECRET:INT64}"]
-20 -> 26 [label = "t_36:{aggregate_long_0:SECRET:INT64}"]
-20 -> 27 [label = "t_39:{aggregate_long_0:SECRET:INT64}"]
-21 -> 22 [label = "t_41:{group_mark:SECRET:BOOL}"]
-21 -> 22 [label = "t_41:{group_mark:SECRET:BOOL}"]
+20 -> 22 [label = "t_33:{groupby_long_0:SECRET:INT64}"]
+20 -> 22 [label = "t_37:{encrypt_long_0:SECRET:INT64}"]
+20 -> 22 [label = "t_37:{encrypt_long_0:SECRET:INT64}"]
+20 -> 24 [label = "t_36:{aggregate_long_0:SECRET:INT64}"]
+20 -> 24 [label = "t_39:{aggregate_long_0:SECRET:INT64}"]
+21 -> 24 [label = "t_41:{group_mark:SECRET:BOOL}"]
+21 -> 24 [label = "t_41:{group_mark:SECRET:BOOL}"]
 21 -> 25 [label = "t_41:{group_mark:SECRET:BOOL}"]
-21 -> 26 [label = "t_41:{group_mark:SECRET:BOOL}"]
-21 -> 27 [label = "t_41:{group_mark:SECRET:BOOL}"]
-21 -> 28 [label = "t_41:{group_mark:SECRET:BOOL}"]
-22 -> 28 [label = "t_42:{group_mark:SECRET:INT64}"]
-23 -> 24 [label = "t_43:{encrypt_long_0:SECRET:INT64}"]
-24 -> 25 [label = "t_44:{group_mark:SECRET:BOOL}"]
-25 -> 28 [label = "t_45:{group_mark:SECRET:INT64}"]
-26 -> 28 [label = "t_46:{aggregate_long_0:SECRET:INT64}"]
-27 -> 28 [label = "t_47:{aggregate_long_0:SECRET:INT64}"]
-28 -> 29 [label = "t_52:{group_mark:SECRET:BOOL}"]
-28 -> 30 [label = "t_48:{group_mark:SECRET:INT64}"]
-28 -> 30 [label = "t_49:{group_mark:SECRET:INT64}"]
-28 -> 30 [label = "t_50:{aggregate_long_0:SECRET:INT64}"]
-28 -> 30 [label = "t_51:{aggregate_long_0:SECRET:INT64}"]
-29 -> 30 [label = "t_53:{group_mark:PUBLIC:BOOL}"]
+22 -> 23 [label = "t_42:{encrypt_long_0:SECRET:INT64}"]
+23 -> 24 [label = "t_43:{group_mark:SECRET:BOOL}"]
+24 -> 25 [label = "t_44:{group_mark:SECRET:INT64}"]
+24 -> 25 [label = "t_45:{group_mark:SECRET:INT64}"]
+24 -> 25 [label = "t_46:{aggregate_long_0:SECRET:INT64}"]
+24 -> 25 [label = "t_47:{aggregate_long_0:SECRET:INT64}"]
+25 -> 26 [label = "t_52:{group_mark:SECRET:BOOL}"]
+25 -> 27 [label = "t_48:{group_mark:SECRET:INT64}"]
+25 -> 27 [label = "t_49:{group_mark:SECRET:INT64}"]
+25 -> 27 [label = "t_50:{aggregate_long_0:SECRET:INT64}"]
+25 -> 27 [label = "t_51:{aggregate_long_0:SECRET:INT64}"]
+26 -> 27 [label = "t_53:{group_mark:PUBLIC:BOOL}"]
+27 -> 29 [label = "t_54:{group_mark:SECRET:INT64}"]
+27 -> 30 [label = "t_54:{group_mark:SECRET:INT64}"]
+27 -> 32 [label = "t_54:{group_mark:SECRET:INT64}"]
+27 -> 32 [label = "t_55:{group_mark:SECRET:INT64}"]
+27 -> 32 [label = "t_56:{aggregate_long_0:SECRET:INT64}"]
+27 -> 32 [label = "t_57:{aggregate_long_0:SECRET:INT64}"]
+28 -> 29 [label = "t_58:{constant_data:PUBLIC:INT64}"]
+29 -> 30 [label = "t_59:{constant_data:PUBLIC:INT64}"]
 3 -> 8 [label = "t_7:{groupby_long_0:PRIVATE:INT64}"]
 3 -> 8 [label = "t_8:{join_long_0:PRIVATE:INT64}"]
-30 -> 32 [label = "t_54:{group_mark:SECRET:INT64}"]
-30 -> 33 [label = "t_54:{group_mark:SECRET:INT64}"]
-30 -> 35 [label = "t_54:{group_mark:SECRET:INT64}"]
-30 -> 35 [label = "t_55:{group_mark:SECRET:INT64}"]
-30 -> 35 [label = "t_56:{aggregate_long_0:SECRET:INT64}"]
-30 -> 35 [label = "t_57:{aggregate_long_0:SECRET:INT64}"]
-31 -> 32 [label = "t_58:{constant_data:PUBLIC:INT64}"]
-32 -> 33 [label = "t_59:{constant_data:PUBLIC:INT64}"]
-33 -> 34 [label = "t_60:{GreaterEqual_out:SECRET:BOOL}"]
-34 -> 35 [label = "t_61:{GreaterEqual_out:PUBLIC:BOOL}"]
-35 -> 36 [label = "t_62:{group_mark:SECRET:INT64}"]
-35 -> 37 [label = "t_63:{group_mark:SECRET:INT64}"]
-35 -> 38 [label = "t_64:{aggregate_long_0:SECRET:INT64}"]
-35 -> 39 [label = "t_65:{aggregate_long_0:SECRET:INT64}"]
-36 -> 40 [label = "t_66:{group_mark:PRIVATE:INT64}"]
-37 -> 40 [label = "t_68:{group_mark:PRIVATE:INT64}"]
-38 -> 40 [label = "t_70:{aggregate_long_0:PRIVATE:INT64}"]
-39 -> 40 [label = "t_72:{aggregate_long_0:PRIVATE:INT64}"]
+30 -> 31 [label = "t_60:{GreaterEqual_out:SECRET:BOOL}"]
+31 -> 32 [label = "t_61:{GreaterEqual_out:PUBLIC:BOOL}"]
+32 -> 33 [label = "t_62:{group_mark:SECRET:INT64}"]
+32 -> 34 [label = "t_63:{group_mark:SECRET:INT64}"]
+32 -> 35 [label = "t_64:{aggregate_long_0:SECRET:INT64}"]
+32 -> 36 [label = "t_65:{aggregate_long_0:SECRET:INT64}"]
+33 -> 37 [label = "t_66:{group_mark:PRIVATE:INT64}"]
+34 -> 37 [label = "t_68:{group_mark:PRIVATE:INT64}"]
+35 -> 37 [label = "t_70:{aggregate_long_0:PRIVATE:INT64}"]
+36 -> 37 [label = "t_72:{aggregate_long_0:PRIVATE:INT64}"]
 4 -> 6 [label = "t_11:{join_long_0:PRIVATE:INT64}"]
 4 -> 9 [label = "t_10:{encrypt_long_0:PRIVATE:INT64}"]
 4 -> 9 [label = "t_11:{join_long_0:PRIVATE:INT64}"]
@@ -673,24 +788,21 @@ var translateWithCCLTestCases = []sPair{
 8 [label="make_share:{in:[In:{t_5,},],out:[Out:{t_9,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
 9 [label="sort:{in:[In:{t_7,t_8,t_9,},Key:{t_6,},],out:[Out:{t_10,t_11,t_12,},],attr:[reverse:false,],url:[alice.com,bob.com,carol.com,]}"]
 10 [label="group_mark:{in:[Key:{t_10,},],out:[Group:{t_13,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-11 [label="count:{in:[Group:{t_13,},In:{t_13,},],out:[Out:{t_14,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-12 [label="sum:{in:[Group:{t_13,},In:{t_11,},],out:[Out:{t_15,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-13 [label="max:{in:[Group:{t_13,},In:{t_11,},],out:[Out:{t_16,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-14 [label="min:{in:[Group:{t_13,},In:{t_11,},],out:[Out:{t_17,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-15 [label="shuffle:{in:[In:{t_14,t_15,t_16,t_17,t_11,t_13,},],out:[Out:{t_18,t_19,t_20,t_21,t_22,t_23,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-16 [label="make_public:{in:[In:{t_23,},],out:[Out:{t_24,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-17 [label="filter:{in:[Filter:{t_24,},In:{t_18,t_19,t_20,t_21,t_22,},],out:[Out:{t_25,t_26,t_27,t_28,t_29,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-18 [label="make_constant:{in:[],out:[Out:{t_30,},],attr:[scalar:4,to_status:1,],url:[alice.com,bob.com,carol.com,]}"]
-19 [label="broadcast:{in:[In:{t_30,},ShapeRefTensor:{t_25,},],out:[Out:{t_31,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-20 [label="GreaterEqual:{in:[Left:{t_25,},Right:{t_31,},],out:[Out:{t_32,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-21 [label="make_public:{in:[In:{t_32,},],out:[Out:{t_33,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-22 [label="apply_filter:{in:[Filter:{t_33,},In:{t_29,t_25,t_26,t_27,t_28,},],out:[Out:{t_34,t_35,t_36,t_37,t_38,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-23 [label="make_private:{in:[In:{t_34,},],out:[Out:{t_39,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-24 [label="make_private:{in:[In:{t_35,},],out:[Out:{t_41,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-25 [label="make_private:{in:[In:{t_36,},],out:[Out:{t_43,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-26 [label="make_private:{in:[In:{t_37,},],out:[Out:{t_45,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-27 [label="make_private:{in:[In:{t_38,},],out:[Out:{t_47,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-28 [label="publish:{in:[In:{t_39,t_41,t_43,t_45,t_47,},],out:[Out:{t_40,t_42,t_44,t_46,t_48,},],attr:[],url:[alice.com,]}"]
+11 [label="oblivious_group_agg:{in:[Group:{t_13,},In:{t_13,t_11,t_11,t_11,},],out:[Out:{t_14,t_15,t_16,t_17,},],attr:[agg_funcs:[count sum max min],],url:[alice.com,bob.com,carol.com,]}"]
+12 [label="shuffle:{in:[In:{t_14,t_15,t_16,t_17,t_11,t_13,},],out:[Out:{t_18,t_19,t_20,t_21,t_22,t_23,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+13 [label="make_public:{in:[In:{t_23,},],out:[Out:{t_24,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+14 [label="filter:{in:[Filter:{t_24,},In:{t_18,t_19,t_20,t_21,t_22,},],out:[Out:{t_25,t_26,t_27,t_28,t_29,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+15 [label="make_constant:{in:[],out:[Out:{t_30,},],attr:[scalar:4,to_status:1,],url:[alice.com,bob.com,carol.com,]}"]
+16 [label="broadcast:{in:[In:{t_30,},ShapeRefTensor:{t_25,},],out:[Out:{t_31,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+17 [label="GreaterEqual:{in:[Left:{t_25,},Right:{t_31,},],out:[Out:{t_32,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+18 [label="make_public:{in:[In:{t_32,},],out:[Out:{t_33,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+19 [label="apply_filter:{in:[Filter:{t_33,},In:{t_29,t_25,t_26,t_27,t_28,},],out:[Out:{t_34,t_35,t_36,t_37,t_38,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+20 [label="make_private:{in:[In:{t_34,},],out:[Out:{t_39,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+21 [label="make_private:{in:[In:{t_35,},],out:[Out:{t_41,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+22 [label="make_private:{in:[In:{t_36,},],out:[Out:{t_43,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+23 [label="make_private:{in:[In:{t_37,},],out:[Out:{t_45,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+24 [label="make_private:{in:[In:{t_38,},],out:[Out:{t_47,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+25 [label="publish:{in:[In:{t_39,t_41,t_43,t_45,t_47,},],out:[Out:{t_40,t_42,t_44,t_46,t_48,},],attr:[],url:[alice.com,]}"]
 0 -> 2 [label = "t_0:{plain_long_0:PRIVATE:INT64}"]
 0 -> 3 [label = "t_0:{plain_long_0:PRIVATE:INT64}"]
 1 -> 2 [label = "t_1:{plain_long_0:PRIVATE:INT64}"]
@@ -698,43 +810,40 @@ var translateWithCCLTestCases = []sPair{
 10 -> 11 [label = "t_13:{group_mark:SECRET:BOOL}"]
 10 -> 11 [label = "t_13:{group_mark:SECRET:BOOL}"]
 10 -> 12 [label = "t_13:{group_mark:SECRET:BOOL}"]
-10 -> 13 [label = "t_13:{group_mark:SECRET:BOOL}"]
-10 -> 14 [label = "t_13:{group_mark:SECRET:BOOL}"]
-10 -> 15 [label = "t_13:{group_mark:SECRET:BOOL}"]
-11 -> 15 [label = "t_14:{group_mark:SECRET:INT64}"]
-12 -> 15 [label = "t_15:{plain_long_0:SECRET:INT64}"]
-13 -> 15 [label = "t_16:{plain_long_0:SECRET:INT64}"]
-14 -> 15 [label = "t_17:{plain_long_0:SECRET:INT64}"]
-15 -> 16 [label = "t_23:{group_mark:SECRET:BOOL}"]
-15 -> 17 [label = "t_18:{group_mark:SECRET:INT64}"]
-15 -> 17 [label = "t_19:{plain_long_0:SECRET:INT64}"]
-15 -> 17 [label = "t_20:{plain_long_0:SECRET:INT64}"]
-15 -> 17 [label = "t_21:{plain_long_0:SECRET:INT64}"]
-15 -> 17 [label = "t_22:{plain_long_0:SECRET:INT64}"]
-16 -> 17 [label = "t_24:{group_mark:PUBLIC:BOOL}"]
-17 -> 19 [label = "t_25:{group_mark:SECRET:INT64}"]
-17 -> 20 [label = "t_25:{group_mark:SECRET:INT64}"]
-17 -> 22 [label = "t_25:{group_mark:SECRET:INT64}"]
-17 -> 22 [label = "t_26:{plain_long_0:SECRET:INT64}"]
-17 -> 22 [label = "t_27:{plain_long_0:SECRET:INT64}"]
-17 -> 22 [label = "t_28:{plain_long_0:SECRET:INT64}"]
-17 -> 22 [label = "t_29:{plain_long_0:SECRET:INT64}"]
-18 -> 19 [label = "t_30:{constant_data:PUBLIC:INT64}"]
-19 -> 20 [label = "t_31:{constant_data:PUBLIC:INT64}"]
+11 -> 12 [label = "t_14:{group_mark:SECRET:INT64}"]
+11 -> 12 [label = "t_15:{plain_long_0:SECRET:INT64}"]
+11 -> 12 [label = "t_16:{plain_long_0:SECRET:INT64}"]
+11 -> 12 [label = "t_17:{plain_long_0:SECRET:INT64}"]
+12 -> 13 [label = "t_23:{group_mark:SECRET:BOOL}"]
+12 -> 14 [label = "t_18:{group_mark:SECRET:INT64}"]
+12 -> 14 [label = "t_19:{plain_long_0:SECRET:INT64}"]
+12 -> 14 [label = "t_20:{plain_long_0:SECRET:INT64}"]
+12 -> 14 [label = "t_21:{plain_long_0:SECRET:INT64}"]
+12 -> 14 [label = "t_22:{plain_long_0:SECRET:INT64}"]
+13 -> 14 [label = "t_24:{group_mark:PUBLIC:BOOL}"]
+14 -> 16 [label = "t_25:{group_mark:SECRET:INT64}"]
+14 -> 17 [label = "t_25:{group_mark:SECRET:INT64}"]
+14 -> 19 [label = "t_25:{group_mark:SECRET:INT64}"]
+14 -> 19 [label = "t_26:{plain_long_0:SECRET:INT64}"]
+14 -> 19 [label = "t_27:{plain_long_0:SECRET:INT64}"]
+14 -> 19 [label = "t_28:{plain_long_0:SECRET:INT64}"]
+14 -> 19 [label = "t_29:{plain_long_0:SECRET:INT64}"]
+15 -> 16 [label = "t_30:{constant_data:PUBLIC:INT64}"]
+16 -> 17 [label = "t_31:{constant_data:PUBLIC:INT64}"]
+17 -> 18 [label = "t_32:{GreaterEqual_out:SECRET:BOOL}"]
+18 -> 19 [label = "t_33:{GreaterEqual_out:PUBLIC:BOOL}"]
+19 -> 20 [label = "t_34:{plain_long_0:SECRET:INT64}"]
+19 -> 21 [label = "t_35:{group_mark:SECRET:INT64}"]
+19 -> 22 [label = "t_36:{plain_long_0:SECRET:INT64}"]
+19 -> 23 [label = "t_37:{plain_long_0:SECRET:INT64}"]
+19 -> 24 [label = "t_38:{plain_long_0:SECRET:INT64}"]
 2 -> 3 [label = "t_2:{plain_long_0:PRIVATE:INT64}"]
 2 -> 4 [label = "t_3:{plain_long_0:PRIVATE:INT64}"]
-20 -> 21 [label = "t_32:{GreaterEqual_out:SECRET:BOOL}"]
-21 -> 22 [label = "t_33:{GreaterEqual_out:PUBLIC:BOOL}"]
-22 -> 23 [label = "t_34:{plain_long_0:SECRET:INT64}"]
-22 -> 24 [label = "t_35:{group_mark:SECRET:INT64}"]
-22 -> 25 [label = "t_36:{plain_long_0:SECRET:INT64}"]
-22 -> 26 [label = "t_37:{plain_long_0:SECRET:INT64}"]
-22 -> 27 [label = "t_38:{plain_long_0:SECRET:INT64}"]
-23 -> 28 [label = "t_39:{plain_long_0:PRIVATE:INT64}"]
-24 -> 28 [label = "t_41:{group_mark:PRIVATE:INT64}"]
-25 -> 28 [label = "t_43:{plain_long_0:PRIVATE:INT64}"]
-26 -> 28 [label = "t_45:{plain_long_0:PRIVATE:INT64}"]
-27 -> 28 [label = "t_47:{plain_long_0:PRIVATE:INT64}"]
+20 -> 25 [label = "t_39:{plain_long_0:PRIVATE:INT64}"]
+21 -> 25 [label = "t_41:{group_mark:PRIVATE:INT64}"]
+22 -> 25 [label = "t_43:{plain_long_0:PRIVATE:INT64}"]
+23 -> 25 [label = "t_45:{plain_long_0:PRIVATE:INT64}"]
+24 -> 25 [label = "t_47:{plain_long_0:PRIVATE:INT64}"]
 3 -> 5 [label = "t_4:{plain_long_0:PRIVATE:INT64}"]
 3 -> 6 [label = "t_4:{plain_long_0:PRIVATE:INT64}"]
 3 -> 7 [label = "t_4:{plain_long_0:PRIVATE:INT64}"]
@@ -744,10 +853,10 @@ var translateWithCCLTestCases = []sPair{
 7 -> 9 [label = "t_8:{plain_long_0:SECRET:INT64}"]
 8 -> 9 [label = "t_9:{plain_long_0:SECRET:INT64}"]
 9 -> 10 [label = "t_10:{plain_long_0:SECRET:INT64}"]
+9 -> 11 [label = "t_11:{plain_long_0:SECRET:INT64}"]
+9 -> 11 [label = "t_11:{plain_long_0:SECRET:INT64}"]
+9 -> 11 [label = "t_11:{plain_long_0:SECRET:INT64}"]
 9 -> 12 [label = "t_11:{plain_long_0:SECRET:INT64}"]
-9 -> 13 [label = "t_11:{plain_long_0:SECRET:INT64}"]
-9 -> 14 [label = "t_11:{plain_long_0:SECRET:INT64}"]
-9 -> 15 [label = "t_11:{plain_long_0:SECRET:INT64}"]
 }`},
 	{`select ta.groupby_long_0, count(distinct(ta.compare_long_0)), sum(ta.compare_long_0) as b, max(ta.compare_long_0) as a, min(ta.compare_long_0) as d from alice.tbl_0 as ta join bob.tbl_0 as tb on ta.plain_long_0 = tb.plain_long_0 group by ta.groupby_long_0`, `digraph G {
 0 [label="runsql:{in:[],out:[Out:{t_0,t_1,t_2,},],attr:[sql:select compare_long_0,groupby_long_0,plain_long_0 from alice.tbl_0,table_refs:[alice.tbl_0],],url:[alice.com,]}"]
@@ -765,25 +874,21 @@ var translateWithCCLTestCases = []sPair{
 12 [label="group_mark:{in:[Key:{t_16,},],out:[Group:{t_21,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
 13 [label="sort:{in:[In:{t_17,},Key:{t_16,t_17,},],out:[Out:{t_22,},],attr:[reverse:false,],url:[alice.com,bob.com,carol.com,]}"]
 14 [label="group_mark:{in:[Key:{t_22,},],out:[Group:{t_23,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-15 [label="sum:{in:[Group:{t_21,},In:{t_23,},],out:[Out:{t_24,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-16 [label="sum:{in:[Group:{t_21,},In:{t_17,},],out:[Out:{t_25,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-17 [label="max:{in:[Group:{t_21,},In:{t_17,},],out:[Out:{t_26,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-18 [label="min:{in:[Group:{t_21,},In:{t_17,},],out:[Out:{t_27,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-19 [label="count:{in:[Group:{t_21,},In:{t_21,},],out:[Out:{t_28,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-20 [label="shuffle:{in:[In:{t_24,t_25,t_26,t_27,t_18,t_28,t_21,},],out:[Out:{t_29,t_30,t_31,t_32,t_33,t_34,t_35,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-21 [label="make_public:{in:[In:{t_35,},],out:[Out:{t_36,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-22 [label="filter:{in:[Filter:{t_36,},In:{t_29,t_30,t_31,t_32,t_33,t_34,},],out:[Out:{t_37,t_38,t_39,t_40,t_41,t_42,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-23 [label="make_constant:{in:[],out:[Out:{t_43,},],attr:[scalar:4,to_status:1,],url:[alice.com,bob.com,carol.com,]}"]
-24 [label="broadcast:{in:[In:{t_43,},ShapeRefTensor:{t_42,},],out:[Out:{t_44,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-25 [label="GreaterEqual:{in:[Left:{t_42,},Right:{t_44,},],out:[Out:{t_45,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-26 [label="make_public:{in:[In:{t_45,},],out:[Out:{t_46,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-27 [label="apply_filter:{in:[Filter:{t_46,},In:{t_41,t_37,t_38,t_39,t_40,t_42,},],out:[Out:{t_47,t_48,t_49,t_50,t_51,t_52,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
-28 [label="make_private:{in:[In:{t_47,},],out:[Out:{t_53,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-29 [label="make_private:{in:[In:{t_48,},],out:[Out:{t_55,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-30 [label="make_private:{in:[In:{t_49,},],out:[Out:{t_57,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-31 [label="make_private:{in:[In:{t_50,},],out:[Out:{t_59,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-32 [label="make_private:{in:[In:{t_51,},],out:[Out:{t_61,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
-33 [label="publish:{in:[In:{t_53,t_55,t_57,t_59,t_61,},],out:[Out:{t_54,t_56,t_58,t_60,t_62,},],attr:[],url:[alice.com,]}"]
+15 [label="oblivious_group_agg:{in:[Group:{t_21,},In:{t_23,t_17,t_17,t_17,t_21,},],out:[Out:{t_24,t_25,t_26,t_27,t_28,},],attr:[agg_funcs:[sum sum max min count],],url:[alice.com,bob.com,carol.com,]}"]
+16 [label="shuffle:{in:[In:{t_24,t_25,t_26,t_27,t_18,t_28,t_21,},],out:[Out:{t_29,t_30,t_31,t_32,t_33,t_34,t_35,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+17 [label="make_public:{in:[In:{t_35,},],out:[Out:{t_36,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+18 [label="filter:{in:[Filter:{t_36,},In:{t_29,t_30,t_31,t_32,t_33,t_34,},],out:[Out:{t_37,t_38,t_39,t_40,t_41,t_42,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+19 [label="make_constant:{in:[],out:[Out:{t_43,},],attr:[scalar:4,to_status:1,],url:[alice.com,bob.com,carol.com,]}"]
+20 [label="broadcast:{in:[In:{t_43,},ShapeRefTensor:{t_42,},],out:[Out:{t_44,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+21 [label="GreaterEqual:{in:[Left:{t_42,},Right:{t_44,},],out:[Out:{t_45,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+22 [label="make_public:{in:[In:{t_45,},],out:[Out:{t_46,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+23 [label="apply_filter:{in:[Filter:{t_46,},In:{t_41,t_37,t_38,t_39,t_40,t_42,},],out:[Out:{t_47,t_48,t_49,t_50,t_51,t_52,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+24 [label="make_private:{in:[In:{t_47,},],out:[Out:{t_53,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+25 [label="make_private:{in:[In:{t_48,},],out:[Out:{t_55,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+26 [label="make_private:{in:[In:{t_49,},],out:[Out:{t_57,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+27 [label="make_private:{in:[In:{t_50,},],out:[Out:{t_59,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+28 [label="make_private:{in:[In:{t_51,},],out:[Out:{t_61,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+29 [label="publish:{in:[In:{t_53,t_55,t_57,t_59,t_61,},],out:[Out:{t_54,t_56,t_58,t_60,t_62,},],attr:[],url:[alice.com,]}"]
 0 -> 2 [label = "t_2:{plain_long_0:PRIVATE:INT64}"]
 0 -> 3 [label = "t_0:{compare_long_0:PRIVATE:INT64}"]
 0 -> 3 [label = "t_1:{groupby_long_0:PRIVATE:INT64}"]
@@ -795,61 +900,146 @@ var translateWithCCLTestCases = []sPair{
 11 -> 13 [label = "t_16:{groupby_long_0:SECRET:INT64}"]
 11 -> 13 [label = "t_17:{compare_long_0:SECRET:INT64}"]
 11 -> 13 [label = "t_17:{compare_long_0:SECRET:INT64}"]
-11 -> 16 [label = "t_17:{compare_long_0:SECRET:INT64}"]
-11 -> 17 [label = "t_17:{compare_long_0:SECRET:INT64}"]
-11 -> 18 [label = "t_17:{compare_long_0:SECRET:INT64}"]
-11 -> 20 [label = "t_18:{groupby_long_0:SECRET:INT64}"]
+11 -> 15 [label = "t_17:{compare_long_0:SECRET:INT64}"]
+11 -> 15 [label = "t_17:{compare_long_0:SECRET:INT64}"]
+11 -> 15 [label = "t_17:{compare_long_0:SECRET:INT64}"]
+11 -> 16 [label = "t_18:{groupby_long_0:SECRET:INT64}"]
+12 -> 15 [label = "t_21:{group_mark:SECRET:BOOL}"]
 12 -> 15 [label = "t_21:{group_mark:SECRET:BOOL}"]
 12 -> 16 [label = "t_21:{group_mark:SECRET:BOOL}"]
-12 -> 17 [label = "t_21:{group_mark:SECRET:BOOL}"]
-12 -> 18 [label = "t_21:{group_mark:SECRET:BOOL}"]
-12 -> 19 [label = "t_21:{group_mark:SECRET:BOOL}"]
-12 -> 19 [label = "t_21:{group_mark:SECRET:BOOL}"]
-12 -> 20 [label = "t_21:{group_mark:SECRET:BOOL}"]
 13 -> 14 [label = "t_22:{compare_long_0:SECRET:INT64}"]
 14 -> 15 [label = "t_23:{group_mark:SECRET:BOOL}"]
-15 -> 20 [label = "t_24:{group_mark:SECRET:INT64}"]
-16 -> 20 [label = "t_25:{compare_long_0:SECRET:INT64}"]
-17 -> 20 [label = "t_26:{compare_long_0:SECRET:INT64}"]
-18 -> 20 [label = "t_27:{compare_long_0:SECRET:INT64}"]
-19 -> 20 [label = "t_28:{group_mark:SECRET:INT64}"]
+15 -> 16 [label = "t_24:{group_mark:SECRET:INT64}"]
+15 -> 16 [label = "t_25:{compare_long_0:SECRET:INT64}"]
+15 -> 16 [label = "t_26:{compare_long_0:SECRET:INT64}"]
+15 -> 16 [label = "t_27:{compare_long_0:SECRET:INT64}"]
+15 -> 16 [label = "t_28:{group_mark:SECRET:INT64}"]
+16 -> 17 [label = "t_35:{group_mark:SECRET:BOOL}"]
+16 -> 18 [label = "t_29:{group_mark:SECRET:INT64}"]
+16 -> 18 [label = "t_30:{compare_long_0:SECRET:INT64}"]
+16 -> 18 [label = "t_31:{compare_long_0:SECRET:INT64}"]
+16 -> 18 [label = "t_32:{compare_long_0:SECRET:INT64}"]
+16 -> 18 [label = "t_33:{groupby_long_0:SECRET:INT64}"]
+16 -> 18 [label = "t_34:{group_mark:SECRET:INT64}"]
+17 -> 18 [label = "t_36:{group_mark:PUBLIC:BOOL}"]
+18 -> 20 [label = "t_42:{group_mark:SECRET:INT64}"]
+18 -> 21 [label = "t_42:{group_mark:SECRET:INT64}"]
+18 -> 23 [label = "t_37:{group_mark:SECRET:INT64}"]
+18 -> 23 [label = "t_38:{compare_long_0:SECRET:INT64}"]
+18 -> 23 [label = "t_39:{compare_long_0:SECRET:INT64}"]
+18 -> 23 [label = "t_40:{compare_long_0:SECRET:INT64}"]
+18 -> 23 [label = "t_41:{groupby_long_0:SECRET:INT64}"]
+18 -> 23 [label = "t_42:{group_mark:SECRET:INT64}"]
+19 -> 20 [label = "t_43:{constant_data:PUBLIC:INT64}"]
 2 -> 3 [label = "t_4:{plain_long_0:PRIVATE:INT64}"]
 2 -> 4 [label = "t_5:{plain_long_0:PRIVATE:INT64}"]
-20 -> 21 [label = "t_35:{group_mark:SECRET:BOOL}"]
-20 -> 22 [label = "t_29:{group_mark:SECRET:INT64}"]
-20 -> 22 [label = "t_30:{compare_long_0:SECRET:INT64}"]
-20 -> 22 [label = "t_31:{compare_long_0:SECRET:INT64}"]
-20 -> 22 [label = "t_32:{compare_long_0:SECRET:INT64}"]
-20 -> 22 [label = "t_33:{groupby_long_0:SECRET:INT64}"]
-20 -> 22 [label = "t_34:{group_mark:SECRET:INT64}"]
-21 -> 22 [label = "t_36:{group_mark:PUBLIC:BOOL}"]
-22 -> 24 [label = "t_42:{group_mark:SECRET:INT64}"]
-22 -> 25 [label = "t_42:{group_mark:SECRET:INT64}"]
-22 -> 27 [label = "t_37:{group_mark:SECRET:INT64}"]
-22 -> 27 [label = "t_38:{compare_long_0:SECRET:INT64}"]
-22 -> 27 [label = "t_39:{compare_long_0:SECRET:INT64}"]
-22 -> 27 [label = "t_40:{compare_long_0:SECRET:INT64}"]
-22 -> 27 [label = "t_41:{groupby_long_0:SECRET:INT64}"]
-22 -> 27 [label = "t_42:{group_mark:SECRET:INT64}"]
-23 -> 24 [label = "t_43:{constant_data:PUBLIC:INT64}"]
-24 -> 25 [label = "t_44:{constant_data:PUBLIC:INT64}"]
-25 -> 26 [label = "t_45:{GreaterEqual_out:SECRET:BOOL}"]
-26 -> 27 [label = "t_46:{GreaterEqual_out:PUBLIC:BOOL}"]
-27 -> 28 [label = "t_47:{groupby_long_0:SECRET:INT64}"]
-27 -> 29 [label = "t_48:{group_mark:SECRET:INT64}"]
-27 -> 30 [label = "t_49:{compare_long_0:SECRET:INT64}"]
-27 -> 31 [label = "t_50:{compare_long_0:SECRET:INT64}"]
-27 -> 32 [label = "t_51:{compare_long_0:SECRET:INT64}"]
-28 -> 33 [label = "t_53:{groupby_long_0:PRIVATE:INT64}"]
-29 -> 33 [label = "t_55:{group_mark:PRIVATE:INT64}"]
+20 -> 21 [label = "t_44:{constant_data:PUBLIC:INT64}"]
+21 -> 22 [label = "t_45:{GreaterEqual_out:SECRET:BOOL}"]
+22 -> 23 [label = "t_46:{GreaterEqual_out:PUBLIC:BOOL}"]
+23 -> 24 [label = "t_47:{groupby_long_0:SECRET:INT64}"]
+23 -> 25 [label = "t_48:{group_mark:SECRET:INT64}"]
+23 -> 26 [label = "t_49:{compare_long_0:SECRET:INT64}"]
+23 -> 27 [label = "t_50:{compare_long_0:SECRET:INT64}"]
+23 -> 28 [label = "t_51:{compare_long_0:SECRET:INT64}"]
+24 -> 29 [label = "t_53:{groupby_long_0:PRIVATE:INT64}"]
+25 -> 29 [label = "t_55:{group_mark:PRIVATE:INT64}"]
+26 -> 29 [label = "t_57:{compare_long_0:PRIVATE:INT64}"]
+27 -> 29 [label = "t_59:{compare_long_0:PRIVATE:INT64}"]
+28 -> 29 [label = "t_61:{compare_long_0:PRIVATE:INT64}"]
+3 -> 5 [label = "t_7:{groupby_long_0:PRIVATE:INT64}"]
+3 -> 6 [label = "t_7:{groupby_long_0:PRIVATE:INT64}"]
+3 -> 7 [label = "t_6:{compare_long_0:PRIVATE:INT64}"]
+3 -> 8 [label = "t_7:{groupby_long_0:PRIVATE:INT64}"]
+3 -> 9 [label = "t_8:{plain_long_0:PRIVATE:INT64}"]
+4 -> 10 [label = "t_9:{plain_long_0:PRIVATE:INT64}"]
+5 -> 11 [label = "t_10:{groupby_long_0:SECRET:INT64}"]
+6 -> 11 [label = "t_11:{groupby_long_0:SECRET:INT64}"]
+7 -> 11 [label = "t_12:{compare_long_0:SECRET:INT64}"]
+8 -> 11 [label = "t_13:{groupby_long_0:SECRET:INT64}"]
+9 -> 11 [label = "t_14:{plain_long_0:SECRET:INT64}"]
+}`},
+	{`select ta.groupby_long_0, count(distinct(ta.compare_long_0)) as cd, avg(ta.compare_long_0) as a, count(*) as c from alice.tbl_0 as ta join bob.tbl_0 as tb on ta.plain_long_0 = tb.plain_long_0 group by ta.groupby_long_0`, `digraph G {
+0 [label="runsql:{in:[],out:[Out:{t_0,t_1,t_2,},],attr:[sql:select compare_long_0,groupby_long_0,plain_long_0 from alice.tbl_0,table_refs:[alice.tbl_0],],url:[alice.com,]}"]
+1 [label="runsql:{in:[],out:[Out:{t_3,},],attr:[sql:select plain_long_0 from bob.tbl_0,table_refs:[bob.tbl_0],],url:[bob.com,]}"]
+2 [label="join:{in:[Left:{t_2,},Right:{t_3,},],out:[LeftJoinIndex:{t_4,},RightJoinIndex:{t_5,},],attr:[input_party_codes:[alice bob],join_type:0,],url:[alice.com,bob.com,]}"]
+3 [label="filter_by_index:{in:[Data:{t_0,t_1,t_2,},RowsIndexFilter:{t_4,},],out:[Out:{t_6,t_7,t_8,},],attr:[],url:[alice.com,]}"]
+4 [label="filter_by_index:{in:[Data:{t_3,},RowsIndexFilter:{t_5,},],out:[Out:{t_9,},],attr:[],url:[bob.com,]}"]
+5 [label="make_share:{in:[In:{t_7,},],out:[Out:{t_10,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+6 [label="make_share:{in:[In:{t_7,},],out:[Out:{t_11,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+7 [label="make_share:{in:[In:{t_6,},],out:[Out:{t_12,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+8 [label="make_share:{in:[In:{t_7,},],out:[Out:{t_13,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+9 [label="make_share:{in:[In:{t_8,},],out:[Out:{t_14,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+10 [label="make_share:{in:[In:{t_9,},],out:[Out:{t_15,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+11 [label="sort:{in:[In:{t_11,t_12,t_13,t_14,t_15,},Key:{t_10,},],out:[Out:{t_16,t_17,t_18,t_19,t_20,},],attr:[reverse:false,],url:[alice.com,bob.com,carol.com,]}"]
+12 [label="group_mark:{in:[Key:{t_16,},],out:[Group:{t_21,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+13 [label="sort:{in:[In:{t_17,},Key:{t_16,t_17,},],out:[Out:{t_22,},],attr:[reverse:false,],url:[alice.com,bob.com,carol.com,]}"]
+14 [label="group_mark:{in:[Key:{t_22,},],out:[Group:{t_23,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+15 [label="oblivious_group_agg:{in:[Group:{t_21,},In:{t_23,t_17,t_21,},],out:[Out:{t_24,t_25,t_26,},],attr:[agg_funcs:[sum avg count],],url:[alice.com,bob.com,carol.com,]}"]
+16 [label="shuffle:{in:[In:{t_24,t_25,t_26,t_18,t_21,},],out:[Out:{t_27,t_28,t_29,t_30,t_31,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+17 [label="make_public:{in:[In:{t_31,},],out:[Out:{t_32,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+18 [label="filter:{in:[Filter:{t_32,},In:{t_27,t_28,t_29,t_30,},],out:[Out:{t_33,t_34,t_35,t_36,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+19 [label="make_constant:{in:[],out:[Out:{t_37,},],attr:[scalar:4,to_status:1,],url:[alice.com,bob.com,carol.com,]}"]
+20 [label="broadcast:{in:[In:{t_37,},ShapeRefTensor:{t_35,},],out:[Out:{t_38,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+21 [label="GreaterEqual:{in:[Left:{t_35,},Right:{t_38,},],out:[Out:{t_39,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+22 [label="make_public:{in:[In:{t_39,},],out:[Out:{t_40,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+23 [label="apply_filter:{in:[Filter:{t_40,},In:{t_36,t_33,t_34,t_35,},],out:[Out:{t_41,t_42,t_43,t_44,},],attr:[],url:[alice.com,bob.com,carol.com,]}"]
+24 [label="make_private:{in:[In:{t_41,},],out:[Out:{t_45,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+25 [label="make_private:{in:[In:{t_42,},],out:[Out:{t_47,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+26 [label="make_private:{in:[In:{t_43,},],out:[Out:{t_49,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+27 [label="make_private:{in:[In:{t_44,},],out:[Out:{t_51,},],attr:[reveal_to:alice,],url:[alice.com,bob.com,carol.com,]}"]
+28 [label="publish:{in:[In:{t_45,t_47,t_49,t_51,},],out:[Out:{t_46,t_48,t_50,t_52,},],attr:[],url:[alice.com,]}"]
+0 -> 2 [label = "t_2:{plain_long_0:PRIVATE:INT64}"]
+0 -> 3 [label = "t_0:{compare_long_0:PRIVATE:INT64}"]
+0 -> 3 [label = "t_1:{groupby_long_0:PRIVATE:INT64}"]
+0 -> 3 [label = "t_2:{plain_long_0:PRIVATE:INT64}"]
+1 -> 2 [label = "t_3:{plain_long_0:PRIVATE:INT64}"]
+1 -> 4 [label = "t_3:{plain_long_0:PRIVATE:INT64}"]
+10 -> 11 [label = "t_15:{plain_long_0:SECRET:INT64}"]
+11 -> 12 [label = "t_16:{groupby_long_0:SECRET:INT64}"]
+11 -> 13 [label = "t_16:{groupby_long_0:SECRET:INT64}"]
+11 -> 13 [label = "t_17:{compare_long_0:SECRET:INT64}"]
+11 -> 13 [label = "t_17:{compare_long_0:SECRET:INT64}"]
+11 -> 15 [label = "t_17:{compare_long_0:SECRET:INT64}"]
+11 -> 16 [label = "t_18:{groupby_long_0:SECRET:INT64}"]
+12 -> 15 [label = "t_21:{group_mark:SECRET:BOOL}"]
+12 -> 15 [label = "t_21:{group_mark:SECRET:BOOL}"]
+12 -> 16 [label = "t_21:{group_mark:SECRET:BOOL}"]
+13 -> 14 [label = "t_22:{compare_long_0:SECRET:INT64}"]
+14 -> 15 [label = "t_23:{group_mark:SECRET:BOOL}"]
+15 -> 16 [label = "t_24:{group_mark:SECRET:INT64}"]
+15 -> 16 [label = "t_25:{compare_long_0:SECRET:FLOAT}"]
+15 -> 16 [label = "t_26:{group_mark:SECRET:INT64}"]
+16 -> 17 [label = "t_31:{group_mark:SECRET:BOOL}"]
+16 -> 18 [label = "t_27:{group_mark:SECRET:INT64}"]
+16 -> 18 [label = "t_28:{compare_long_0:SECRET:FLOAT}"]
+16 -> 18 [label = "t_29:{group_mark:SECRET:INT64}"]
+16 -> 18 [label = "t_30:{groupby_long_0:SECRET:INT64}"]
+17 -> 18 [label = "t_32:{group_mark:PUBLIC:BOOL}"]
+18 -> 20 [label = "t_35:{group_mark:SECRET:INT64}"]
+18 -> 21 [label = "t_35:{group_mark:SECRET:INT64}"]
+18 -> 23 [label = "t_33:{group_mark:SECRET:INT64}"]
+18 -> 23 [label = "t_34:{compare_long_0:SECRET:FLOAT}"]
+18 -> 23 [label = "t_35:{group_mark:SECRET:INT64}"]
+18 -> 23 [label = "t_36:{groupby_long_0:SECRET:INT64}"]
+19 -> 20 [label = "t_37:{constant_data:PUBLIC:INT64}"]
+2 -> 3 [label = "t_4:{plain_long_0:PRIVATE:INT64}"]
+2 -> 4 [label = "t_5:{plain_long_0:PRIVATE:INT64}"]
+20 -> 21 [label = "t_38:{constant_data:PUBLIC:INT64}"]
+21 -> 22 [label = "t_39:{GreaterEqual_out:SECRET:BOOL}"]
+22 -> 23 [label = "t_40:{GreaterEqual_out:PUBLIC:BOOL}"]
+23 -> 24 [label = "t_41:{groupby_long_0:SECRET:INT64}"]
+23 -> 25 [label = "t_42:{group_mark:SECRET:INT64}"]
+23 -> 26 [label = "t_43:{compare_long_0:SECRET:FLOAT}"]
+23 -> 27 [label = "t_44:{group_mark:SECRET:INT64}"]
+24 -> 28 [label = "t_45:{groupby_long_0:PRIVATE:INT64}"]
+25 -> 28 [label = "t_47:{group_mark:PRIVATE:INT64}"]
+26 -> 28 [label = "t_49:{compare_long_0:PRIVATE:FLOAT}"]
+27 -> 28 [label = "t_51:{group_mark:PRIVATE:INT64}"]
 3 -> 5 [label = "t_7:{groupby_long_0:PRIVATE:INT64}"]
 3 -> 6 [label = "t_7:{groupby_long_0:PRIVATE:INT64}"]
 3 -> 7 [label = "t_6:{compare_long_0:PRIVATE:INT64}"]
 3 -> 8 [label = "t_7:{groupby_long_0:PRIVATE:INT64}"]
 3 -> 9 [label = "t_8:{plain_long_0:PRIVATE:INT64}"]
-30 -> 33 [label = "t_57:{compare_long_0:PRIVATE:INT64}"]
-31 -> 33 [label = "t_59:{compare_long_0:PRIVATE:INT64}"]
-32 -> 33 [label = "t_61:{compare_long_0:PRIVATE:INT64}"]
 4 -> 10 [label = "t_9:{plain_long_0:PRIVATE:INT64}"]
 5 -> 11 [label = "t_10:{groupby_long_0:SECRET:INT64}"]
 6 -> 11 [label = "t_11:{groupby_long_0:SECRET:INT64}"]
@@ -1206,6 +1396,39 @@ var translateWithCCLTestCases = []sPair{
 7 -> 8 [label = "t_12:{Greater_out:SECRET:BOOL}"]
 8 -> 9 [label = "t_13:{Greater_out:PRIVATE:BOOL}"]
 9 -> 12 [label = "t_15:{join_long_0:PRIVATE:INT64}"]
+}`},
+	{`select ta.groupby_long_0, sum(tb.aggregate_long_0) as s from alice.tbl_0 as ta join bob.tbl_0 as tb on ta.join_long_0 = tb.join_long_0 group by ta.groupby_long_0`, `digraph G {
+0 [label="runsql:{in:[],out:[Out:{t_0,t_1,},],attr:[sql:select groupby_long_0,join_long_0 from alice.tbl_0,table_refs:[alice.tbl_0],],url:[alice.com,]}"]
+1 [label="runsql:{in:[],out:[Out:{t_2,t_3,},],attr:[sql:select aggregate_long_0,join_long_0 from bob.tbl_0,table_refs:[bob.tbl_0],],url:[bob.com,]}"]
+2 [label="join:{in:[Left:{t_1,},Right:{t_3,},],out:[LeftJoinIndex:{t_4,},RightJoinIndex:{t_5,},],attr:[input_party_codes:[alice bob],join_type:0,],url:[alice.com,bob.com,]}"]
+3 [label="filter_by_index:{in:[Data:{t_0,t_1,},RowsIndexFilter:{t_4,},],out:[Out:{t_6,t_7,},],attr:[],url:[alice.com,]}"]
+4 [label="filter_by_index:{in:[Data:{t_2,t_3,},RowsIndexFilter:{t_5,},],out:[Out:{t_8,t_9,},],attr:[],url:[bob.com,]}"]
+5 [label="group_he_sum:{in:[In:{t_8,},Key:{t_6,},],out:[Out:{t_10,},OutCount:{t_12,},OutKey:{t_11,},],attr:[input_party_codes:[alice bob],],url:[alice.com,bob.com,]}"]
+6 [label="make_constant:{in:[],out:[Out:{t_13,},],attr:[scalar:4,to_status:1,],url:[alice.com,bob.com,carol.com,]}"]
+7 [label="broadcast:{in:[In:{t_13,},ShapeRefTensor:{t_12,},],out:[Out:{t_14,},],attr:[],url:[alice.com,]}"]
+8 [label="GreaterEqual:{in:[Left:{t_12,},Right:{t_14,},],out:[Out:{t_15,},],attr:[],url:[alice.com,]}"]
+9 [label="apply_filter:{in:[Filter:{t_15,},In:{t_11,t_10,t_12,},],out:[Out:{t_16,t_17,t_18,},],attr:[],url:[alice.com,]}"]
+10 [label="publish:{in:[In:{t_16,t_17,},],out:[Out:{t_19,t_20,},],attr:[],url:[alice.com,]}"]
+0 -> 2 [label = "t_1:{join_long_0:PRIVATE:INT64}"]
+0 -> 3 [label = "t_0:{groupby_long_0:PRIVATE:INT64}"]
+0 -> 3 [label = "t_1:{join_long_0:PRIVATE:INT64}"]
+1 -> 2 [label = "t_3:{join_long_0:PRIVATE:INT64}"]
+1 -> 4 [label = "t_2:{aggregate_long_0:PRIVATE:INT64}"]
+1 -> 4 [label = "t_3:{join_long_0:PRIVATE:INT64}"]
+2 -> 3 [label = "t_4:{join_long_0:PRIVATE:INT64}"]
+2 -> 4 [label = "t_5:{join_long_0:PRIVATE:INT64}"]
+3 -> 5 [label = "t_6:{groupby_long_0:PRIVATE:INT64}"]
+4 -> 5 [label = "t_8:{aggregate_long_0:PRIVATE:INT64}"]
+5 -> 7 [label = "t_12:{group_count:PRIVATE:INT64}"]
+5 -> 8 [label = "t_12:{group_count:PRIVATE:INT64}"]
+5 -> 9 [label = "t_10:{aggregate_long_0:PRIVATE:INT64}"]
+5 -> 9 [label = "t_11:{groupby_long_0:PRIVATE:INT64}"]
+5 -> 9 [label = "t_12:{group_count:PRIVATE:INT64}"]
+6 -> 7 [label = "t_13:{constant_data:PUBLIC:INT64}"]
+7 -> 8 [label = "t_14:{constant_data:PRIVATE:INT64}"]
+8 -> 9 [label = "t_15:{GreaterEqual_out:PRIVATE:BOOL}"]
+9 -> 10 [label = "t_16:{groupby_long_0:PRIVATE:INT64}"]
+9 -> 10 [label = "t_17:{aggregate_long_0:PRIVATE:INT64}"]
 }`},
 	{`select ta.plain_long_0 in (1,2,3) from alice.tbl_0 as ta join bob.tbl_0 as tb on ta.plain_long_0 = tb.plain_long_0`, `digraph G {
 0 [label="runsql:{in:[],out:[Out:{t_0,},],attr:[sql:select plain_long_0 from alice.tbl_0,table_refs:[alice.tbl_0],],url:[alice.com,]}"]
@@ -1402,7 +1625,7 @@ func (s *testTranslatorSuite) TestBuildCCL(c *C) {
 
 		t, err := NewTranslator(
 			s.engineInfo, &scql.SecurityConfig{ColumnControlList: ccl},
-			s.issuerParty, false)
+			s.issuerParty, false, false)
 		c.Assert(err, IsNil)
 		builder, err := newLogicalNodeBuilder(t.issuerPartyCode, t.enginesInfo, convertOriginalCCL(t.sc))
 		if err != nil {
@@ -72,12 +72,15 @@ type ReportRequest struct {
 	sizeCache     protoimpl.SizeCache
 	unknownFields protoimpl.UnknownFields
 
-	Status          *Status   `protobuf:"bytes,1,opt,name=status,proto3" json:"status,omitempty"`
-	OutColumns      []*Tensor `protobuf:"bytes,2,rep,name=out_columns,json=outColumns,proto3" json:"out_columns,omitempty"`
-	DagId           int32     `protobuf:"varint,3,opt,name=dag_id,json=dagId,proto3" json:"dag_id,omitempty"`
-	SessionId       string    `protobuf:"bytes,4,opt,name=session_id,json=sessionId,proto3" json:"session_id,omitempty"`
-	PartyCode       string    `protobuf:"bytes,5,opt,name=party_code,json=partyCode,proto3" json:"party_code,omitempty"`
-	NumRowsAffected int64     `protobuf:"varint,6,opt,name=num_rows_affected,json=numRowsAffected,proto3" json:"num_rows_affected,omitempty"`
+	Status             *Status   `protobuf:"bytes,1,opt,name=status,proto3" json:"status,omitempty"`
+	OutColumns         []*Tensor `protobuf:"bytes,2,rep,name=out_columns,json=outColumns,proto3" json:"out_columns,omitempty"`
+	DagId              int32     `protobuf:"varint,3,opt,name=dag_id,json=dagId,proto3" json:"dag_id,omitempty"`
+	SessionId          string    `protobuf:"bytes,4,opt,name=session_id,json=sessionId,proto3" json:"session_id,omitempty"`
+	PartyCode          string    `protobuf:"bytes,5,opt,name=party_code,json=partyCode,proto3" json:"party_code,omitempty"`
+	NumRowsAffected    int64     `protobuf:"varint,6,opt,name=num_rows_affected,json=numRowsAffected,proto3" json:"num_rows_affected,omitempty"`
+	OutColumnsArrowIpc []byte    `protobuf:"bytes,7,opt,name=out_columns_arrow_ipc,json=outColumnsArrowIpc,proto3" json:"out_columns_arrow_ipc,omitempty"`
+	NumBytesWritten    int64     `protobuf:"varint,8,opt,name=num_bytes_written,json=numBytesWritten,proto3" json:"num_bytes_written,omitempty"`
+	NumFilesWritten    int64     `protobuf:"varint,9,opt,name=num_files_written,json=numFilesWritten,proto3" json:"num_files_written,omitempty"`
 }
 
 func (x *ReportRequest) Reset() {
@@ -154,6 +157,27 @@ func (x *ReportRequest) GetNumRowsAffected() int64 {
 	return 0
 }
 
+func (x *ReportRequest) GetOutColumnsArrowIpc() []byte {
+	if x != nil {
+		return x.OutColumnsArrowIpc
+	}
+	return nil
+}
+
+func (x *ReportRequest) GetNumBytesWritten() int64 {
+	if x != nil {
+		return x.NumBytesWritten
+	}
+	return 0
+}
+
+func (x *ReportRequest) GetNumFilesWritten() int64 {
+	if x != nil {
+		return x.NumFilesWritten
+	}
+	return 0
+}
+
 var File_api_common_proto protoreflect.FileDescriptor
 
 var file_api_common_proto_rawDesc = []byte{
@@ -171,7 +195,7 @@ var file_api_common_proto_rawDesc = []byte{
 	0x72, 0x73, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0a, 0x03, 0x6b, 0x65, 0x79, 0x18, 0x01,
 	0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6b, 0x65, 0x79, 0x12, 0x14, 0x0a, 0x05, 0x76, 0x61, 0x6c,
 	0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a,
-	0x02, 0x38, 0x01, 0x22, 0xeb, 0x01, 0x0a, 0x0d, 0x52, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x52, 0x65,
+	0x02, 0x38, 0x01, 0x22, 0xf6, 0x02, 0x0a, 0x0d, 0x52, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x52, 0x65,
 	0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x27, 0x0a, 0x06, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x18,
 	0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x0f, 0x2e, 0x73, 0x63, 0x71, 0x6c, 0x2e, 0x70, 0x62, 0x2e,
 	0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x52, 0x06, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x12, 0x30,
@@ -186,8 +210,17 @@ var file_api_common_proto_rawDesc = []byte{
 	0x79, 0x43, 0x6f, 0x64, 0x65, 0x12, 0x2a, 0x0a, 0x11, 0x6e, 0x75, 0x6d, 0x5f, 0x72, 0x6f, 0x77,
 	0x73, 0x5f, 0x61, 0x66, 0x66, 0x65, 0x63, 0x74, 0x65, 0x64, 0x18, 0x06, 0x20, 0x01, 0x28, 0x03,
 	0x52, 0x0f, 0x6e, 0x75, 0x6d, 0x52, 0x6f, 0x77, 0x73, 0x41, 0x66, 0x66, 0x65, 0x63, 0x74, 0x65,
-	0x64, 0x42, 0x10, 0x5a, 0x0e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2d, 0x67, 0x65, 0x6e, 0x2f, 0x73,
-	0x63, 0x71, 0x6c, 0x62, 0x06, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x33,
+	0x64, 0x12, 0x31, 0x0a, 0x15, 0x6f, 0x75, 0x74, 0x5f, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73,
+	0x5f, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x5f, 0x69, 0x70, 0x63, 0x18, 0x07, 0x20, 0x01, 0x28, 0x0c,
+	0x52, 0x12, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x41, 0x72, 0x72, 0x6f,
+	0x77, 0x49, 0x70, 0x63, 0x12, 0x2a, 0x0a, 0x11, 0x6e, 0x75, 0x6d, 0x5f, 0x62, 0x79, 0x74, 0x65,
+	0x73, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6e, 0x18, 0x08, 0x20, 0x01, 0x28, 0x03, 0x52,
+	0x0f, 0x6e, 0x75, 0x6d, 0x42, 0x79, 0x74, 0x65, 0x73, 0x57, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6e,
+	0x12, 0x2a, 0x0a, 0x11, 0x6e, 0x75, 0x6d, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x5f, 0x77, 0x72,
+	0x69, 0x74, 0x74, 0x65, 0x6e, 0x18, 0x09, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0f, 0x6e, 0x75, 0x6d,
+	0x46, 0x69, 0x6c, 0x65, 0x73, 0x57, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6e, 0x42, 0x10, 0x5a, 0x0e,
+	0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2d, 0x67, 0x65, 0x6e, 0x2f, 0x73, 0x63, 0x71, 0x6c, 0x62, 0x06,
+	0x70, 0x72, 0x6f, 0x74, 0x6f, 0x33,
 }
 
 var (
@@ -155,7 +155,8 @@ func (app *App) compile(lpInfo *LogicalPlanInfo, s *session) (*ExecutionPlanInfo
 			ColumnControlList: lpInfo.ccls,
 		},
 		lpInfo.issuer,
-		s.skipDbName)
+		s.skipDbName,
+		app.config.RevealShuffledFilter)
 	if err != nil {
 		return nil, fmt.Errorf("error when translating from logical plan to execution plan: %v", err)
 	}
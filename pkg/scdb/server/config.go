@@ -37,10 +37,12 @@ const (
 )
 
 type EngineConfig struct {
-	ClientTimeout time.Duration `yaml:"timeout"`
-	Protocol      string        `yaml:"protocol"`
-	ContentType   string        `yaml:"content_type"`
-	SpuRuntimeCfg *RuntimeCfg   `yaml:"spu"`
+	ClientTimeout  time.Duration `yaml:"timeout"`
+	Protocol       string        `yaml:"protocol"`
+	ContentType    string        `yaml:"content_type"`
+	ArrowIPCResult bool          `yaml:"arrow_ipc_result"`
+	ResultPageRows int64         `yaml:"result_page_rows"`
+	SpuRuntimeCfg  *RuntimeCfg   `yaml:"spu"`
 }
 
 type RuntimeCfg struct {
@@ -86,6 +88,7 @@ type Config struct {
 	Storage              StorageConf   `yaml:"storage"`
 	GRM                  GRMConf       `yaml:"grm"`
 	Engine               EngineConfig  `yaml:"engine"`
+	RevealShuffledFilter bool          `yaml:"reveal_shuffled_filter"`
 }
 
 const (
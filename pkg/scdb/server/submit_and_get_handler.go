@@ -101,6 +101,8 @@ func (app *App) submitAndGetDQL(ctx context.Context, s *session) *scql.SCDBQuery
 		app.engineClient,
 		app.config.Engine.Protocol,
 		app.config.Engine.ContentType,
+		app.config.Engine.ArrowIPCResult,
+		app.config.Engine.ResultPageRows,
 	)
 
 	lpInfo, err := app.compilePrepare(ctx, s)
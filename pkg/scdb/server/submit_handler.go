@@ -142,6 +142,8 @@ func (app *App) runDQL(ctx context.Context, session *session) *scql.SCDBSubmitRe
 		app.engineClient,
 		app.config.Engine.Protocol,
 		app.config.Engine.ContentType,
+		app.config.Engine.ArrowIPCResult,
+		app.config.Engine.ResultPageRows,
 	)
 
 	elp, err := app.compilePrepare(ctx, session)